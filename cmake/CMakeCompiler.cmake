@@ -36,6 +36,10 @@ macro(setup_default_compiler_flags _project_name)
 			add_definitions(-DACL_USE_POPCOUNT)
 		endif()
 
+		if(USE_BMI2_INSTRUCTIONS)
+			add_definitions(-DACL_BMI2_INTRINSICS)
+		endif()
+
 		# Disable various warnings that are harmless
 		target_compile_options(${_project_name} PRIVATE /wd4514)			# Unreferenced inline function removed
 		target_compile_options(${_project_name} PRIVATE /wd4619)			# No warning with specified number
@@ -78,6 +82,11 @@ macro(setup_default_compiler_flags _project_name)
 			if(USE_POPCNT_INSTRUCTIONS)
 				target_compile_options(${_project_name} PRIVATE "-mpopcnt")
 			endif()
+
+			if(USE_BMI2_INSTRUCTIONS)
+				target_compile_options(${_project_name} PRIVATE "-mbmi2")
+				add_definitions(-DACL_BMI2_INTRINSICS)
+			endif()
 		else()
 			if(NOT USE_SIMD_INSTRUCTIONS)
 				add_definitions(-DRTM_NO_INTRINSICS)
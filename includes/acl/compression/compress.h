@@ -34,6 +34,7 @@
 #include "acl/compression/output_stats.h"
 #include "acl/compression/track_array.h"
 
+#include <cstddef>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -83,6 +84,25 @@ namespace acl
 		const track_array_qvvf& additive_base_track_list, additive_clip_format8 additive_format,
 		compressed_tracks*& out_compressed_tracks, output_stats& out_stats);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Estimates the peak amount of memory that compressing a transform track array
+	// will allocate. This can be used to schedule compression jobs based on the memory
+	// available before the clips are loaded. The estimate accounts for the clip contexts,
+	// the bit rate optimization scratch memory (including the context and cached lossy
+	// transforms of each worker thread), and the compressed output. It does not include
+	// the memory used by the input track arrays nor the bone chain permutations searched
+	// which grow with the compression level, it is not a strict upper bound.
+	//
+	// The detailed compression stats report the actual peak memory usage of each stage.
+	//
+	//    settings:					The compression settings to use.
+	//    num_transforms:			The number of transforms in the track array.
+	//    num_samples_per_track:	The number of samples per transform track.
+	//    has_scale:				Whether or not the tracks contain scale.
+	//    num_additive_base_samples:	The number of samples per transform track of the additive base, 0 if there is none.
+	//////////////////////////////////////////////////////////////////////////
+	size_t estimate_compression_peak_memory(const compression_settings& settings, uint32_t num_transforms, uint32_t num_samples_per_track, bool has_scale, uint32_t num_additive_base_samples);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Takes a list of compressed track instances that contain the contributing error metadata and uses their data to build
 	// a new database instance. Each compressed track instance will be duplicated and split between a new instance and the
@@ -99,6 +119,29 @@ namespace acl
 		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
 		compressed_tracks** out_compressed_tracks, compressed_database*& out_database);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Takes a list of compressed track instances that contain the contributing error metadata and uses their data to build
+	// a new database instance. Each compressed track instance will be duplicated and split between a new instance and the
+	// database.
+	//
+	// Clips can optionally be grouped by how they are played together (e.g. clips of the same character or level).
+	// Clips that share a group ID are written contiguously into the database chunks, regardless of their order in the
+	// list, so that streaming in the data for a group touches as few chunks as possible. Groups are written in increasing
+	// group ID order and clips within a group retain their relative order. A co-play graph can be reduced to groups by
+	// assigning a group ID to each connected set of clips.
+	//
+	//    allocator:						The allocator instance to use
+	//    settings:							The settings to use when creating the database
+	//    compressed_tracks_list:			The list of compressed tracks to build the database with (must have contributing error metadata)
+	//    clip_group_ids:					The list of group IDs, one per compressed track instance (optional, can be nullptr)
+	//    num_compressed_tracks:			The number of compressed track instances in the above lists
+	//    out_compressed_tracks:			The output list of compressed tracks bound to the output database (array allocated by the caller (must be large enough); compressed_tracks instances allocated by the function)
+	//    out_database:						The output database (allocated by the function)
+	//////////////////////////////////////////////////////////////////////////
+	error_result build_database(iallocator& allocator, const compression_database_settings& settings,
+		const compressed_tracks* const* compressed_tracks_list, const uint32_t* clip_group_ids, uint32_t num_compressed_tracks,
+		compressed_tracks** out_compressed_tracks, compressed_database*& out_database);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Takes a compressed database with inline bulk data and duplicates it into
 	// a new database instance where the bulk data lives in separate buffers.
@@ -123,6 +166,43 @@ namespace acl
 	//////////////////////////////////////////////////////////////////////////
 	error_result strip_database_quality_tier(iallocator& allocator, const compressed_database& database, quality_tier tier, compressed_database*& out_stripped_database);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Takes two compressed databases with inline bulk data and merges them into a new database instance.
+	// The chunks, clip metadata, and runtime headers of the first database are left untouched at the start
+	// of the new database: its bulk data is only appended to and the compressed tracks instances bound to it
+	// remain valid and bound to the new database. The data of the second database follows and the compressed
+	// tracks instances bound to it must be provided since they must be rebound to their new location.
+	//
+	//    allocator:						The allocator instance to use to allocate the new database and compressed tracks.
+	//    database0:						The first source database, its compressed tracks instances remain valid.
+	//    database1:						The second source database, appended after the first.
+	//    db1_compressed_tracks_list:		The list of every compressed tracks instance bound to the second database.
+	//    num_db1_compressed_tracks:		The number of compressed track instances in the above list.
+	//    out_db1_compressed_tracks:		The output list of compressed tracks rebound to the output database (array allocated by the caller (must be large enough); compressed_tracks instances allocated by the function)
+	//    out_merged_database:				The output database (allocated by the function)
+	//////////////////////////////////////////////////////////////////////////
+	error_result merge_databases(iallocator& allocator, const compressed_database& database0, const compressed_database& database1,
+		const compressed_tracks* const* db1_compressed_tracks_list, uint32_t num_db1_compressed_tracks,
+		compressed_tracks** out_db1_compressed_tracks, compressed_database*& out_merged_database);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Takes a list of compressed track instances that contain the contributing error metadata and appends their data
+	// as new chunks at the end of an existing database with inline bulk data. Existing chunks, their offsets, and the
+	// compressed tracks instances already bound to the source database remain valid with the new database.
+	// This is equivalent to calling `build_database(..)` on the new clips followed by `merge_databases(..)`.
+	//
+	//    allocator:						The allocator instance to use
+	//    settings:							The settings to use when building the new chunks
+	//    database:							The source database to append to
+	//    compressed_tracks_list:			The list of compressed tracks to append (must have contributing error metadata)
+	//    num_compressed_tracks:			The number of compressed track instances in the above list
+	//    out_compressed_tracks:			The output list of compressed tracks bound to the output database (array allocated by the caller (must be large enough); compressed_tracks instances allocated by the function)
+	//    out_database:						The output database (allocated by the function)
+	//////////////////////////////////////////////////////////////////////////
+	error_result append_to_database(iallocator& allocator, const compression_database_settings& settings, const compressed_database& database,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		compressed_tracks** out_compressed_tracks, compressed_database*& out_database);
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
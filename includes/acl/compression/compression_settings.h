@@ -26,6 +26,7 @@
 
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/algorithm_types.h"
 #include "acl/core/error_result.h"
 #include "acl/core/hash.h"
 #include "acl/core/track_formats.h"
@@ -235,6 +236,104 @@ namespace acl
 		// See `sample_looping_policy` for details.
 		bool optimize_loops = false;
 
+		//////////////////////////////////////////////////////////////////////////
+		// The algorithm used to compress scalar tracks.
+		// With 'spline_key_reduction', every track retains a variable number of keys placed
+		// through error bounded curve fitting and interpolated with a cubic curve. Smooth
+		// curves need far fewer keys than samples at the cost of slower decompression.
+		// Keys are grouped in blocks of 32 samples to keep seeking cache friendly.
+		// The other scalar specific settings below only apply to 'uniformly_sampled'.
+		// Scalar tracks only, transform tracks always use 'uniformly_sampled'.
+		// Defaults to 'uniformly_sampled'
+		algorithm_type8 scalar_algorithm = algorithm_type8::uniformly_sampled;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to store the track offsets required to decompress a single
+		// track in constant time. Without them, decompressing a single track scans the
+		// metadata of every track that precedes it which is slow with large track lists.
+		// This adds 20 bytes for every 16 tracks and with spline key reduction, another
+		// 8 bytes for every 16 tracks in every key block.
+		// Scalar tracks only.
+		// Defaults to 'false'
+		bool enable_scalar_track_offsets = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to split scalar tracks into segments of roughly 16 samples.
+		// Each segment stores a range per animated track quantized on 8 bits per component
+		// which lowers the bit rate required by tracks with a large clip wide range.
+		// Seeking then only touches the segments that contain the two samples interpolated.
+		// Scalar tracks only.
+		// Defaults to 'false'
+		bool enable_scalar_segmenting = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to raise the bit rate of float1f tracks so that groups of 4
+		// consecutive animated tracks share the same bit rate. Such groups are unpacked
+		// and interpolated together with SIMD during decompression which is much faster
+		// with large track lists (e.g. blend shape weights) at the cost of a slightly
+		// larger memory footprint. Accuracy is unaffected.
+		// Scalar float1f tracks only.
+		// Defaults to 'false'
+		bool enable_scalar_track_grouping = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to detect scalar tracks that retain the same value for most of
+		// their samples and that are only active in short spans (e.g. blend shape weights).
+		// Such tracks store their inactive value once and only the samples of their active
+		// spans, each with its own range. Decompression skips them outside their spans.
+		// Scalar tracks only.
+		// Defaults to 'false'
+		bool enable_scalar_sparse_tracks = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to store scalar tracks at half or a quarter of the sample rate
+		// when linearly interpolating the samples retained remains within their precision
+		// (e.g. slow moving curves sampled alongside fast moving ones). Each such track
+		// retains its own samples and range, decompression interpolates them at its own rate.
+		// Scalar tracks only, transform tracks always retain every sample of their segment.
+		// Defaults to 'false'
+		bool enable_scalar_decimation = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to raise the variable bit rates of each segment to 8 or 16 bits
+		// per component (or full precision) when it increases the size of its animated
+		// samples by no more than 'byte_aligned_bit_rate_size_threshold'. Every animated
+		// sample then starts on a byte boundary and decompression uses aligned loads
+		// instead of extracting bits. Bit rates are only raised if accuracy doesn't regress.
+		// Transform tracks only.
+		// Defaults to 'false'
+		bool enable_byte_aligned_bit_rates = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The maximum proportion by which the animated samples of a segment can grow when
+		// 'enable_byte_aligned_bit_rates' is true. e.g. 0.1 allows them to grow by 10%.
+		// Must be positive or zero.
+		// Transform tracks only.
+		// Defaults to '0.1'
+		float byte_aligned_bit_rate_size_threshold = 0.1F;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The number of bit rates to cache per rotation/translation/scale sub-track while
+		// optimizing variable bit rates. A larger cache avoids quantizing the same samples
+		// repeatedly at the cost of memory. When 0, it is selected from the compression level
+		// and the clip size. This does not impact the compressed output and it isn't part of the hash.
+		// Must be in the range [0, 8].
+		// Transform tracks only.
+		// Defaults to '0' (automatic)
+		uint32_t num_bit_rates_cached_per_track = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The number of threads used to search for the optimal variable bit rates.
+		// Worker threads are created for the duration of the search and each requires its
+		// own copy of the optimization state which increases memory usage proportionally.
+		// When 0, one thread per hardware thread is used. When 1, only the calling thread is used.
+		// Threads are opt-in, unless ACL_USE_THREADS is defined only the calling thread is used.
+		// The compressed output is identical regardless of the number of threads and it isn't part of the hash.
+		// Must be in the range [0, 256].
+		// Transform tracks only.
+		// Defaults to '1'
+		uint32_t num_bit_rate_optimization_threads = 1;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Keyframe stripping related settings. See [compression_keyframe_stripping_settings].
 		// Transform tracks only.
@@ -65,6 +65,12 @@ namespace acl
 	using track_array_float3f	= track_array_typed<track_type8::float3f>;
 	using track_array_float4f	= track_array_typed<track_type8::float4f>;
 	using track_array_vector4f	= track_array_typed<track_type8::vector4f>;
+	using track_array_float1d	= track_array_typed<track_type8::float1d>;
+	using track_array_float2d	= track_array_typed<track_type8::float2d>;
+	using track_array_float3d	= track_array_typed<track_type8::float3d>;
+	using track_array_float4d	= track_array_typed<track_type8::float4d>;
+	using track_array_vector4d	= track_array_typed<track_type8::vector4d>;
+	using track_array_quatf		= track_array_typed<track_type8::quatf>;
 	using track_array_qvvf		= track_array_typed<track_type8::qvvf>;
 
 	class track;
@@ -75,6 +81,12 @@ namespace acl
 	using track_float3f			= track_typed<track_type8::float3f>;
 	using track_float4f			= track_typed<track_type8::float4f>;
 	using track_vector4f		= track_typed<track_type8::vector4f>;
+	using track_float1d			= track_typed<track_type8::float1d>;
+	using track_float2d			= track_typed<track_type8::float2d>;
+	using track_float3d			= track_typed<track_type8::float3d>;
+	using track_float4d			= track_typed<track_type8::float4d>;
+	using track_vector4d		= track_typed<track_type8::vector4d>;
+	using track_quatf			= track_typed<track_type8::quatf>;
 	using track_qvvf			= track_typed<track_type8::qvvf>;
 
 	enum class additive_clip_format8 : uint8_t;
@@ -32,6 +32,7 @@
 #include "acl/core/error.h"
 #include "acl/core/sample_looping_policy.h"
 #include "acl/core/track_formats.h"
+#include "acl/core/profiling.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/compression/compression_settings.h"
 #include "acl/compression/track_array.h"
@@ -81,6 +82,8 @@ namespace acl
 
 		inline bool initialize_clip_context(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, additive_clip_format8 additive_format, clip_context& out_clip_context)
 		{
+			ACL_PROFILE_SCOPE("acl::initialize_clip_context");
+
 			const uint32_t num_transforms = track_list.get_num_tracks();
 			const uint32_t num_samples = track_list.get_num_samples_per_track();
 			const float sample_rate = track_list.get_sample_rate();
@@ -191,6 +194,7 @@ namespace acl
 			segment.animated_translation_bit_size = 0;
 			segment.animated_scale_bit_size = 0;
 			segment.animated_pose_bit_size = 0;
+			segment.are_samples_byte_aligned = false;
 			segment.animated_data_size = 0;
 			segment.range_data_size = 0;
 			segment.total_header_size = 0;
@@ -29,6 +29,8 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/iallocator.h"
 #include "acl/core/track_desc.h"
+#include "acl/core/profiling.h"
+#include "acl/compression/impl/rotation.scalar.h"
 #include "acl/compression/impl/track_list_context.h"
 
 #include <cstdint>
@@ -47,8 +49,28 @@ namespace acl
 			return range.is_constant(desc.precision);
 		}
 
+		// Rotations are constant if every sample is within our precision of the first one, see 'calculate_packed_quatf_error'
+		inline bool is_quatf_track_constant(const track& ref_track)
+		{
+			const track_float3f& typed_ref_track = track_cast<const track_float3f>(ref_track);
+			const float precision = typed_ref_track.get_description().precision;
+			const uint32_t num_samples = typed_ref_track.get_num_samples();
+
+			const rtm::vector4f first_sample = rtm::vector_load3(&typed_ref_track[0]);
+			for (uint32_t sample_index = 1; sample_index < num_samples; ++sample_index)
+			{
+				const rtm::vector4f sample = rtm::vector_load3(&typed_ref_track[sample_index]);
+				if (calculate_packed_quatf_error(sample, first_sample) > precision)
+					return false;
+			}
+
+			return true;
+		}
+
 		inline void extract_constant_tracks(track_list_context& context)
 		{
+			ACL_PROFILE_SCOPE("acl::extract_constant_tracks");
+
 			ACL_ASSERT(context.is_valid(), "Invalid context");
 
 			const bitset_description bitset_desc = bitset_description::make_from_num_bits(context.num_tracks);
@@ -65,7 +87,10 @@ namespace acl
 				switch (range.category)
 				{
 				case track_category8::scalarf:
-					is_constant = is_scalarf_track_constant(mut_track, range);
+					if (context.has_quatf_tracks)
+						is_constant = is_quatf_track_constant((*context.reference_list)[track_index]);
+					else
+						is_constant = is_scalarf_track_constant(mut_track, range);
 					break;
 				case track_category8::scalard:
 				case track_category8::transformf:
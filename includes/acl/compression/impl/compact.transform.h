@@ -30,6 +30,7 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/error.h"
 #include "acl/core/scope_profiler.h"
+#include "acl/core/profiling.h"
 #include "acl/compression/impl/clip_context.h"
 #include "acl/compression/impl/compression_stats.h"
 #include "acl/compression/impl/rigid_shell_utils.h"
@@ -359,10 +360,13 @@ namespace acl
 			const compression_settings& settings,
 			compression_stats_t& compression_stats)
 		{
+			ACL_PROFILE_SCOPE("acl::compact_constant_streams");
+
 			(void)compression_stats;
 
 #if defined(ACL_USE_SJSON)
 			scope_profiler compact_constant_sub_tracks_time;
+			scope_stage_memory_tracker compact_constant_sub_tracks_memory(compression_stats, compression_stats.compact_constant_sub_tracks_memory);
 #endif
 
 			ACL_ASSERT(context.num_segments == 1, "context must contain a single segment!");
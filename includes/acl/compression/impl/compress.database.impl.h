@@ -34,6 +34,7 @@
 #include "acl/core/iallocator.h"
 #include "acl/core/impl/bit_cast.impl.h"
 
+#include <algorithm>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -87,17 +88,43 @@ namespace acl
 
 			clip_contributing_error_t* contributing_error_per_clip;		// One instance per clip
 
-			frame_assignment_context(iallocator& allocator_, const compressed_tracks* const* compressed_tracks_list_, uint32_t num_compressed_tracks_, uint32_t num_movable_frames_)
+			uint32_t* clip_write_order;									// Order in which clips are written into chunks, clips in the same group are contiguous
+			uint32_t* clip_header_offsets;								// Runtime clip header offset of every clip
+
+			frame_assignment_context(iallocator& allocator_, const compressed_tracks* const* compressed_tracks_list_, const uint32_t* clip_group_ids, uint32_t num_compressed_tracks_, uint32_t num_movable_frames_)
 				: allocator(allocator_)
 				, compressed_tracks_list(compressed_tracks_list_)
 				, num_compressed_tracks(num_compressed_tracks_)
 				, num_movable_frames(num_movable_frames_)
 				, contributing_error_per_clip(allocate_type_array<clip_contributing_error_t>(allocator_, num_compressed_tracks_))
+				, clip_write_order(allocate_type_array<uint32_t>(allocator_, num_compressed_tracks_))
+				, clip_header_offsets(allocate_type_array<uint32_t>(allocator_, num_compressed_tracks_))
 			{
 				mappings[0].tier = quality_tier::highest_importance;
 				mappings[1].tier = quality_tier::medium_importance;
 				mappings[2].tier = quality_tier::lowest_importance;
 
+				// Runtime clip headers are laid out in the order clips are provided
+				uint32_t clip_header_offset = 0;
+				for (uint32_t list_index = 0; list_index < num_compressed_tracks_; ++list_index)
+				{
+					const transform_tracks_header& transform_header = get_transform_tracks_header(*compressed_tracks_list_[list_index]);
+
+					clip_header_offsets[list_index] = clip_header_offset;
+					clip_header_offset += sizeof(database_runtime_clip_header) + sizeof(database_runtime_segment_header) * transform_header.num_segments;
+				}
+
+				// Clips are written in chunks in the order provided unless we have groups in which case clips
+				// that play together are written contiguously to minimize how many chunks a group spans
+				for (uint32_t list_index = 0; list_index < num_compressed_tracks_; ++list_index)
+					clip_write_order[list_index] = list_index;
+
+				if (clip_group_ids != nullptr)
+				{
+					const auto sort_predicate = [clip_group_ids](uint32_t lhs, uint32_t rhs) { return clip_group_ids[lhs] < clip_group_ids[rhs]; };
+					std::stable_sort(clip_write_order, clip_write_order + num_compressed_tracks_, sort_predicate);
+				}
+
 				// Setup our error metadata to make iterating on it easier and track what has been assigned
 				for (uint32_t list_index = 0; list_index < num_compressed_tracks_; ++list_index)
 				{
@@ -176,6 +203,8 @@ namespace acl
 				}
 
 				deallocate_type_array(allocator, contributing_error_per_clip, num_compressed_tracks);
+				deallocate_type_array(allocator, clip_write_order, num_compressed_tracks);
+				deallocate_type_array(allocator, clip_header_offsets, num_compressed_tracks);
 			}
 
 			frame_assignment_context(const frame_assignment_context&) = delete;
@@ -292,7 +321,7 @@ namespace acl
 						best_mapping.animated_data = animated_data;
 						best_mapping.tracks_index = list_index;
 						best_mapping.segment_index = segment_index;
-						best_mapping.frame_bit_size = segment_headers[segment_index].animated_pose_bit_size;
+						best_mapping.frame_bit_size = segment_headers[segment_index].get_animated_pose_bit_size(tracks->get_version());
 						best_mapping.clip_frame_index = next_keyframe_to_strip.keyframe_index;
 						best_mapping.segment_frame_index = next_keyframe_to_strip.keyframe_index - segment_start_frame_index;
 						best_mapping.contributing_error = next_keyframe_to_strip.stripping_error;
@@ -463,16 +492,17 @@ namespace acl
 			return sample_indices;
 		}
 
-		inline void rewrite_segment_headers(const database_tier_mapping& tier_mapping, uint32_t tracks_index, const transform_tracks_header& input_transforms_header, const segment_header* headers, uint32_t segment_data_base_offset, stripped_segment_header_t* out_headers)
+		inline void rewrite_segment_headers(const database_tier_mapping& tier_mapping, uint32_t tracks_index, compressed_tracks_version16 version, const transform_tracks_header& input_transforms_header, const segment_header* headers, uint32_t segment_data_base_offset, stripped_segment_header_t* out_headers)
 		{
 			const bitset_description desc = bitset_description::make_from_num_bits<32>();
 
 			uint32_t segment_data_offset = segment_data_base_offset;
 			for (uint32_t segment_index = 0; segment_index < input_transforms_header.num_segments; ++segment_index)
 			{
-				const uint32_t animated_pose_bit_size = headers[segment_index].animated_pose_bit_size;
+				const uint32_t animated_pose_bit_size = headers[segment_index].get_animated_pose_bit_size(version);
 
-				out_headers[segment_index].animated_pose_bit_size = animated_pose_bit_size;
+				// The output tracks retain the input version
+				out_headers[segment_index].set_animated_pose(version, animated_pose_bit_size, headers[segment_index].get_is_byte_aligned(version));
 				out_headers[segment_index].animated_rotation_bit_size = headers[segment_index].animated_rotation_bit_size;
 				out_headers[segment_index].animated_translation_bit_size = headers[segment_index].animated_translation_bit_size;
 				out_headers[segment_index].segment_data = segment_data_offset;
@@ -557,7 +587,6 @@ namespace acl
 			const bitset_description desc = bitset_description::make_from_num_bits<32>();
 
 			const database_tier_mapping& tier_mapping = context.get_tier_mapping(quality_tier::highest_importance);
-			uint32_t clip_header_offset = 0;
 
 			for (uint32_t list_index = 0; list_index < context.num_compressed_tracks; ++list_index)
 			{
@@ -636,7 +665,7 @@ namespace acl
 					// Check our data mapping to find our how many frames we'll retain
 					const uint32_t sample_indices = build_sample_indices(tier_mapping, list_index, segment_index);
 					const uint32_t num_animated_frames = bitset_count_set_bits(&sample_indices, desc);
-					const uint32_t animated_data_size = ((num_animated_frames * input_segment_headers[segment_index].animated_pose_bit_size) + 7) / 8;
+					const uint32_t animated_data_size = ((num_animated_frames * input_segment_headers[segment_index].get_animated_pose_bit_size(input_header.version)) + 7) / 8;
 
 					num_remaining_keyframes += num_animated_frames;
 
@@ -716,15 +745,11 @@ namespace acl
 
 				// Setup our database header
 				tracks_database_header* tracks_db_header = transforms_header->get_database_header();
-				tracks_db_header->clip_header_offset = clip_header_offset;
-
-				// Update our clip header offset
-				clip_header_offset += sizeof(database_runtime_clip_header);
-				clip_header_offset += sizeof(database_runtime_segment_header) * input_transforms_header.num_segments;
+				tracks_db_header->clip_header_offset = context.clip_header_offsets[list_index];
 
 				// Write our new segment headers
 				const uint32_t segment_data_base_offset = transforms_header->clip_range_data_offset + clip_range_data_size;
-				rewrite_segment_headers(tier_mapping, list_index, input_transforms_header, input_segment_headers, segment_data_base_offset, transforms_header->get_stripped_segment_headers());
+				rewrite_segment_headers(tier_mapping, list_index, input_header.version, input_transforms_header, input_segment_headers, segment_data_base_offset, transforms_header->get_stripped_segment_headers());
 
 				// Copy our sub-track types, they do not change
 				std::memcpy(transforms_header->get_sub_track_types(), input_transforms_header.get_sub_track_types(), packed_sub_track_buffer_size);
@@ -913,8 +938,9 @@ namespace acl
 			uint32_t chunk_size = sizeof(database_chunk_header);
 			uint32_t num_chunks = 0;
 
-			for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
+			for (uint32_t order_index = 0; order_index < context.num_compressed_tracks; ++order_index)
 			{
+				const uint32_t tracks_index = context.clip_write_order[order_index];
 				const compressed_tracks* tracks = context.compressed_tracks_list[tracks_index];
 				const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
 
@@ -983,8 +1009,6 @@ namespace acl
 			uint32_t chunk_size = sizeof(database_chunk_header);
 			uint32_t chunk_index = 0;
 
-			uint32_t clip_header_offset = 0;
-
 			if (bulk_data != nullptr)
 			{
 				// Setup our chunk headers
@@ -997,11 +1021,13 @@ namespace acl
 			}
 
 			// We first iterate to find our chunk delimitations and write our headers
-			for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
+			for (uint32_t order_index = 0; order_index < context.num_compressed_tracks; ++order_index)
 			{
+				const uint32_t tracks_index = context.clip_write_order[order_index];
 				const compressed_tracks* tracks = db_compressed_tracks_list[tracks_index];
 				const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
 
+				const uint32_t clip_header_offset = context.clip_header_offsets[tracks_index];
 				uint32_t segment_header_offset = clip_header_offset + sizeof(database_runtime_clip_header);
 
 				for (uint32_t segment_index = 0; segment_index < transforms_header.num_segments; ++segment_index)
@@ -1059,8 +1085,6 @@ namespace acl
 
 					ACL_ASSERT(chunk_size <= max_chunk_size, "Expected a valid chunk size, segment is larger than max chunk size?");
 				}
-
-				clip_header_offset = segment_header_offset;
 			}
 
 			// If we have leftover data, finalize our last chunk
@@ -1086,8 +1110,9 @@ namespace acl
 				segment_chunk_headers = chunk_header->get_segment_headers();
 
 				uint32_t chunk_segment_index = 0;
-				for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
+				for (uint32_t order_index = 0; order_index < context.num_compressed_tracks; ++order_index)
 				{
+					const uint32_t tracks_index = context.clip_write_order[order_index];
 					const compressed_tracks* tracks = db_compressed_tracks_list[tracks_index];
 					const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
 
@@ -1247,11 +1272,60 @@ namespace acl
 
 			return database;
 		}
+
+		// Returns the size in bytes of the runtime clip and segment headers a database requires
+		inline uint32_t calculate_runtime_headers_size(const database_header& header)
+		{
+			return header.num_clips * uint32_t(sizeof(database_runtime_clip_header)) + header.num_segments * uint32_t(sizeof(database_runtime_segment_header));
+		}
+
+		// Duplicates a compressed tracks instance bound to a database and offsets where its runtime clip header lives
+		inline compressed_tracks* rebind_compressed_tracks(iallocator& allocator, const compressed_tracks& tracks, uint32_t clip_header_offset_delta)
+		{
+			const uint32_t buffer_size = tracks.get_size();
+
+			uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, buffer_size, alignof(compressed_tracks));
+			std::memcpy(buffer, &tracks, buffer_size);
+
+			compressed_tracks* rebound_tracks = bit_cast<compressed_tracks*>(buffer);
+
+			transform_tracks_header& transforms_header = get_transform_tracks_header(*rebound_tracks);
+			tracks_database_header* tracks_db_header = transforms_header.get_database_header();
+			tracks_db_header->clip_header_offset = uint32_t(tracks_db_header->clip_header_offset) + clip_header_offset_delta;
+
+			// The hash covers the database header, update it
+			raw_buffer_header* buffer_header = safe_ptr_cast<raw_buffer_header>(buffer);
+			buffer_header->hash = hash32(buffer + sizeof(raw_buffer_header), buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+
+			ACL_ASSERT(rebound_tracks->is_valid(true).empty(), "Failed to rebind compressed tracks");
+
+			return rebound_tracks;
+		}
+
+		// Returns the new hash of a clip that has been rebound
+		inline uint32_t find_rebound_clip_hash(uint32_t clip_hash, const compressed_tracks* const* compressed_tracks_list, const compressed_tracks* const* rebound_compressed_tracks_list, uint32_t num_compressed_tracks)
+		{
+			for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			{
+				if (compressed_tracks_list[list_index]->get_hash() == clip_hash)
+					return rebound_compressed_tracks_list[list_index]->get_hash();
+			}
+
+			ACL_ASSERT(false, "Clip hash not found");
+			return clip_hash;
+		}
 	}
 
 	inline error_result build_database(iallocator& allocator, const compression_database_settings& settings,
 		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
 		compressed_tracks** out_compressed_tracks, compressed_database*& out_database)
+	{
+		return build_database(allocator, settings, compressed_tracks_list, nullptr, num_compressed_tracks, out_compressed_tracks, out_database);
+	}
+
+	inline error_result build_database(iallocator& allocator, const compression_database_settings& settings,
+		const compressed_tracks* const* compressed_tracks_list, const uint32_t* clip_group_ids, uint32_t num_compressed_tracks,
+		compressed_tracks** out_compressed_tracks, compressed_database*& out_database)
 	{
 		using namespace acl_impl;
 
@@ -1310,7 +1384,7 @@ namespace acl
 		// Non-movable frames end up being high importance and remain in the compressed clip
 		const uint32_t num_high_importance_frames = num_frames - num_medium_importance_frames - num_low_importance_frames;
 
-		frame_assignment_context context(allocator, compressed_tracks_list, num_compressed_tracks, num_movable_frames);
+		frame_assignment_context context(allocator, compressed_tracks_list, clip_group_ids, num_compressed_tracks, num_movable_frames);
 		context.set_tier_num_frames(quality_tier::highest_importance, num_high_importance_frames);
 		context.set_tier_num_frames(quality_tier::medium_importance, num_medium_importance_frames);
 		context.set_tier_num_frames(quality_tier::lowest_importance, num_low_importance_frames);
@@ -1525,6 +1599,260 @@ namespace acl
 		return error_result();
 	}
 
+	inline error_result merge_databases(iallocator& allocator, const compressed_database& database0, const compressed_database& database1,
+		const compressed_tracks* const* db1_compressed_tracks_list, uint32_t num_db1_compressed_tracks,
+		compressed_tracks** out_db1_compressed_tracks, compressed_database*& out_merged_database)
+	{
+		using namespace acl_impl;
+
+		// Reset everything just to be safe
+		if (out_db1_compressed_tracks != nullptr)
+		{
+			for (uint32_t list_index = 0; list_index < num_db1_compressed_tracks; ++list_index)
+				out_db1_compressed_tracks[list_index] = nullptr;
+		}
+		out_merged_database = nullptr;
+
+		// Validate everything and early out if something isn't right
+		error_result result = database0.is_valid(true);
+		if (result.any())
+			return result;
+
+		result = database1.is_valid(true);
+		if (result.any())
+			return result;
+
+		if (!database0.is_bulk_data_inline() || !database1.is_bulk_data_inline())
+			return error_result("Bulk data is not inline in source database");
+
+		if (database0.get_version() != database1.get_version())
+			return error_result("Cannot merge databases with different versions");
+
+		const database_header& header0 = get_database_header(database0);
+		const database_header& header1 = get_database_header(database1);
+
+		if (db1_compressed_tracks_list == nullptr || out_db1_compressed_tracks == nullptr || num_db1_compressed_tracks != header1.num_clips)
+			return error_result("Every compressed track instance bound to the second database must be provided");
+
+		for (uint32_t list_index = 0; list_index < num_db1_compressed_tracks; ++list_index)
+		{
+			const compressed_tracks* tracks = db1_compressed_tracks_list[list_index];
+			if (tracks == nullptr)
+				return error_result("Compressed track list contains a null entry");
+
+			const error_result tracks_result = tracks->is_valid(false);
+			if (tracks_result.any())
+				return error_result("Compressed track instance is invalid");
+
+			if (!database1.contains(*tracks))
+				return error_result("Compressed track instance is not bound to the second database");
+		}
+
+		// The runtime headers of the second database follow those of the first
+		const uint32_t clip_header_offset_delta = calculate_runtime_headers_size(header0);
+
+		// Rebind our compressed tracks first, we need their new hash
+		for (uint32_t list_index = 0; list_index < num_db1_compressed_tracks; ++list_index)
+			out_db1_compressed_tracks[list_index] = rebind_compressed_tracks(allocator, *db1_compressed_tracks_list[list_index], clip_header_offset_delta);
+
+		// The bulk data of the second database follows that of the first, for every tier
+		// Chunks from the first database retain their offsets
+		uint32_t num_chunks[k_num_database_tiers];
+		uint32_t bulk_data_offset1[k_num_database_tiers];
+		uint32_t bulk_data_size[k_num_database_tiers];
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			num_chunks[tier_index] = header0.num_chunks[tier_index] + header1.num_chunks[tier_index];
+
+			if (header1.bulk_data_size[tier_index] != 0)
+				bulk_data_offset1[tier_index] = align_to(header0.bulk_data_size[tier_index], k_database_bulk_data_alignment);
+			else
+				bulk_data_offset1[tier_index] = header0.bulk_data_size[tier_index];
+
+			bulk_data_size[tier_index] = bulk_data_offset1[tier_index] + header1.bulk_data_size[tier_index];
+		}
+
+		// Pad medium tier bulk data to ensure alignment since the lowest tier follows
+		bulk_data_size[0] = align_to(bulk_data_size[0], k_database_bulk_data_alignment);
+
+		const uint32_t num_clips = header0.num_clips + header1.num_clips;
+
+		uint32_t database_buffer_size = 0;
+		database_buffer_size += sizeof(raw_buffer_header);										// Header
+		database_buffer_size += sizeof(database_header);										// Header
+
+		database_buffer_size = align_to(database_buffer_size, 4);								// Align chunk descriptions
+		database_buffer_size += num_chunks[0] * sizeof(database_chunk_description);				// Chunk descriptions
+
+		database_buffer_size = align_to(database_buffer_size, 4);								// Align chunk descriptions
+		database_buffer_size += num_chunks[1] * sizeof(database_chunk_description);				// Chunk descriptions
+
+		database_buffer_size = align_to(database_buffer_size, 4);								// Align clip hashes
+		database_buffer_size += num_clips * sizeof(database_clip_metadata);						// Clip metadata
+
+		database_buffer_size = align_to(database_buffer_size, k_database_bulk_data_alignment);	// Align bulk data
+		database_buffer_size += bulk_data_size[0];												// Bulk data
+		database_buffer_size += bulk_data_size[1];												// Bulk data
+
+		// Allocate and setup our new database
+		uint8_t* database_buffer = allocate_type_array_aligned<uint8_t>(allocator, database_buffer_size, alignof(compressed_database));
+		std::memset(database_buffer, 0, database_buffer_size);
+		out_merged_database = bit_cast<compressed_database*>(database_buffer);
+
+		raw_buffer_header* database_buffer_header = safe_ptr_cast<raw_buffer_header>(database_buffer);
+		database_buffer += sizeof(raw_buffer_header);
+
+		const uint8_t* db_header_start = database_buffer;
+		database_header* db_header = safe_ptr_cast<database_header>(database_buffer);
+		database_buffer += sizeof(database_header);
+
+		// Copy our header and update the parts that change
+		std::memcpy(db_header, &header0, sizeof(database_header));
+
+		db_header->num_chunks[0] = num_chunks[0];
+		db_header->num_chunks[1] = num_chunks[1];
+		db_header->max_chunk_size = std::max<uint32_t>(header0.max_chunk_size, header1.max_chunk_size);
+		db_header->num_clips = num_clips;
+		db_header->num_segments = header0.num_segments + header1.num_segments;
+		db_header->bulk_data_size[0] = bulk_data_size[0];
+		db_header->bulk_data_size[1] = bulk_data_size[1];
+
+		database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
+		database_buffer += num_chunks[0] * sizeof(database_chunk_description);				// Chunk descriptions
+
+		database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
+		database_buffer += num_chunks[1] * sizeof(database_chunk_description);				// Chunk descriptions
+
+		database_buffer = align_to(database_buffer, 4);										// Align clip hashes
+		db_header->clip_metadata_offset = uint32_t(database_buffer - db_header_start);		// Clip metadata
+		database_buffer += num_clips * sizeof(database_clip_metadata);						// Clip metadata
+
+		database_buffer = align_to(database_buffer, k_database_bulk_data_alignment);		// Align bulk data
+		if (bulk_data_size[0] != 0)
+			db_header->bulk_data_offset[0] = uint32_t(database_buffer - db_header_start);	// Bulk data
+		else
+			db_header->bulk_data_offset[0] = invalid_ptr_offset();
+		database_buffer += bulk_data_size[0];												// Bulk data
+
+		if (bulk_data_size[1] != 0)
+			db_header->bulk_data_offset[1] = uint32_t(database_buffer - db_header_start);	// Bulk data
+		else
+			db_header->bulk_data_offset[1] = invalid_ptr_offset();
+		database_buffer += bulk_data_size[1];												// Bulk data
+
+		// Copy our clip metadata, the first database is unchanged and the second follows with its new hashes and offsets
+		const database_clip_metadata* clip_metadatas1 = header1.get_clip_metadatas();
+		database_clip_metadata* clip_metadatas = db_header->get_clip_metadatas();
+		std::memcpy(clip_metadatas, header0.get_clip_metadatas(), header0.num_clips * sizeof(database_clip_metadata));
+
+		for (uint32_t clip_index = 0; clip_index < header1.num_clips; ++clip_index)
+		{
+			database_clip_metadata& clip_metadata = clip_metadatas[header0.num_clips + clip_index];
+			clip_metadata.clip_hash = find_rebound_clip_hash(clip_metadatas1[clip_index].clip_hash, db1_compressed_tracks_list, out_db1_compressed_tracks, num_db1_compressed_tracks);
+			clip_metadata.clip_header_offset = uint32_t(clip_metadatas1[clip_index].clip_header_offset) + clip_header_offset_delta;
+		}
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			const quality_tier tier = tier_index == 0 ? quality_tier::medium_importance : quality_tier::lowest_importance;
+
+			const database_chunk_description* chunk_descriptions0 = tier_index == 0 ? header0.get_chunk_descriptions_medium() : header0.get_chunk_descriptions_low();
+			const database_chunk_description* chunk_descriptions1 = tier_index == 0 ? header1.get_chunk_descriptions_medium() : header1.get_chunk_descriptions_low();
+			database_chunk_description* chunk_descriptions = tier_index == 0 ? db_header->get_chunk_descriptions_medium() : db_header->get_chunk_descriptions_low();
+			uint8_t* bulk_data = tier_index == 0 ? db_header->get_bulk_data_medium() : db_header->get_bulk_data_low();
+
+			// Copy our chunk descriptions, the chunks of the first database do not move
+			std::memcpy(chunk_descriptions, chunk_descriptions0, header0.num_chunks[tier_index] * sizeof(database_chunk_description));
+
+			for (uint32_t chunk_index = 0; chunk_index < header1.num_chunks[tier_index]; ++chunk_index)
+			{
+				database_chunk_description& chunk_description = chunk_descriptions[header0.num_chunks[tier_index] + chunk_index];
+				chunk_description.size = chunk_descriptions1[chunk_index].size;
+				chunk_description.offset = uint32_t(chunk_descriptions1[chunk_index].offset) + bulk_data_offset1[tier_index];
+			}
+
+			// Copy our bulk data, the bulk data of the first database is unchanged
+			if (header0.bulk_data_size[tier_index] != 0)
+				std::memcpy(bulk_data, database0.get_bulk_data(tier), header0.bulk_data_size[tier_index]);
+
+			if (header1.bulk_data_size[tier_index] != 0)
+				std::memcpy(bulk_data + bulk_data_offset1[tier_index], database1.get_bulk_data(tier), header1.bulk_data_size[tier_index]);
+
+			// Update the chunks from our second database to point to their new location
+			for (uint32_t chunk_index = 0; chunk_index < header1.num_chunks[tier_index]; ++chunk_index)
+			{
+				const database_chunk_description& chunk_description = chunk_descriptions[header0.num_chunks[tier_index] + chunk_index];
+				database_chunk_header* chunk_header = chunk_description.get_chunk_header(bulk_data);
+				ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
+
+				chunk_header->index = header0.num_chunks[tier_index] + chunk_index;
+
+				database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
+				const uint32_t num_segments = chunk_header->num_segments;
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
+					chunk_segment_header.clip_hash = find_rebound_clip_hash(chunk_segment_header.clip_hash, db1_compressed_tracks_list, out_db1_compressed_tracks, num_db1_compressed_tracks);
+					chunk_segment_header.samples_offset = uint32_t(chunk_segment_header.samples_offset) + bulk_data_offset1[tier_index];
+					chunk_segment_header.clip_header_offset = uint32_t(chunk_segment_header.clip_header_offset) + clip_header_offset_delta;
+					chunk_segment_header.segment_header_offset = uint32_t(chunk_segment_header.segment_header_offset) + clip_header_offset_delta;
+				}
+			}
+
+			db_header->bulk_data_hash[tier_index] = hash32(bulk_data, bulk_data_size[tier_index]);
+		}
+
+		database_buffer_header->size = database_buffer_size;
+		database_buffer_header->hash = hash32(safe_ptr_cast<const uint8_t>(db_header), database_buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+		ACL_ASSERT(out_merged_database->is_valid(true).empty(), "Failed to merge databases");
+
+		return error_result();
+	}
+
+	inline error_result append_to_database(iallocator& allocator, const compression_database_settings& settings, const compressed_database& database,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		compressed_tracks** out_compressed_tracks, compressed_database*& out_database)
+	{
+		using namespace acl_impl;
+
+		// Reset everything just to be safe
+		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			out_compressed_tracks[list_index] = nullptr;
+		out_database = nullptr;
+
+		const error_result result = database.is_valid(true);
+		if (result.any())
+			return result;
+
+		if (!database.is_bulk_data_inline())
+			return error_result("Bulk data is not inline in source database");
+
+		if (compressed_tracks_list == nullptr || num_compressed_tracks == 0)
+			return error_result("No compressed track list provided");
+
+		// Build a temporary database with our new clips, it will be appended to the source database
+		compressed_tracks** appended_tracks = allocate_type_array<compressed_tracks*>(allocator, num_compressed_tracks);
+		compressed_database* appended_database = nullptr;
+
+		error_result append_result = build_database(allocator, settings, compressed_tracks_list, num_compressed_tracks, appended_tracks, appended_database);
+		if (append_result.empty())
+			append_result = merge_databases(allocator, database, *appended_database, appended_tracks, num_compressed_tracks, out_compressed_tracks, out_database);
+
+		// Free our temporary data
+		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+		{
+			if (appended_tracks[list_index] != nullptr)
+				allocator.deallocate(appended_tracks[list_index], appended_tracks[list_index]->get_size());
+		}
+
+		if (appended_database != nullptr)
+			allocator.deallocate(appended_database, appended_database->get_size());
+
+		deallocate_type_array(allocator, appended_tracks, num_compressed_tracks);
+
+		return append_result;
+	}
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
@@ -33,10 +33,13 @@
 #include "acl/core/error_result.h"
 #include "acl/core/floating_point_exceptions.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/profiling.h"
 #include "acl/compression/compression_settings.h"
 #include "acl/compression/output_stats.h"
 #include "acl/compression/track_array.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -49,6 +52,8 @@ namespace acl
 	{
 		using namespace acl_impl;
 
+		ACL_PROFILE_SCOPE("acl::compress_track_list");
+
 		error_result result = track_list.is_valid();
 		if (result.any())
 			return result;
@@ -69,6 +74,8 @@ namespace acl
 	{
 		using namespace acl_impl;
 
+		ACL_PROFILE_SCOPE("acl::compress_track_list");
+
 		error_result result = track_list.is_valid();
 		if (result.any())
 			return result;
@@ -87,6 +94,64 @@ namespace acl
 		return compress_transform_track_list(allocator, track_list, settings, &additive_base_track_list, additive_format, out_compressed_tracks, out_stats);
 	}
 
+	inline size_t estimate_compression_peak_memory(const compression_settings& settings, uint32_t num_transforms, uint32_t num_samples_per_track, bool has_scale, uint32_t num_additive_base_samples)
+	{
+		using namespace acl_impl;
+
+		if (num_transforms == 0 || num_samples_per_track == 0)
+			return 0;
+
+		// Every clip context stores its samples with full precision for every sub-track along with some per transform data
+		constexpr size_t k_num_sub_tracks_allocated = 3;
+		const size_t per_transform_size = sizeof(transform_streams) + sizeof(transform_metadata) + sizeof(transform_range) + sizeof(uint32_t);
+		const size_t samples_size = size_t(num_transforms) * k_num_sub_tracks_allocated * sizeof(rtm::vector4f) * num_samples_per_track;
+		const size_t clip_context_size = size_t(num_transforms) * per_transform_size + samples_size;
+
+		// We have a raw and a lossy clip context, and optionally one for the additive base
+		size_t clip_contexts_size = clip_context_size * 2;
+		if (num_additive_base_samples != 0)
+			clip_contexts_size += size_t(num_transforms) * per_transform_size + size_t(num_transforms) * k_num_sub_tracks_allocated * sizeof(rtm::vector4f) * num_additive_base_samples;
+
+		// Segmenting duplicates the lossy samples before releasing the original clip segment
+		const size_t segmenting_size = samples_size;
+
+		// Bit rate optimization works on one segment at a time
+		size_t bit_rate_optimization_size = 0;
+		const bool is_any_variable = is_rotation_format_variable(settings.rotation_format) || is_vector_format_variable(settings.translation_format) || is_vector_format_variable(settings.scale_format);
+		if (is_any_variable)
+		{
+			compression_segmenting_settings segmenting_settings;
+			const uint32_t num_segment_samples = std::min<uint32_t>(num_samples_per_track, segmenting_settings.max_num_samples);
+			const size_t metric_transform_size = settings.error_metric != nullptr ? settings.error_metric->get_transform_size(has_scale) : sizeof(rtm::qvvf);
+
+			// Raw local and object space transforms along with our cached lossy object space transforms
+			// and the base local and object space transforms with an additive base
+			const size_t num_cached_poses = num_additive_base_samples != 0 ? 5 : 3;
+			const size_t cached_transforms_size = num_cached_poses * metric_transform_size * num_transforms * num_segment_samples;
+
+			const uint32_t num_sub_tracks_per_transform = has_scale ? 3 : 2;
+			const uint32_t num_bit_rates_cached = calculate_num_bit_rates_cached_per_track(settings.num_bit_rates_cached_per_track, settings.level, num_transforms, num_segment_samples, has_scale);
+			const size_t track_size = align_to<size_t>(sizeof(rtm::vector4f) * num_segment_samples, 64);
+			const size_t bit_rate_database_size = size_t(num_bit_rates_cached) * num_transforms * num_sub_tracks_per_transform * track_size;
+
+			// Each quantization context also holds a few poses and bit rates per transform, and the bookkeeping
+			// of its cached lossy object space transforms
+			const size_t per_transform_context_size = 6 * sizeof(rtm::qvvf) + 2 * metric_transform_size + sizeof(rigid_shell_metadata_t) + 3 * sizeof(transform_bit_rates) + 5 * sizeof(uint32_t);
+			const size_t context_size = sizeof(quantization_context) + per_transform_context_size * num_transforms;
+
+			// Every worker thread has its own quantization context and permutation bit rates
+			// The permutations of the bone chain being optimized are shared and grow with the compression level, they aren't included
+			const uint32_t num_threads = get_num_bit_rate_optimization_threads(settings);
+			const size_t worker_size = context_size + cached_transforms_size + bit_rate_database_size + sizeof(transform_bit_rates) * num_transforms;
+			bit_rate_optimization_size = worker_size * num_threads;
+		}
+
+		// The compressed tracks are never larger than the raw samples along with their metadata
+		const size_t output_size = samples_size + size_t(num_transforms) * per_transform_size;
+
+		return clip_contexts_size + std::max<size_t>(std::max<size_t>(segmenting_size, bit_rate_optimization_size), output_size);
+	}
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
@@ -33,6 +33,7 @@
 #include "acl/core/error.h"
 #include "acl/core/error_result.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/profiling.h"
 #include "acl/core/scope_profiler.h"
 #include "acl/core/impl/bit_cast.impl.h"
 #include "acl/compression/compression_settings.h"
@@ -40,9 +41,15 @@
 #include "acl/compression/track_array.h"
 #include "acl/compression/impl/track_list_context.h"
 #include "acl/compression/impl/compact.scalar.h"
+#include "acl/compression/impl/double_precision.scalar.h"
+#include "acl/compression/impl/decimate.scalar.h"
 #include "acl/compression/impl/normalize.scalar.h"
 #include "acl/compression/impl/optimize_looping.scalar.h"
 #include "acl/compression/impl/quantize.scalar.h"
+#include "acl/compression/impl/rotation.scalar.h"
+#include "acl/compression/impl/segment.scalar.h"
+#include "acl/compression/impl/spline.scalar.h"
+#include "acl/compression/impl/sparse.scalar.h"
 #include "acl/compression/impl/track_range_impl.h"
 #include "acl/compression/impl/write_compression_stats_impl.h"
 #include "acl/compression/impl/write_track_data_impl.h"
@@ -70,8 +77,37 @@ namespace acl
 			scope_profiler compression_time;
 #endif
 
+			if (settings.scalar_algorithm != algorithm_type8::uniformly_sampled && settings.scalar_algorithm != algorithm_type8::spline_key_reduction)
+				return error_result("Invalid scalar algorithm type");
+
+			// Spline keys replace our animated values, the other scalar features do not apply
+			const bool use_spline_keys = settings.scalar_algorithm == algorithm_type8::spline_key_reduction;
+
+			// Rotations drop their W component and are compressed as float3f tracks
+			const bool has_quatf_tracks = track_list.get_track_type() == track_type8::quatf;
+			if (has_quatf_tracks && use_spline_keys)
+				return error_result("Spline key reduction does not support quatf tracks");
+
+			// Double precision tracks are compressed as float deltas from a base value per track
+			const bool has_double_tracks = is_track_type_double_precision(track_list.get_track_type());
+
+			track_array packed_track_list;
+			double* track_base_values = nullptr;
+			if (has_quatf_tracks)
+				packed_track_list = pack_quatf_track_list(allocator, track_list);
+			else if (has_double_tracks)
+			{
+				track_base_values = allocate_type_array<double>(allocator, size_t(track_list.get_num_tracks()) * k_num_base_values_per_track);
+				packed_track_list = pack_double_track_list(allocator, track_list, track_base_values);
+			}
+
 			track_list_context context;
-			if (!initialize_context(allocator, track_list, context))
+			const bool are_samples_valid = initialize_context(allocator, has_quatf_tracks || has_double_tracks ? packed_track_list : track_list, context);
+
+			context.has_quatf_tracks = has_quatf_tracks;
+			context.track_base_values = track_base_values;	// The context owns them now
+
+			if (!are_samples_valid)
 				return error_result("Some samples are not finite");
 
 			// Wrap instead of clamp if we loop
@@ -83,19 +119,47 @@ namespace acl
 			// Compact and collapse the constant tracks
 			extract_constant_tracks(context);
 
+			// Detect the tracks that are inactive most of the time and split them into active spans
+			// Rotations measure their error as an angle which sparse and decimated tracks do not support
+			extract_sparse_tracks(context, settings.enable_scalar_sparse_tracks && !use_spline_keys && !has_quatf_tracks);
+
+			// Detect the tracks that can be stored at a lower sample rate
+			extract_decimated_tracks(context, settings.enable_scalar_decimation && !use_spline_keys && !has_quatf_tracks);
+
 			// Normalize our samples into the track wide ranges per track
 			normalize_tracks(context);
 
-			// Find how many bits we need per track and quantize everything
-			quantize_tracks(context);
+			if (use_spline_keys)
+			{
+				// Place a variable number of keys per track through curve fitting
+				fit_spline_keys(context);
+			}
+			else
+			{
+				// Split our samples into segments and normalize them again within each segment
+				segment_tracks(context, settings.enable_scalar_segmenting);
+				extract_segment_ranges(context);
+				normalize_segments(context);
+
+				// Find how many bits we need per track and quantize everything
+				quantize_tracks(context, settings.enable_scalar_track_grouping);
+				quantize_sparse_tracks(context);
+			}
 
 			// Done transforming our input tracks, time to pack them into their final form
+			ACL_PROFILE_SCOPE("acl::output_packing");
+
 			const uint32_t per_track_metadata_size = write_track_metadata(context, nullptr);
+			const uint32_t track_offsets_size = settings.enable_scalar_track_offsets ? write_track_offsets(context, nullptr) : 0;
+			const uint32_t segment_table_size = write_segment_table(context, nullptr);
+			const uint32_t decimated_track_data_size = write_decimated_track_data(context, nullptr);
+			const uint32_t sparse_track_data_size = write_sparse_track_data(context, nullptr);
+			const uint32_t base_values_size = has_double_tracks ? write_track_base_values(context, nullptr) : 0;
 			const uint32_t constant_values_size = write_track_constant_values(context, nullptr);
 			const uint32_t range_values_size = write_track_range_values(context, nullptr);
-			const uint32_t animated_num_bits = write_track_animated_values(context, nullptr);
-			const uint32_t animated_values_size = (animated_num_bits + 7) / 8;		// Round up to nearest byte
-			const uint32_t num_bits_per_frame = context.num_samples != 0 ? (animated_num_bits / context.num_samples) : 0;
+			const uint32_t animated_num_bits = use_spline_keys ? 0 : write_track_animated_values(context, nullptr);
+			const uint32_t animated_values_size = use_spline_keys ? write_spline_key_blocks(context, track_offsets_size != 0, nullptr) : ((animated_num_bits + 7) / 8);		// Round up to nearest byte
+			const uint32_t num_bits_per_frame = context.num_samples != 0 && !use_spline_keys ? calculate_num_bits_per_frame(context) : 0;
 
 			uint32_t buffer_size = 0;
 			buffer_size += sizeof(raw_buffer_header);								// Header
@@ -103,7 +167,17 @@ namespace acl
 			buffer_size += sizeof(scalar_tracks_header);							// Header
 			ACL_ASSERT(is_aligned_to(buffer_size, alignof(track_metadata)), "Invalid alignment");
 			buffer_size += per_track_metadata_size;									// Per track metadata
-			buffer_size = align_to(buffer_size, 4);									// Align constant values
+			buffer_size = align_to(buffer_size, 4);									// Align track offsets
+			buffer_size += track_offsets_size;										// Track offsets
+			buffer_size += segment_table_size;										// Segment table
+			buffer_size += decimated_track_data_size;								// Decimated track data
+			buffer_size += sparse_track_data_size;									// Sparse track data
+			if (base_values_size != 0)
+			{
+				buffer_size = align_to(buffer_size, alignof(double));				// Align base values
+				buffer_size += base_values_size;									// Base values
+			}
+			ACL_ASSERT(is_aligned_to(buffer_size, 4), "Invalid alignment");
 			buffer_size += constant_values_size;									// Constant values
 			ACL_ASSERT(is_aligned_to(buffer_size, 4), "Invalid alignment");
 			buffer_size += range_values_size;										// Range values
@@ -149,13 +223,17 @@ namespace acl
 			// Write our primary header
 			header->tag = static_cast<uint32_t>(buffer_tag32::compressed_tracks);
 			header->version = compressed_tracks_version16::latest;
-			header->algorithm_type = algorithm_type8::uniformly_sampled;
+			header->algorithm_type = settings.scalar_algorithm;
 			header->track_type = track_list.get_track_type();
 			header->num_tracks = context.num_output_tracks;
 			header->num_samples = context.num_output_tracks != 0 ? context.num_samples : 0;
 			header->sample_rate = context.num_output_tracks != 0 ? context.sample_rate : 0.0F;
 			header->set_is_wrap_optimized(context.looping_policy == sample_looping_policy::wrap);
 			header->set_has_metadata(metadata_size != 0);
+			header->set_has_track_offsets(track_offsets_size != 0);
+			header->set_has_segments(segment_table_size != 0);
+			header->set_has_sparse_tracks(sparse_track_data_size != 0);
+			header->set_has_decimated_tracks(decimated_track_data_size != 0);
 
 			// Write our scalar tracks header
 			scalar_tracks_header* scalars_header = safe_ptr_cast<scalar_tracks_header>(buffer);
@@ -167,6 +245,15 @@ namespace acl
 			scalars_header->metadata_per_track = uint32_t(buffer - packed_data_start_offset);
 			buffer += per_track_metadata_size;
 			buffer = align_to(buffer, 4);
+			buffer += track_offsets_size;
+			buffer += segment_table_size;
+			buffer += decimated_track_data_size;
+			buffer += sparse_track_data_size;
+			if (base_values_size != 0)
+			{
+				buffer = align_to(buffer, alignof(double));
+				buffer += base_values_size;
+			}
 			scalars_header->track_constant_values = uint32_t(buffer - packed_data_start_offset);
 			buffer += constant_values_size;
 			scalars_header->track_range_values = uint32_t(buffer - packed_data_start_offset);
@@ -192,6 +279,36 @@ namespace acl
 			track_metadata* per_track_metadata = scalars_header->get_track_metadata();
 			write_track_metadata(context, per_track_metadata);
 
+			if (track_offsets_size != 0)
+			{
+				scalar_track_offsets* track_offsets = scalars_header->get_track_offsets(header->num_tracks);
+				write_track_offsets(context, track_offsets);
+			}
+
+			if (segment_table_size != 0)
+			{
+				uint32_t* segment_table = scalars_header->get_segment_table(header->num_tracks, track_offsets_size != 0);
+				write_segment_table(context, segment_table);
+			}
+
+			if (decimated_track_data_size != 0)
+			{
+				uint8_t* decimated_track_data = scalars_header->get_decimated_track_data(header->num_tracks, track_offsets_size != 0, segment_table_size != 0);
+				write_decimated_track_data(context, decimated_track_data);
+			}
+
+			if (sparse_track_data_size != 0)
+			{
+				uint8_t* sparse_track_data = scalars_header->get_sparse_track_data(header->num_tracks, track_offsets_size != 0, segment_table_size != 0, decimated_track_data_size != 0);
+				write_sparse_track_data(context, sparse_track_data);
+			}
+
+			if (base_values_size != 0)
+			{
+				double* base_values = scalars_header->get_track_base_values(header->num_tracks, get_track_num_sample_elements(header->track_type));
+				write_track_base_values(context, base_values);
+			}
+
 			float* constant_values = scalars_header->get_track_constant_values();
 			write_track_constant_values(context, constant_values);
 
@@ -199,7 +316,10 @@ namespace acl
 			write_track_range_values(context, range_values);
 
 			uint8_t* animated_values = scalars_header->get_track_animated_values();
-			write_track_animated_values(context, animated_values);
+			if (use_spline_keys)
+				write_spline_key_blocks(context, track_offsets_size != 0, animated_values);
+			else
+				write_track_animated_values(context, animated_values);
 
 			// Optional metadata header is last
 			uint32_t writter_metadata_track_list_name_size = 0;
@@ -262,7 +382,7 @@ namespace acl
 			compression_time.stop();
 
 			if (out_stats.logging != stat_logging::none)
-				write_compression_stats(context, *out_compressed_tracks, compression_time, out_stats);
+				write_compression_stats(context, track_list, *out_compressed_tracks, compression_time, out_stats);
 #endif
 
 			return error_result();
@@ -34,7 +34,9 @@
 #include "acl/core/error_result.h"
 #include "acl/core/floating_point_exceptions.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/profiling.h"
 #include "acl/core/scope_profiler.h"
+#include "acl/core/tracking_allocator.h"
 #include "acl/core/impl/bit_cast.impl.h"
 #include "acl/compression/compression_settings.h"
 #include "acl/compression/output_stats.h"
@@ -135,7 +137,7 @@ namespace acl
 				return compression_level8::medium;
 		}
 
-		inline error_result compress_transform_track_list(iallocator& allocator, const track_array_qvvf& track_list, compression_settings settings,
+		inline error_result compress_transform_track_list(iallocator& user_allocator, const track_array_qvvf& track_list, compression_settings settings,
 			const track_array_qvvf* additive_base_track_list, additive_clip_format8 additive_format,
 			compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
 		{
@@ -147,8 +149,16 @@ namespace acl
 			(void)compression_stats;
 
 #if defined(ACL_USE_SJSON)
+			// Every allocation goes through our tracker to measure the memory usage of each stage
+			// The compressed tracks are allocated with the user allocator and can be freed with it
+			tracking_allocator allocator(user_allocator);
+			compression_stats.memory_tracker = &allocator;
+
 			scope_profiler compression_time;
 			scope_profiler initialization_time;
+			scope_stage_memory_tracker initialization_memory(compression_stats, compression_stats.initialization_memory);
+#else
+			iallocator& allocator = user_allocator;
 #endif
 
 			// Segmenting settings are an implementation detail
@@ -230,6 +240,7 @@ namespace acl
 
 #if defined(ACL_USE_SJSON)
 			compression_stats.initialization_elapsed_seconds = initialization_time.get_elapsed_seconds();
+			initialization_memory.stop();
 #endif
 
 			// Wrap instead of clamp if we loop
@@ -277,8 +288,11 @@ namespace acl
 			strip_keyframes(lossy_clip_context, settings, compression_stats);
 
 			// Compression is done! Time to pack things.
+			ACL_PROFILE_SCOPE("acl::output_packing");
+
 #if defined(ACL_USE_SJSON)
 			scope_profiler output_packing_time;
+			scope_stage_memory_tracker output_packing_memory(compression_stats, compression_stats.output_packing_memory);
 #endif
 
 			if (remove_contributing_error)
@@ -531,6 +545,7 @@ namespace acl
 
 #if defined(ACL_USE_SJSON)
 			compression_stats.output_packing_elapsed_seconds = output_packing_time.get_elapsed_seconds();
+			output_packing_memory.stop();
 #endif
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
@@ -592,6 +607,8 @@ namespace acl
 
 #if defined(ACL_USE_SJSON)
 			compression_stats.total_elapsed_seconds = compression_time.stop().get_elapsed_seconds();
+			compression_stats.peak_memory_size = allocator.get_peak_size();
+			compression_stats.num_allocations = allocator.get_num_allocations();
 
 			if (out_stats.logging != stat_logging::none)
 				write_stats(allocator, track_list, lossy_clip_context, *out_compressed_tracks, settings, segmenting_settings, range_reduction, raw_clip_context, additive_base_clip_context, compression_stats, out_stats);
@@ -127,6 +127,14 @@ namespace acl
 
 		hash_value = hash_combine(hash_value, enable_database_support);
 		hash_value = hash_combine(hash_value, optimize_loops);
+		hash_value = hash_combine(hash_value, hash32(scalar_algorithm));
+		hash_value = hash_combine(hash_value, enable_scalar_track_offsets);
+		hash_value = hash_combine(hash_value, enable_scalar_segmenting);
+		hash_value = hash_combine(hash_value, enable_scalar_track_grouping);
+		hash_value = hash_combine(hash_value, enable_scalar_sparse_tracks);
+		hash_value = hash_combine(hash_value, enable_scalar_decimation);
+		hash_value = hash_combine(hash_value, enable_byte_aligned_bit_rates);
+		hash_value = hash_combine(hash_value, hash32(byte_aligned_bit_rate_size_threshold));
 		hash_value = hash_combine(hash_value, keyframe_stripping.get_hash());
 		hash_value = hash_combine(hash_value, metadata.get_hash());
 
@@ -149,6 +157,18 @@ namespace acl
 		if (keyframe_stripping.is_enabled() && enable_database_support)
 			return error_result("Cannot enable keyframe stripping with database support");
 
+		if (!is_valid_algorithm_type(scalar_algorithm))
+			return error_result("Invalid scalar algorithm type");
+
+		if (!rtm::scalar_is_finite(byte_aligned_bit_rate_size_threshold) || byte_aligned_bit_rate_size_threshold < 0.0F)
+			return error_result("byte_aligned_bit_rate_size_threshold must be positive or zero");
+
+		if (num_bit_rates_cached_per_track > 8)
+			return error_result("num_bit_rates_cached_per_track must be in the range [0, 8]");
+
+		if (num_bit_rate_optimization_threads > 256)
+			return error_result("num_bit_rate_optimization_threads must be in the range [0, 256]");
+
 		return error_result();
 	}
 
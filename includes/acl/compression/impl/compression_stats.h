@@ -26,7 +26,9 @@
 
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/tracking_allocator.h"
 
+#include <cstddef>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -37,7 +39,18 @@ namespace acl
 
 	namespace acl_impl
 	{
-		// Holds compression timing stats for diagnostics
+		// Holds the memory stats of a compression stage
+		struct compression_stage_memory_stats_t
+		{
+			// Largest number of bytes live while the stage executed, including memory allocated by earlier stages
+			size_t peak_size = 0;
+
+			// Number of allocations and deallocations performed by the stage
+			uint32_t num_allocations = 0;
+			uint32_t num_deallocations = 0;
+		};
+
+		// Holds compression timing and memory stats for diagnostics
 		struct compression_stats_t
 		{
 #if defined(ACL_USE_SJSON)
@@ -57,8 +70,68 @@ namespace acl
 			double bit_rate_optimization_elapsed_seconds = 0.0;
 			double keyframe_stripping_elapsed_seconds = 0.0;
 			double output_packing_elapsed_seconds = 0.0;
+
+			// Tracks every allocation made during compression, optional
+			tracking_allocator* memory_tracker = nullptr;
+
+			// Total memory usage
+			size_t peak_memory_size = 0;
+			uint32_t num_allocations = 0;
+
+			// High level passes memory usage
+			compression_stage_memory_stats_t initialization_memory;
+			compression_stage_memory_stats_t convert_rotations_memory;
+			compression_stage_memory_stats_t extract_clip_ranges_memory;
+			compression_stage_memory_stats_t compact_constant_sub_tracks_memory;
+			compression_stage_memory_stats_t segmenting_memory;
+			compression_stage_memory_stats_t extract_segment_ranges_memory;
+			compression_stage_memory_stats_t bit_rate_optimization_memory;
+			compression_stage_memory_stats_t keyframe_stripping_memory;
+			compression_stage_memory_stats_t output_packing_memory;
+
+			// Largest number of bytes the per segment scratch arena used during the bit rate optimization, part of its stage peak
+			size_t bit_rate_optimization_scratch_high_water_mark = 0;
 #endif
 		};
+
+#if defined(ACL_USE_SJSON)
+		// Tracks the memory stats of a compression stage until stopped or until it goes out of scope
+		// Does nothing if the compression stats have no memory tracker
+		class scope_stage_memory_tracker
+		{
+		public:
+			scope_stage_memory_tracker(const compression_stats_t& compression_stats, compression_stage_memory_stats_t& out_stats)
+				: m_allocator(compression_stats.memory_tracker)
+				, m_stats(out_stats)
+			{
+				if (m_allocator != nullptr)
+					m_allocator->begin_scope();
+			}
+
+			~scope_stage_memory_tracker()
+			{
+				stop();
+			}
+
+			void stop()
+			{
+				if (m_allocator == nullptr)
+					return;
+
+				m_stats.peak_size = m_allocator->get_scope_peak_size();
+				m_stats.num_allocations = m_allocator->get_scope_num_allocations();
+				m_stats.num_deallocations = m_allocator->get_scope_num_deallocations();
+				m_allocator = nullptr;
+			}
+
+		private:
+			scope_stage_memory_tracker(const scope_stage_memory_tracker&) = delete;
+			scope_stage_memory_tracker& operator=(const scope_stage_memory_tracker&) = delete;
+
+			tracking_allocator* m_allocator;
+			compression_stage_memory_stats_t& m_stats;
+		};
+#endif
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -124,6 +124,30 @@ namespace acl
 				got_description = tracks.get_track_description(track_index, desc_scalar);
 				track_ = track_vector4f::make_reserve(desc_scalar, allocator, num_samples, sample_rate);
 				break;
+			case track_type8::quatf:
+				got_description = tracks.get_track_description(track_index, desc_scalar);
+				track_ = track_quatf::make_reserve(desc_scalar, allocator, num_samples, sample_rate);
+				break;
+			case track_type8::float1d:
+				got_description = tracks.get_track_description(track_index, desc_scalar);
+				track_ = track_float1d::make_reserve(desc_scalar, allocator, num_samples, sample_rate);
+				break;
+			case track_type8::float2d:
+				got_description = tracks.get_track_description(track_index, desc_scalar);
+				track_ = track_float2d::make_reserve(desc_scalar, allocator, num_samples, sample_rate);
+				break;
+			case track_type8::float3d:
+				got_description = tracks.get_track_description(track_index, desc_scalar);
+				track_ = track_float3d::make_reserve(desc_scalar, allocator, num_samples, sample_rate);
+				break;
+			case track_type8::float4d:
+				got_description = tracks.get_track_description(track_index, desc_scalar);
+				track_ = track_float4d::make_reserve(desc_scalar, allocator, num_samples, sample_rate);
+				break;
+			case track_type8::vector4d:
+				got_description = tracks.get_track_description(track_index, desc_scalar);
+				track_ = track_vector4d::make_reserve(desc_scalar, allocator, num_samples, sample_rate);
+				break;
 			case track_type8::qvvf:
 				got_description = tracks.get_track_description(track_index, desc_transform);
 				track_ = track_qvvf::make_reserve(desc_transform, allocator, num_samples, sample_rate);
@@ -188,6 +212,24 @@ namespace acl
 					case track_type8::vector4f:
 						*acl_impl::bit_cast<rtm::vector4f*>(track_[sample_index]) = writer.read_vector4(track_index);
 						break;
+					case track_type8::quatf:
+						*acl_impl::bit_cast<rtm::quatf*>(track_[sample_index]) = writer.read_quat(track_index);
+						break;
+					case track_type8::float1d:
+						*acl_impl::bit_cast<double*>(track_[sample_index]) = writer.read_float1d(track_index);
+						break;
+					case track_type8::float2d:
+						rtm::vector_store2(writer.read_float2d(track_index), acl_impl::bit_cast<rtm::float2d*>(track_[sample_index]));
+						break;
+					case track_type8::float3d:
+						rtm::vector_store3(writer.read_float3d(track_index), acl_impl::bit_cast<rtm::float3d*>(track_[sample_index]));
+						break;
+					case track_type8::float4d:
+						rtm::vector_store(writer.read_float4d(track_index), acl_impl::bit_cast<rtm::float4d*>(track_[sample_index]));
+						break;
+					case track_type8::vector4d:
+						*acl_impl::bit_cast<rtm::vector4d*>(track_[sample_index]) = writer.read_vector4d(track_index);
+						break;
 					case track_type8::qvvf:
 						*acl_impl::bit_cast<rtm::qvvf*>(track_[sample_index]) = writer.read_qvv(track_index);
 						break;
@@ -238,6 +280,24 @@ namespace acl
 					case track_type8::vector4f:
 						*acl_impl::bit_cast<rtm::vector4f*>(track_[sample_index]) = writer.read_vector4(track_index);
 						break;
+					case track_type8::quatf:
+						*acl_impl::bit_cast<rtm::quatf*>(track_[sample_index]) = writer.read_quat(track_index);
+						break;
+					case track_type8::float1d:
+						*acl_impl::bit_cast<double*>(track_[sample_index]) = writer.read_float1d(track_index);
+						break;
+					case track_type8::float2d:
+						rtm::vector_store2(writer.read_float2d(track_index), acl_impl::bit_cast<rtm::float2d*>(track_[sample_index]));
+						break;
+					case track_type8::float3d:
+						rtm::vector_store3(writer.read_float3d(track_index), acl_impl::bit_cast<rtm::float3d*>(track_[sample_index]));
+						break;
+					case track_type8::float4d:
+						rtm::vector_store(writer.read_float4d(track_index), acl_impl::bit_cast<rtm::float4d*>(track_[sample_index]));
+						break;
+					case track_type8::vector4d:
+						*acl_impl::bit_cast<rtm::vector4d*>(track_[sample_index]) = writer.read_vector4d(track_index);
+						break;
 					case track_type8::qvvf:
 						*acl_impl::bit_cast<rtm::qvvf*>(track_[sample_index]) = writer.read_qvv(track_index);
 						break;
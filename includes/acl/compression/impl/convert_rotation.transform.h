@@ -30,6 +30,7 @@
 #include "acl/core/error.h"
 #include "acl/core/scope_profiler.h"
 #include "acl/core/track_formats.h"
+#include "acl/core/profiling.h"
 #include "acl/compression/impl/clip_context.h"
 #include "acl/compression/impl/compression_stats.h"
 
@@ -113,10 +114,13 @@ namespace acl
 			rotation_format8 rotation_format,
 			compression_stats_t& compression_stats)
 		{
+			ACL_PROFILE_SCOPE("acl::convert_rotation_streams");
+
 			(void)compression_stats;
 
 #if defined(ACL_USE_SJSON)
 			scope_profiler convert_rotations_time;
+			scope_stage_memory_tracker convert_rotations_memory(compression_stats, compression_stats.convert_rotations_memory);
 #endif
 
 			for (segment_context& segment : context.segment_iterator())
@@ -0,0 +1,269 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/bitset.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/profiling.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/core/impl/decimated_track_utils.h"
+#include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/impl/quantize.scalar.h"
+#include "acl/compression/impl/track_list_context.h"
+
+#include <rtm/mask4f.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		inline rtm::vector4f RTM_SIMD_CALL get_decimated_raw_sample(const track& ref_track, uint32_t num_samples, uint32_t decimation_shift, uint32_t decimated_index)
+		{
+			const uint32_t sample_index = std::min<uint32_t>(decimated_index << decimation_shift, num_samples - 1);
+
+			rtm::vector4f raw_sample = rtm::vector_zero();
+			std::memcpy(&raw_sample, ref_track[sample_index], ref_track.get_sample_size());
+			return raw_sample;
+		}
+
+		inline rtm::vector4f RTM_SIMD_CALL normalize_decimated_sample(rtm::vector4f_arg0 raw_sample, rtm::vector4f_arg1 range_min, rtm::vector4f_arg2 range_extent)
+		{
+			using namespace rtm;
+
+			const mask4f is_range_zero_mask = vector_less_than(range_extent, rtm::vector_set(0.000000001F));
+
+			vector4f normalized_sample = vector_div(vector_sub(raw_sample, range_min), range_extent);
+
+			// Clamp because the division might be imprecise
+			normalized_sample = vector_clamp(normalized_sample, vector_zero(), rtm::vector_set(1.0F));
+			return vector_select(is_range_zero_mask, vector_zero(), normalized_sample);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not every sample of a track is within our precision once the
+		// retained samples are quantized at the specified bit rate and interpolated.
+		// 'decoded_samples' is scratch memory with room for every retained sample.
+		//////////////////////////////////////////////////////////////////////////
+		inline bool is_decimated_track_accurate(const track& ref_track, uint32_t decimation_shift, uint8_t bit_rate, rtm::vector4f_arg0 range_min, rtm::vector4f_arg1 range_extent, rtm::vector4f_arg2 precision, const rtm::mask4f& sample_mask, rtm::vector4f* decoded_samples)
+		{
+			using namespace rtm;
+
+			const uint32_t num_samples = ref_track.get_num_samples();
+			const uint32_t num_decimated_samples = calculate_num_decimated_samples(num_samples, decimation_shift);
+
+			// Decode our retained samples the same way decompression does
+			for (uint32_t decimated_index = 0; decimated_index < num_decimated_samples; ++decimated_index)
+			{
+				const vector4f raw_sample = get_decimated_raw_sample(ref_track, num_samples, decimation_shift, decimated_index);
+
+				if (is_raw_bit_rate(bit_rate))
+					decoded_samples[decimated_index] = raw_sample;
+				else
+				{
+					const quantization_scales scales(get_num_bits_at_bit_rate(bit_rate));
+					const vector4f decayed_normalized_sample = decay_vector4_uXX(normalize_decimated_sample(raw_sample, range_min, range_extent), scales);
+					decoded_samples[decimated_index] = vector_mul_add(decayed_normalized_sample, range_extent, range_min);
+				}
+			}
+
+			const vector4f zero = vector_zero();
+			vector4f raw_sample = zero;
+
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				uint32_t decimated_index;
+				float decimated_alpha;
+				find_decimated_samples(num_samples, decimation_shift, sample_index, 0.0F, decimated_index, decimated_alpha);
+
+				const vector4f lossy_sample = vector_lerp(decoded_samples[decimated_index], decoded_samples[decimated_index + 1], decimated_alpha);
+
+				std::memcpy(&raw_sample, ref_track[sample_index], ref_track.get_sample_size());
+
+				const vector4f delta = vector_abs(vector_sub(raw_sample, lossy_sample));
+				const vector4f masked_delta = vector_select(sample_mask, delta, zero);
+				if (!vector_all_less_equal(masked_delta, precision))
+					return false;
+			}
+
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the lowest bit rate that keeps a track within our precision at the specified
+		// decimation shift or 'k_invalid_bit_rate' if even the raw samples are not accurate enough.
+		// Like with animated tracks, every bit rate above the one we find meets our precision.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint8_t find_decimated_track_bit_rate(const track& ref_track, uint32_t decimation_shift, rtm::vector4f_arg0 range_min, rtm::vector4f_arg1 range_extent, rtm::vector4f_arg2 precision, const rtm::mask4f& sample_mask, rtm::vector4f* decoded_samples)
+		{
+			uint8_t best_bit_rate = k_invalid_bit_rate;
+			for (uint8_t bit_rate = k_highest_bit_rate; bit_rate != 0; --bit_rate)	// Skip the constant bit rate
+			{
+				if (!is_decimated_track_accurate(ref_track, decimation_shift, bit_rate, range_min, range_extent, precision, sample_mask, decoded_samples))
+					break;	// Our error is too high, use the previous bit rate
+
+				best_bit_rate = bit_rate;
+			}
+
+			return best_bit_rate;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Detects animated tracks that can be stored at half or a quarter of our sample rate.
+		// Every decimation shift is tried and we retain the one that yields the smallest
+		// footprint, including when we keep every sample. Decimated tracks retain their own
+		// range and samples, they are neither segmented nor grouped.
+		//////////////////////////////////////////////////////////////////////////
+		inline void extract_decimated_tracks(track_list_context& context, bool enable_decimation)
+		{
+			ACL_PROFILE_SCOPE("acl::extract_decimated_tracks");
+
+			using namespace rtm;
+
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			const bitset_description bitset_desc = bitset_description::make_from_num_bits(context.num_tracks);
+			context.decimated_tracks_bitset = allocate_type_array<uint32_t>(*context.allocator, bitset_desc.get_size());
+			bitset_reset(context.decimated_tracks_bitset, bitset_desc, false);
+
+			// We need at least one sample in between the ones we retain
+			const uint32_t num_samples = context.num_samples;
+			if (!enable_decimation || num_samples < 3)
+				return;
+
+			context.decimated_tracks = allocate_type_array<decimated_track>(*context.allocator, context.num_tracks);
+
+			const uint32_t num_components = get_track_num_sample_elements(context.reference_list->get_track_type());
+			const uint32_t range_size_bits = num_components * 2 * 32;
+			const mask4f all_true_mask = mask_set(true, true, true, true);
+
+			vector4f* decoded_samples = allocate_type_array<vector4f>(*context.allocator, num_samples);
+
+			for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
+			{
+				if (context.is_constant(track_index) || context.is_sparse(track_index))
+					continue;
+
+				const track& ref_track = (*context.reference_list)[track_index];
+				const track_vector4f& mut_track = track_cast<track_vector4f>(context.track_list[track_index]);
+
+				const vector4f precision = vector_load1(&mut_track.get_description().precision);
+				mask4f sample_mask = mask_set(false, false, false, false);
+				std::memcpy(&sample_mask, &all_true_mask, ref_track.get_sample_size());
+
+				// Our range extraction happens before normalization, our clip range is still intact
+				const scalarf_range& clip_range = context.range_list[track_index].range.scalarf;
+
+				// What we would use if we retain every sample, segmenting aside
+				const uint8_t full_rate_bit_rate = find_decimated_track_bit_rate(ref_track, 0, clip_range.get_min(), clip_range.get_extent(), precision, sample_mask, decoded_samples);
+				uint64_t best_size_bits = uint64_t(num_samples) * num_components * get_num_bits_at_bit_rate(full_rate_bit_rate);
+				if (!is_raw_bit_rate(full_rate_bit_rate))
+					best_size_bits += range_size_bits;
+
+				uint32_t best_decimation_shift = 0;
+				uint8_t best_bit_rate = full_rate_bit_rate;
+				vector4f best_range_min = vector_zero();
+				vector4f best_range_extent = vector_zero();
+
+				for (uint32_t decimation_shift = 1; decimation_shift <= k_max_decimation_shift; ++decimation_shift)
+				{
+					const uint32_t num_decimated_samples = calculate_num_decimated_samples(num_samples, decimation_shift);
+					if (num_decimated_samples >= num_samples)
+						break;	// Too few samples to decimate
+
+					// Interpolated values always fall within the range of our retained samples
+					vector4f range_min = get_decimated_raw_sample(ref_track, num_samples, decimation_shift, 0);
+					vector4f range_max = range_min;
+					for (uint32_t decimated_index = 1; decimated_index < num_decimated_samples; ++decimated_index)
+					{
+						const vector4f raw_sample = get_decimated_raw_sample(ref_track, num_samples, decimation_shift, decimated_index);
+						range_min = vector_min(range_min, raw_sample);
+						range_max = vector_max(range_max, raw_sample);
+					}
+
+					const vector4f range_extent = vector_sub(range_max, range_min);
+
+					const uint8_t bit_rate = find_decimated_track_bit_rate(ref_track, decimation_shift, range_min, range_extent, precision, sample_mask, decoded_samples);
+					if (bit_rate == k_invalid_bit_rate)
+						break;	// Interpolation alone is too inaccurate, a larger shift will be as well
+
+					// Our range is always present along with our header
+					const uint64_t size_bits = uint64_t(num_decimated_samples) * num_components * get_num_bits_at_bit_rate(bit_rate) + range_size_bits + sizeof(scalar_decimated_track_header) * 8;
+					if (size_bits < best_size_bits)
+					{
+						best_size_bits = size_bits;
+						best_decimation_shift = decimation_shift;
+						best_bit_rate = bit_rate;
+						best_range_min = range_min;
+						best_range_extent = range_extent;
+					}
+				}
+
+				if (best_decimation_shift == 0)
+					continue;	// Retaining every sample is best
+
+				const uint32_t num_decimated_samples = calculate_num_decimated_samples(num_samples, best_decimation_shift);
+
+				decimated_track& decimated = context.decimated_tracks[track_index];
+				decimated.range_min = best_range_min;
+				decimated.range_extent = best_range_extent;
+				decimated.samples = allocate_type_array<vector4f>(*context.allocator, num_decimated_samples);
+				decimated.num_samples = num_decimated_samples;
+				decimated.decimation_shift = safe_static_cast<uint8_t>(best_decimation_shift);
+				decimated.bit_rate = best_bit_rate;
+
+				for (uint32_t decimated_index = 0; decimated_index < num_decimated_samples; ++decimated_index)
+				{
+					const vector4f raw_sample = get_decimated_raw_sample(ref_track, num_samples, best_decimation_shift, decimated_index);
+
+					if (is_raw_bit_rate(best_bit_rate))
+						decimated.samples[decimated_index] = raw_sample;
+					else
+					{
+						const quantization_scales scales(get_num_bits_at_bit_rate(best_bit_rate));
+						decimated.samples[decimated_index] = pack_vector4_uXX(normalize_decimated_sample(raw_sample, best_range_min, best_range_extent), scales);
+					}
+				}
+
+				bitset_set(context.decimated_tracks_bitset, bitset_desc, track_index, true);
+			}
+
+			deallocate_type_array(*context.allocator, decoded_samples, num_samples);
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,165 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/track_traits.h"
+#include "acl/core/track_types.h"
+#include "acl/core/profiling.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/track.h"
+#include "acl/compression/track_array.h"
+#include "acl/compression/impl/track_list_context.h"
+
+#include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Double precision tracks are compressed as float tracks of the same width.
+		// Each track has a double precision base value, the center of its range, and
+		// its samples are stored as float deltas from it. Large values (e.g. world
+		// coordinates) retain their accuracy since the deltas remain small and
+		// decompression adds the base value back once the deltas are interpolated.
+		// The base value is per track, not per segment: the precision of the deltas
+		// degrades with the track range (e.g. roughly 0.5 mm over 10 km).
+		//////////////////////////////////////////////////////////////////////////
+
+		template<track_type8 k_track_type, track_type8 k_packed_track_type>
+		inline track_array pack_double_track_list_impl(iallocator& allocator, const track_array& track_list, double* out_base_values)
+		{
+			using track_trait_t = track_traits<k_track_type>;
+			using track_array_type_t = track_array_typed<k_track_type>;
+			using packed_track_type_t = track_typed<k_packed_track_type>;
+			using packed_sample_type_t = typename track_traits<k_packed_track_type>::sample_type;
+
+			const track_array_type_t& typed_track_list = track_array_cast<track_array_type_t>(track_list);
+			const uint32_t num_tracks = track_list.get_num_tracks();
+			const uint32_t num_samples = track_list.get_num_samples_per_track();
+			const float sample_rate = track_list.get_sample_rate();
+
+			track_array out_track_list(allocator, num_tracks);
+			out_track_list.set_name(track_list.get_name());
+			out_track_list.set_looping_policy(track_list.get_looping_policy());
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const typename track_array_type_t::track_member_type& ref_track = typed_track_list[track_index];
+				packed_track_type_t track = packed_track_type_t::make_reserve(ref_track.get_description(), allocator, num_samples, sample_rate);
+
+				// The center of our range keeps the deltas as small as possible
+				rtm::vector4d base_value = rtm::vector_zero();
+				if (num_samples != 0)
+				{
+					rtm::vector4d range_min = track_trait_t::load_as_vector(&ref_track[0]);
+					rtm::vector4d range_max = range_min;
+					for (uint32_t sample_index = 1; sample_index < num_samples; ++sample_index)
+					{
+						const rtm::vector4d sample = track_trait_t::load_as_vector(&ref_track[sample_index]);
+						range_min = rtm::vector_min(range_min, sample);
+						range_max = rtm::vector_max(range_max, sample);
+					}
+
+					base_value = rtm::vector_mul(rtm::vector_add(range_min, range_max), 0.5);
+				}
+
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				{
+					const rtm::vector4d delta = rtm::vector_sub(track_trait_t::load_as_vector(&ref_track[sample_index]), base_value);
+
+					float delta_values[4];
+					rtm::vector_store(rtm::vector_cast(delta), &delta_values[0]);
+					std::memcpy(&track[sample_index], &delta_values[0], sizeof(packed_sample_type_t));
+				}
+
+				rtm::vector_store(base_value, out_base_values + size_t(track_index) * k_num_base_values_per_track);
+
+				out_track_list[track_index] = std::move(track);
+			}
+
+			return out_track_list;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a list of float tracks with the deltas of every double precision track.
+		// The base values are written in track order, 'k_num_base_values_per_track' per track.
+		//////////////////////////////////////////////////////////////////////////
+		inline track_array pack_double_track_list(iallocator& allocator, const track_array& track_list, double* out_base_values)
+		{
+			ACL_PROFILE_SCOPE("acl::pack_double_track_list");
+
+			switch (track_list.get_track_type())
+			{
+			case track_type8::float1d:
+				return pack_double_track_list_impl<track_type8::float1d, track_type8::float1f>(allocator, track_list, out_base_values);
+			case track_type8::float2d:
+				return pack_double_track_list_impl<track_type8::float2d, track_type8::float2f>(allocator, track_list, out_base_values);
+			case track_type8::float3d:
+				return pack_double_track_list_impl<track_type8::float3d, track_type8::float3f>(allocator, track_list, out_base_values);
+			case track_type8::float4d:
+				return pack_double_track_list_impl<track_type8::float4d, track_type8::float4f>(allocator, track_list, out_base_values);
+			case track_type8::vector4d:
+				return pack_double_track_list_impl<track_type8::vector4d, track_type8::vector4f>(allocator, track_list, out_base_values);
+			default:
+				ACL_ASSERT(false, "Expected double precision tracks");
+				return track_array();
+			}
+		}
+
+		// Writes the base value of every output track, only the components used by the track type are stored
+		inline uint32_t write_track_base_values(const track_list_context& context, double* base_values)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+			ACL_ASSERT(context.track_base_values != nullptr, "Expected double precision tracks");
+
+			const uint32_t num_components = get_track_num_sample_elements(context.reference_list->get_track_type());
+
+			for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+			{
+				const uint32_t track_index = context.track_output_indices[output_index];
+
+				if (base_values != nullptr)
+					std::memcpy(base_values + output_index * num_components, context.track_base_values + size_t(track_index) * k_num_base_values_per_track, num_components * sizeof(double));
+			}
+
+			return context.num_output_tracks * num_components * uint32_t(sizeof(double));
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
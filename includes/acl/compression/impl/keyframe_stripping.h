@@ -26,6 +26,7 @@
 
 #include "acl/version.h"
 #include "acl/core/scope_profiler.h"
+#include "acl/core/profiling.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/compression/compression_settings.h"
 #include "acl/compression/impl/compression_stats.h"
@@ -42,6 +43,8 @@ namespace acl
 	{
 		inline void strip_keyframes(clip_context& lossy_clip_context, const compression_settings& settings, compression_stats_t& compression_stats)
 		{
+			ACL_PROFILE_SCOPE("acl::strip_keyframes");
+
 			if (!settings.keyframe_stripping.is_enabled())
 				return;	// We don't want to strip keyframes, nothing to do
 
@@ -49,6 +52,7 @@ namespace acl
 
 #if defined(ACL_USE_SJSON)
 			scope_profiler keyframe_stripping_time;
+			scope_stage_memory_tracker keyframe_stripping_memory(compression_stats, compression_stats.keyframe_stripping_memory);
 #endif
 
 			const bitset_description hard_keyframes_desc = bitset_description::make_from_num_bits<32>();
@@ -26,6 +26,8 @@
 
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/range_reduction_types.h"
+#include "acl/core/profiling.h"
 #include "acl/compression/impl/track_list_context.h"
 
 #include <rtm/mask4i.h>
@@ -77,13 +79,14 @@ namespace acl
 
 		inline void normalize_tracks(track_list_context& context)
 		{
+			ACL_PROFILE_SCOPE("acl::normalize_tracks");
+
 			ACL_ASSERT(context.is_valid(), "Invalid context");
 
 			for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
 			{
-				const bool is_track_constant = context.is_constant(track_index);
-				if (is_track_constant)
-					continue;	// Constant tracks don't need to be modified
+				if (!context.is_animated(track_index))
+					continue;	// Constant and sparse tracks don't need to be modified
 
 				const track_range& range = context.range_list[track_index];
 				track& mut_track = context.track_list[track_index];
@@ -102,6 +105,127 @@ namespace acl
 				}
 			}
 		}
+		// Quantizes the segment range on 8 bits per component while making sure the padded range encompasses the original
+		inline scalar_segment_range RTM_SIMD_CALL fixup_segment_range(rtm::vector4f_arg0 range_min, rtm::vector4f_arg1 range_max)
+		{
+			using namespace rtm;
+
+			const vector4f one = rtm::vector_set(1.0F);
+			const vector4f zero = vector_zero();
+			const float max_range_value_flt = float((1 << k_segment_range_reduction_num_bits_per_component) - 1);
+			const vector4f max_range_value = rtm::vector_set(max_range_value_flt);
+			const vector4f inv_max_range_value = rtm::vector_set(1.0F / max_range_value_flt);
+
+			// We pick the quantized minimum closest to the true minimum that is slightly lower, see extract_segment_bone_ranges
+			const vector4f scaled_min = vector_mul(range_min, max_range_value);
+			const vector4f quantized_min0 = vector_clamp(vector_floor(scaled_min), zero, max_range_value);
+			const vector4f quantized_min1 = vector_max(vector_sub(quantized_min0, one), zero);
+
+			const vector4f padded_range_min0 = vector_mul(quantized_min0, inv_max_range_value);
+			const vector4f padded_range_min1 = vector_mul(quantized_min1, inv_max_range_value);
+
+			const mask4f is_min0_lower_mask = vector_less_equal(padded_range_min0, range_min);
+			const vector4f padded_range_min = vector_select(is_min0_lower_mask, padded_range_min0, padded_range_min1);
+
+			// Our minimum changed, pick the quantized extent that is slightly larger to encompass the original maximum
+			const vector4f range_extent = vector_sub(range_max, padded_range_min);
+			const vector4f scaled_extent = vector_mul(range_extent, max_range_value);
+			const vector4f quantized_extent0 = vector_clamp(vector_ceil(scaled_extent), zero, max_range_value);
+			const vector4f quantized_extent1 = vector_min(vector_add(quantized_extent0, one), max_range_value);
+
+			const vector4f padded_range_extent0 = vector_mul(quantized_extent0, inv_max_range_value);
+			const vector4f padded_range_extent1 = vector_mul(quantized_extent1, inv_max_range_value);
+
+			const mask4f is_extent0_higher_mask = vector_greater_equal(padded_range_extent0, range_max);
+			const vector4f padded_range_extent = vector_select(is_extent0_higher_mask, padded_range_extent0, padded_range_extent1);
+
+			return scalar_segment_range{ padded_range_min, padded_range_extent };
+		}
+
+		// Extracts the range of every animated track within each segment, our samples must already be normalized
+		inline void extract_segment_ranges(track_list_context& context)
+		{
+			ACL_PROFILE_SCOPE("acl::extract_segment_ranges");
+
+			using namespace rtm;
+
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			if (!context.has_segments)
+				return;	// A single segment uses the identity range
+
+			for (uint32_t segment_index = 0; segment_index < context.num_segments; ++segment_index)
+			{
+				const uint32_t start_sample_index = context.segment_start_sample_indices[segment_index];
+				const uint32_t end_sample_index = start_sample_index + context.get_segment_num_samples(segment_index);
+
+				for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
+				{
+					if (!context.is_animated(track_index))
+						continue;	// Constant and sparse tracks don't have a segment range
+
+					const track_vector4f& mut_track = track_cast<track_vector4f>(context.track_list[track_index]);
+
+					vector4f range_min = mut_track[start_sample_index];
+					vector4f range_max = range_min;
+
+					for (uint32_t sample_index = start_sample_index + 1; sample_index < end_sample_index; ++sample_index)
+					{
+						const vector4f sample = mut_track[sample_index];
+						range_min = vector_min(range_min, sample);
+						range_max = vector_max(range_max, sample);
+					}
+
+					context.segment_ranges[segment_index * context.num_tracks + track_index] = fixup_segment_range(range_min, range_max);
+				}
+			}
+		}
+
+		// Normalizes our samples within their segment range
+		inline void normalize_segments(track_list_context& context)
+		{
+			ACL_PROFILE_SCOPE("acl::normalize_segments");
+
+			using namespace rtm;
+
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			if (!context.has_segments)
+				return;	// A single segment uses the identity range, nothing to do
+
+			const vector4f one = rtm::vector_set(1.0F);
+			const vector4f zero = vector_zero();
+
+			for (uint32_t segment_index = 0; segment_index < context.num_segments; ++segment_index)
+			{
+				const uint32_t start_sample_index = context.segment_start_sample_indices[segment_index];
+				const uint32_t end_sample_index = start_sample_index + context.get_segment_num_samples(segment_index);
+
+				for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
+				{
+					if (!context.is_animated(track_index))
+						continue;	// Constant and sparse tracks don't need to be modified
+
+					track_vector4f& mut_track = track_cast<track_vector4f>(context.track_list[track_index]);
+					const scalar_segment_range& range = context.segment_ranges[segment_index * context.num_tracks + track_index];
+
+					const mask4f is_range_zero_mask = vector_less_than(range.extent, rtm::vector_set(0.000000001F));
+
+					for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; ++sample_index)
+					{
+						const vector4f sample = mut_track[sample_index];
+
+						vector4f normalized_sample = vector_div(vector_sub(sample, range.min), range.extent);
+
+						// Clamp because the division might be imprecise
+						normalized_sample = vector_clamp(normalized_sample, zero, one);
+						normalized_sample = vector_select(is_range_zero_mask, zero, normalized_sample);
+
+						mut_track[sample_index] = normalized_sample;
+					}
+				}
+			}
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
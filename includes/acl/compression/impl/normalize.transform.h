@@ -33,6 +33,7 @@
 #include "acl/core/track_formats.h"
 #include "acl/core/track_types.h"
 #include "acl/core/range_reduction_types.h"
+#include "acl/core/profiling.h"
 #include "acl/compression/impl/clip_context.h"
 #include "acl/compression/impl/compression_stats.h"
 
@@ -96,10 +97,13 @@ namespace acl
 
 		inline void extract_clip_bone_ranges(iallocator& allocator, clip_context& context, compression_stats_t& compression_stats)
 		{
+			ACL_PROFILE_SCOPE("acl::extract_clip_bone_ranges");
+
 			(void)compression_stats;
 
 #if defined(ACL_USE_SJSON)
 			scope_profiler extract_clip_ranges_time;
+			scope_stage_memory_tracker extract_clip_ranges_memory(compression_stats, compression_stats.extract_clip_ranges_memory);
 #endif
 
 			context.ranges = allocate_type_array<transform_range>(allocator, context.num_bones);
@@ -116,10 +120,13 @@ namespace acl
 
 		inline void extract_segment_bone_ranges(iallocator& allocator, clip_context& context, compression_stats_t& compression_stats)
 		{
+			ACL_PROFILE_SCOPE("acl::extract_segment_bone_ranges");
+
 			(void)compression_stats;
 
 #if defined(ACL_USE_SJSON)
 			scope_profiler extract_segment_ranges_time;
+			scope_stage_memory_tracker extract_segment_ranges_memory(compression_stats, compression_stats.extract_segment_ranges_memory);
 #endif
 
 			const rtm::vector4f one = rtm::vector_set(1.0F);
@@ -345,6 +352,8 @@ namespace acl
 
 		inline void normalize_clip_streams(clip_context& context, range_reduction_flags8 range_reduction, compression_stats_t& compression_stats)
 		{
+			ACL_PROFILE_SCOPE("acl::normalize_clip_streams");
+
 			(void)compression_stats;
 
 #if defined(ACL_USE_SJSON)
@@ -381,6 +390,8 @@ namespace acl
 
 		inline void normalize_segment_streams(clip_context& context, range_reduction_flags8 range_reduction, compression_stats_t& compression_stats)
 		{
+			ACL_PROFILE_SCOPE("acl::normalize_segment_streams");
+
 			(void)compression_stats;
 
 #if defined(ACL_USE_SJSON)
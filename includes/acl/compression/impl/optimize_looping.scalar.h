@@ -26,8 +26,10 @@
 
 #include "acl/version.h"
 #include "acl/core/error.h"
+#include "acl/core/profiling.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/compression/compression_settings.h"
+#include "acl/compression/impl/rotation.scalar.h"
 #include "acl/compression/impl/track_list_context.h"
 
 #include <rtm/vector4f.h>
@@ -44,6 +46,8 @@ namespace acl
 	{
 		inline void optimize_looping(track_list_context& context, const compression_settings& settings)
 		{
+			ACL_PROFILE_SCOPE("acl::optimize_looping");
+
 			if (!settings.optimize_loops)
 				return;	// We don't want to optimize loops, nothing to do
 
@@ -71,7 +75,11 @@ namespace acl
 
 				const rtm::vector4f first_sample = typed_track[0];
 				const rtm::vector4f last_sample = typed_track[last_sample_index];
-				if (!rtm::vector_all_near_equal(first_sample, last_sample, desc.precision))
+
+				const bool is_near_equal = context.has_quatf_tracks
+					? calculate_packed_quatf_error(first_sample, last_sample) <= desc.precision
+					: rtm::vector_all_near_equal(first_sample, last_sample, desc.precision);
+				if (!is_near_equal)
 				{
 					is_wrapping = false;
 					break;
@@ -28,6 +28,7 @@
 #include "acl/core/iallocator.h"
 #include "acl/core/error.h"
 #include "acl/core/scope_profiler.h"
+#include "acl/core/profiling.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/compression/compression_settings.h"
 #include "acl/compression/impl/clip_context.h"
@@ -181,6 +182,8 @@ namespace acl
 			const compression_settings& settings,
 			compression_stats_t& compression_stats)
 		{
+			ACL_PROFILE_SCOPE("acl::optimize_looping");
+
 			if (!settings.optimize_loops)
 				return;	// We don't want to optimize loops, nothing to do
 
@@ -80,6 +80,24 @@ namespace acl
 				case track_type8::vector4f:
 					pre_process_optimize_looping_scalar<track_type8::vector4f>(track_list);
 					break;
+				case track_type8::quatf:
+					pre_process_optimize_looping_scalar<track_type8::quatf>(track_list);
+					break;
+				case track_type8::float1d:
+					pre_process_optimize_looping_scalard<track_type8::float1d>(track_list);
+					break;
+				case track_type8::float2d:
+					pre_process_optimize_looping_scalard<track_type8::float2d>(track_list);
+					break;
+				case track_type8::float3d:
+					pre_process_optimize_looping_scalard<track_type8::float3d>(track_list);
+					break;
+				case track_type8::float4d:
+					pre_process_optimize_looping_scalard<track_type8::float4d>(track_list);
+					break;
+				case track_type8::vector4d:
+					pre_process_optimize_looping_scalard<track_type8::vector4d>(track_list);
+					break;
 				case track_type8::qvvf:
 				default:
 					ACL_ASSERT(false, "Unexpected track type");
@@ -137,6 +155,24 @@ namespace acl
 					case track_type8::vector4f:
 						pre_process_sanitize_constant_tracks_scalar<track_type8::vector4f>(track_);
 						break;
+					case track_type8::quatf:
+						pre_process_sanitize_constant_tracks_quatf(track_);
+						break;
+					case track_type8::float1d:
+						pre_process_sanitize_constant_tracks_scalard<track_type8::float1d>(track_);
+						break;
+					case track_type8::float2d:
+						pre_process_sanitize_constant_tracks_scalard<track_type8::float2d>(track_);
+						break;
+					case track_type8::float3d:
+						pre_process_sanitize_constant_tracks_scalard<track_type8::float3d>(track_);
+						break;
+					case track_type8::float4d:
+						pre_process_sanitize_constant_tracks_scalard<track_type8::float4d>(track_);
+						break;
+					case track_type8::vector4d:
+						pre_process_sanitize_constant_tracks_scalard<track_type8::vector4d>(track_);
+						break;
 					case track_type8::qvvf:
 					default:
 						ACL_ASSERT(false, "Unexpected track type");
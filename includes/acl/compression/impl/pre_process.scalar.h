@@ -28,7 +28,10 @@
 #include "acl/core/track_traits.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/compression/impl/pre_process.common.h"
+#include "acl/compression/impl/rotation.scalar.h"
 
+#include <rtm/quatf.h>
+#include <rtm/vector4d.h>
 #include <rtm/vector4f.h>
 
 #include <cstdint>
@@ -56,9 +59,22 @@ namespace acl
 			{
 				const track_desc_scalarf& desc = track_.get_description();
 
-				const rtm::vector4f first_sample = track_trait_t::load_as_vector(&track_[0]);
-				const rtm::vector4f last_sample = track_trait_t::load_as_vector(&track_[last_sample_index]);
-				if (!rtm::vector_all_near_equal(first_sample, last_sample, desc.precision))
+				bool is_near_equal;
+				if (k_track_type == track_type8::quatf)
+				{
+					// Rotations measure their precision as an angle
+					const rtm::quatf first_sample = rtm::vector_to_quat(track_trait_t::load_as_vector(&track_[0]));
+					const rtm::quatf last_sample = rtm::vector_to_quat(track_trait_t::load_as_vector(&track_[last_sample_index]));
+					is_near_equal = calculate_quatf_error(first_sample, last_sample) <= desc.precision;
+				}
+				else
+				{
+					const rtm::vector4f first_sample = track_trait_t::load_as_vector(&track_[0]);
+					const rtm::vector4f last_sample = track_trait_t::load_as_vector(&track_[last_sample_index]);
+					is_near_equal = rtm::vector_all_near_equal(first_sample, last_sample, desc.precision);
+				}
+
+				if (!is_near_equal)
 				{
 					is_looping = false;
 					break;
@@ -72,6 +88,57 @@ namespace acl
 			}
 		}
 
+		// Double precision tracks are compared in double precision to retain the accuracy of large values
+		template<track_type8 k_track_type>
+		inline void pre_process_optimize_looping_scalard(track_array& track_list)
+		{
+			using track_trait_t = track_traits<k_track_type>;
+			using track_array_type_t = track_array_typed<k_track_type>;
+			using track_type_t = track_typed<k_track_type>;
+
+			track_array_type_t& track_list_ = track_array_cast<track_array_type_t>(track_list);
+			const uint32_t last_sample_index = track_list_.get_num_samples_per_track() - 1;
+
+			bool is_looping = true;
+			for (track_type_t& track_ : track_list_)
+			{
+				const track_desc_scalarf& desc = track_.get_description();
+
+				const rtm::vector4d first_sample = track_trait_t::load_as_vector(&track_[0]);
+				const rtm::vector4d last_sample = track_trait_t::load_as_vector(&track_[last_sample_index]);
+				if (!rtm::vector_all_near_equal(first_sample, last_sample, double(desc.precision)))
+				{
+					is_looping = false;
+					break;
+				}
+			}
+
+			if (is_looping)
+			{
+				for (track_type_t& track_ : track_list_)
+					track_[last_sample_index] = track_[0];
+			}
+		}
+
+		// Rotations are constant if every sample is within our precision of the first one
+		inline void pre_process_sanitize_constant_tracks_quatf(track& track_)
+		{
+			const uint32_t num_samples_per_track = track_.get_num_samples();
+			track_quatf& track__ = track_cast<track_quatf>(track_);
+
+			const track_desc_scalarf& desc = track__.get_description();
+			const rtm::quatf constant_sample = track__[0];
+
+			for (uint32_t sample_index = 1; sample_index < num_samples_per_track; ++sample_index)
+			{
+				if (calculate_quatf_error(constant_sample, track__[sample_index]) > desc.precision)
+					return;
+			}
+
+			for (uint32_t sample_index = 1; sample_index < num_samples_per_track; ++sample_index)
+				track__[sample_index] = constant_sample;
+		}
+
 		template<track_type8 k_track_type>
 		inline void pre_process_sanitize_constant_tracks_scalar(track& track_)
 		{
@@ -105,6 +172,41 @@ namespace acl
 					track__[sample_index] = constant_sample;
 			}
 		}
+
+		// See pre_process_optimize_looping_scalard(..)
+		template<track_type8 k_track_type>
+		inline void pre_process_sanitize_constant_tracks_scalard(track& track_)
+		{
+			using track_trait_t = track_traits<k_track_type>;
+			using sample_type_t = typename track_trait_t::sample_type;
+			using track_type_t = track_typed<k_track_type>;
+
+			const uint32_t num_samples_per_track = track_.get_num_samples();
+			track_type_t& track__ = track_cast<track_type_t>(track_);
+
+			const track_desc_scalarf& desc = track_.get_description<track_desc_scalarf>();
+			const double precision = desc.precision;
+
+			rtm::vector4d min = track_trait_t::load_as_vector(&track__[0]);
+			rtm::vector4d max = min;
+
+			for (uint32_t sample_index = 1; sample_index < num_samples_per_track; ++sample_index)
+			{
+				const rtm::vector4d sample = track_trait_t::load_as_vector(&track__[sample_index]);
+
+				min = rtm::vector_min(min, sample);
+				max = rtm::vector_max(max, sample);
+			}
+
+			const rtm::vector4d extent = rtm::vector_sub(max, min);
+			if (rtm::vector_all_less_equal(extent, rtm::vector_set(precision)))
+			{
+				const sample_type_t constant_sample = track__[0];
+
+				for (uint32_t sample_index = 1; sample_index < num_samples_per_track; ++sample_index)
+					track__[sample_index] = constant_sample;
+			}
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
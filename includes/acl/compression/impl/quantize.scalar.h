@@ -27,12 +27,15 @@
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/track_types.h"
+#include "acl/core/profiling.h"
 #include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/impl/rotation.scalar.h"
 #include "acl/compression/impl/track_list_context.h"
 
 #include <rtm/mask4i.h>
 #include <rtm/vector4f.h>
 
+#include <algorithm>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -81,7 +84,7 @@ namespace acl
 			return vector_round_symmetric(vector_mul(value, scales.max_value));
 		}
 
-		inline void quantize_scalarf_track(track_list_context& context, uint32_t track_index)
+		inline void find_scalarf_track_bit_rate(track_list_context& context, uint32_t track_index)
 		{
 			using namespace rtm;
 
@@ -90,7 +93,6 @@ namespace acl
 
 			const vector4f precision = vector_load1(&mut_track.get_description().precision);
 			const uint32_t ref_element_size = ref_track.get_sample_size();
-			const uint32_t num_samples = mut_track.get_num_samples();
 
 			const scalarf_range& range = context.range_list[track_index].range.scalarf;
 			const vector4f range_min = range.get_min();
@@ -111,24 +113,44 @@ namespace acl
 				const quantization_scales scales(num_bits_at_bit_rate);
 
 				bool is_error_to_high = false;
-				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				for (uint32_t segment_index = 0; segment_index < context.num_segments && !is_error_to_high; ++segment_index)
 				{
-					std::memcpy(&raw_sample, ref_track[sample_index], ref_element_size);
-
-					const vector4f normalized_sample = mut_track[sample_index];
-
-					// Decay our value through quantization
-					const vector4f decayed_normalized_sample = decay_vector4_uXX(normalized_sample, scales);
-
-					// Undo normalization
-					const vector4f decayed_sample = vector_mul_add(decayed_normalized_sample, range_extent, range_min);
+					const scalar_segment_range& segment_range = context.segment_ranges[segment_index * context.num_tracks + track_index];
+					const uint32_t start_sample_index = context.segment_start_sample_indices[segment_index];
+					const uint32_t end_sample_index = start_sample_index + context.get_segment_num_samples(segment_index);
 
-					const vector4f delta = vector_abs(vector_sub(raw_sample, decayed_sample));
-					const vector4f masked_delta = vector_select(sample_mask, delta, zero);
-					if (!vector_all_less_equal(masked_delta, precision))
+					for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; ++sample_index)
 					{
-						is_error_to_high = true;
-						break;
+						std::memcpy(&raw_sample, ref_track[sample_index], ref_element_size);
+
+						const vector4f normalized_sample = mut_track[sample_index];
+
+						// Decay our value through quantization
+						const vector4f decayed_normalized_sample = decay_vector4_uXX(normalized_sample, scales);
+
+						// Undo segment normalization then clip normalization
+						const vector4f decayed_clip_normalized_sample = vector_mul_add(decayed_normalized_sample, segment_range.extent, segment_range.min);
+						const vector4f decayed_sample = vector_mul_add(decayed_clip_normalized_sample, range_extent, range_min);
+
+						if (context.has_quatf_tracks)
+						{
+							// Rotations measure their error as an angle once W is reconstructed
+							if (calculate_packed_quatf_error(raw_sample, decayed_sample) > vector_get_x(precision))
+							{
+								is_error_to_high = true;
+								break;
+							}
+
+							continue;
+						}
+
+						const vector4f delta = vector_abs(vector_sub(raw_sample, decayed_sample));
+						const vector4f masked_delta = vector_select(sample_mask, delta, zero);
+						if (!vector_all_less_equal(masked_delta, precision))
+						{
+							is_error_to_high = true;
+							break;
+						}
 					}
 				}
 
@@ -140,6 +162,16 @@ namespace acl
 			}
 
 			context.bit_rate_list[track_index].scalar.value = best_bit_rate;
+		}
+
+		inline void pack_scalarf_track(track_list_context& context, uint32_t track_index)
+		{
+			const track& ref_track = (*context.reference_list)[track_index];
+			track_vector4f& mut_track = track_cast<track_vector4f>(context.track_list[track_index]);
+
+			const uint32_t ref_element_size = ref_track.get_sample_size();
+			const uint32_t num_samples = mut_track.get_num_samples();
+			const uint8_t best_bit_rate = context.bit_rate_list[track_index].scalar.value;
 
 			// Done, update our track with the final result
 			if (best_bit_rate == k_highest_bit_rate)
@@ -159,24 +191,71 @@ namespace acl
 			}
 		}
 
-		inline void quantize_tracks(track_list_context& context)
+		//////////////////////////////////////////////////////////////////////////
+		// Raises the bit rate of float1f tracks so that groups of 4 consecutive animated
+		// tracks share the same bit rate. The decompressor can then unpack and interpolate
+		// the whole group at once with SIMD.
+		// Every bit rate higher than the one selected is known to be accurate enough since
+		// we stop our search as soon as a bit rate exceeds our precision.
+		// Groups are formed in output order the same way the decompressor scans them.
+		//////////////////////////////////////////////////////////////////////////
+		inline void group_float1f_track_bit_rates(track_list_context& context)
+		{
+			const uint32_t num_output_tracks = context.num_output_tracks;
+
+			uint32_t output_index = 0;
+			while (output_index + 4 <= num_output_tracks)
+			{
+				uint8_t group_bit_rate = 0;
+				bool is_group_valid = true;
+				for (uint32_t group_track_offset = 0; group_track_offset < 4; ++group_track_offset)
+				{
+					const uint32_t track_index = context.track_output_indices[output_index + group_track_offset];
+					if (!context.is_animated(track_index) || is_raw_bit_rate(context.bit_rate_list[track_index].scalar.value))
+					{
+						is_group_valid = false;
+						break;
+					}
+
+					group_bit_rate = std::max<uint8_t>(group_bit_rate, context.bit_rate_list[track_index].scalar.value);
+				}
+
+				if (!is_group_valid)
+				{
+					// This track cannot be part of a group, try with the next one
+					output_index++;
+					continue;
+				}
+
+				for (uint32_t group_track_offset = 0; group_track_offset < 4; ++group_track_offset)
+				{
+					const uint32_t track_index = context.track_output_indices[output_index + group_track_offset];
+					context.bit_rate_list[track_index].scalar.value = group_bit_rate;
+				}
+
+				output_index += 4;
+			}
+		}
+
+		inline void quantize_tracks(track_list_context& context, bool enable_track_grouping)
 		{
+			ACL_PROFILE_SCOPE("acl::quantize_tracks");
+
 			ACL_ASSERT(context.is_valid(), "Invalid context");
 
 			context.bit_rate_list = allocate_type_array<track_bit_rate>(*context.allocator, context.num_tracks);
 
 			for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
 			{
-				const bool is_track_constant = context.is_constant(track_index);
-				if (is_track_constant)
-					continue;	// Constant tracks don't need to be modified
+				if (!context.is_animated(track_index))
+					continue;	// Constant and sparse tracks are handled separately
 
 				const track_range& range = context.range_list[track_index];
 
 				switch (range.category)
 				{
 				case track_category8::scalarf:
-					quantize_scalarf_track(context, track_index);
+					find_scalarf_track_bit_rate(context, track_index);
 					break;
 				case track_category8::scalard:
 				case track_category8::transformf:
@@ -186,6 +265,18 @@ namespace acl
 					break;
 				}
 			}
+
+			if (enable_track_grouping && context.reference_list->get_track_type() == track_type8::float1f)
+				group_float1f_track_bit_rates(context);
+
+			// Now that our bit rates are final, quantize everything
+			for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
+			{
+				if (!context.is_animated(track_index))
+					continue;
+
+				pack_scalarf_track(context, track_index);
+			}
 		}
 	}
 
@@ -26,11 +26,13 @@
 
 #include "acl/version.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/arena_allocator.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/error.h"
 #include "acl/core/scope_profiler.h"
 #include "acl/core/time_utils.h"
 #include "acl/core/track_formats.h"
+#include "acl/core/profiling.h"
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/math/quat_packing.h"
 #include "acl/math/vector4_packing.h"
@@ -42,6 +44,7 @@
 #include "acl/compression/impl/normalize.transform.h"
 #include "acl/compression/impl/convert_rotation.transform.h"
 #include "acl/compression/impl/rigid_shell_utils.h"
+#include "acl/compression/impl/worker_pool.h"
 #include "acl/compression/transform_error_metrics.h"
 #include "acl/compression/compression_settings.h"
 
@@ -52,9 +55,12 @@
 #include <sjson/writer.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 
 #define ACL_IMPL_DEBUG_LEVEL_NONE					0
 #define ACL_IMPL_DEBUG_LEVEL_SUMMARY_ONLY			1
@@ -83,9 +89,119 @@ namespace acl
 
 	namespace acl_impl
 	{
+		struct parallel_permutation_search;
+
+		// Caches the lossy object space transforms of every sample in the current segment.
+		// When we measure the error of a bone, its parents often retain the bit rates they had when we
+		// last measured them. Each cached transform is tagged with a generation that changes whenever it is
+		// computed again and it remembers the generation of its parent it was computed with. A transform can
+		// be re-used as long as its bit rates and those of its parents have not changed since. Only the subtree
+		// under the first modified bone needs to be sampled and transformed into object space.
+		struct object_transform_cache
+		{
+			iallocator& allocator;
+			uint8_t* transforms;					// 1 per transform per sample in segment
+			transform_bit_rates* bit_rates;			// 1 per transform, bit rates used by the cached transforms
+			uint32_t* generations;					// 1 per transform, 0 if the cached transforms are invalid
+			uint32_t* parent_generations;			// 1 per transform, generation of the parent used by the cached transforms
+			size_t buffer_size;
+			uint32_t num_transforms;
+			uint32_t generation;
+
+			object_transform_cache(iallocator& allocator_, size_t metric_transform_size, uint32_t num_transforms_, uint32_t max_num_samples)
+				: allocator(allocator_)
+				, buffer_size(metric_transform_size * num_transforms_ * max_num_samples)
+				, num_transforms(num_transforms_)
+				, generation(0)
+			{
+				transforms = allocate_type_array_aligned<uint8_t>(allocator_, buffer_size, 64);
+				bit_rates = allocate_type_array<transform_bit_rates>(allocator_, num_transforms_);
+				generations = allocate_type_array<uint32_t>(allocator_, num_transforms_);
+				parent_generations = allocate_type_array<uint32_t>(allocator_, num_transforms_);
+
+				reset();
+			}
+
+			~object_transform_cache()
+			{
+				deallocate_type_array(allocator, transforms, buffer_size);
+				deallocate_type_array(allocator, bit_rates, num_transforms);
+				deallocate_type_array(allocator, generations, num_transforms);
+				deallocate_type_array(allocator, parent_generations, num_transforms);
+			}
+
+			// Invalidates every cached transform, must be called when the segment changes
+			void reset()
+			{
+				std::fill(generations, generations + num_transforms, 0U);
+				generation = 0;
+			}
+
+			// Returns the index of the first link in the chain that must be computed again or 'num_bones_in_chain' if every link is cached
+			uint32_t find_first_dirty_link(const uint32_t* chain_bone_indices, uint32_t num_bones_in_chain, const uint32_t* parent_transform_indices, const transform_bit_rates* bit_rate_per_bone) const
+			{
+				for (uint32_t chain_link_index = 0; chain_link_index < num_bones_in_chain; ++chain_link_index)
+				{
+					const uint32_t bone_index = chain_bone_indices[chain_link_index];
+					const uint32_t parent_bone_index = parent_transform_indices[bone_index];
+					const uint32_t parent_generation = parent_bone_index != k_invalid_track_index ? generations[parent_bone_index] : 0;
+
+					const transform_bit_rates& cached_bit_rates = bit_rates[bone_index];
+					const transform_bit_rates& current_bit_rates = bit_rate_per_bone[bone_index];
+
+					const bool is_cached = generations[bone_index] != 0
+						&& parent_generations[bone_index] == parent_generation
+						&& cached_bit_rates.rotation == current_bit_rates.rotation
+						&& cached_bit_rates.translation == current_bit_rates.translation
+						&& cached_bit_rates.scale == current_bit_rates.scale;
+
+					if (!is_cached)
+						return chain_link_index;
+				}
+
+				return num_bones_in_chain;
+			}
+
+			// Updates the cached state of the links we computed again
+			// If we did not compute every sample, the links are invalidated instead
+			void commit(const uint32_t* dirty_bone_indices, uint32_t num_dirty_bones, const uint32_t* parent_transform_indices, const transform_bit_rates* bit_rate_per_bone, bool is_complete)
+			{
+				for (uint32_t dirty_index = 0; dirty_index < num_dirty_bones; ++dirty_index)
+				{
+					const uint32_t bone_index = dirty_bone_indices[dirty_index];
+
+					if (!is_complete)
+					{
+						generations[bone_index] = 0;
+						continue;
+					}
+
+					generation++;
+					if (generation == 0)
+					{
+						// We wrapped around, invalidate everything to avoid false positives
+						// The current dirty links remain invalid as well, we'll compute them again when we need them
+						reset();
+						return;
+					}
+
+					const uint32_t parent_bone_index = parent_transform_indices[bone_index];
+
+					generations[bone_index] = generation;
+					parent_generations[bone_index] = parent_bone_index != k_invalid_track_index ? generations[parent_bone_index] : 0;
+					bit_rates[bone_index] = bit_rate_per_bone[bone_index];
+				}
+			}
+
+		private:
+			object_transform_cache(const object_transform_cache&) = delete;
+			object_transform_cache& operator=(const object_transform_cache&) = delete;
+		};
+
 		struct quantization_context
 		{
 			iallocator& allocator;
+			iallocator* scratch_allocator;			// Transient memory that only lives while a segment is optimized, defaults to our allocator
 			clip_context& clip;
 			const clip_context& raw_clip;
 			const clip_context& additive_base_clip;
@@ -133,6 +249,8 @@ namespace acl
 			uint8_t* lossy_object_pose;				// 1 per transform
 			size_t metric_transform_size;
 
+			object_transform_cache lossy_object_transforms;	// Cached lossy object transforms used to measure the error of bone chains
+
 			transform_bit_rates* bit_rate_per_bone;			// 1 per transform
 			uint32_t* parent_transform_indices;		// 1 per transform
 			uint32_t* self_transform_indices;		// 1 per transform
@@ -141,8 +259,15 @@ namespace acl
 			uint32_t num_bones_in_chain;
 			uint32_t padding1 = 0;					// unused
 
+			parallel_permutation_search* permutation_search = nullptr;	// Optional, evaluates bone chain permutations on multiple threads
+
+			// Local bit rate permutations are generated once when we first need them and re-used by every segment
+			uint8_t* local_bit_rate_permutations_per_dof[3] = { nullptr, nullptr, nullptr };	// 1 per number of degrees of freedom
+			uint32_t num_local_bit_rate_permutations_per_dof[3] = { 0, 0, 0 };
+
 			quantization_context(iallocator& allocator_, clip_context& clip_, const clip_context& raw_clip_, const clip_context& additive_base_clip_, const compression_settings& settings_)
 				: allocator(allocator_)
+				, scratch_allocator(&allocator_)
 				, clip(clip_)
 				, raw_clip(raw_clip_)
 				, additive_base_clip(additive_base_clip_)
@@ -151,7 +276,8 @@ namespace acl
 				, metadata(clip_.metadata)
 				, num_bones(clip_.num_bones)
 				, error_metric(settings_.error_metric)
-				, bit_rate_database(allocator_, settings_.rotation_format, settings_.translation_format, settings_.scale_format, clip_.segments->bone_streams, raw_clip_.segments->bone_streams, clip_.num_bones, clip_.segments->num_samples)
+				, bit_rate_database(allocator_, settings_.rotation_format, settings_.translation_format, settings_.scale_format, clip_.segments->bone_streams, raw_clip_.segments->bone_streams, clip_.num_bones, clip_.segments->num_samples,
+					calculate_num_bit_rates_cached_per_track(settings_.num_bit_rates_cached_per_track, settings_.level, clip_.num_bones, clip_.segments->num_samples, raw_clip_.has_scale))
 				, local_query()
 				, all_local_query(allocator_)
 				, object_query(allocator_)
@@ -168,6 +294,7 @@ namespace acl
 				, raw_bone_streams(raw_clip_.segments[0].bone_streams)
 				, lossy_transforms_start(nullptr)
 				, lossy_transforms_end(nullptr)
+				, lossy_object_transforms(allocator_, settings_.error_metric->get_transform_size(clip_.has_scale), clip_.num_bones, clip_.segments->num_samples)
 				, num_bones_in_chain(0)
 			{
 				local_query.bind(bit_rate_database);
@@ -218,6 +345,25 @@ namespace acl
 				deallocate_type_array(allocator, parent_transform_indices, num_bones);
 				deallocate_type_array(allocator, self_transform_indices, num_bones);
 				deallocate_type_array(allocator, chain_bone_indices, num_bones);
+
+				for (uint32_t dof_index = 0; dof_index < 3; ++dof_index)
+					deallocate_type_array(allocator, local_bit_rate_permutations_per_dof[dof_index], get_num_local_bit_rate_permutations(dof_index + 1) * (dof_index + 1));
+			}
+
+			// Returns every local bit rate permutation for the provided degrees of freedom [1, 3], generating them if needed
+			const uint8_t* get_local_bit_rate_permutations(uint32_t num_dof, uint32_t& out_num_permutations)
+			{
+				ACL_ASSERT(num_dof >= 1 && num_dof <= 3, "Invalid number of degrees of freedom: %u", num_dof);
+
+				const uint32_t dof_index = num_dof - 1;
+				if (local_bit_rate_permutations_per_dof[dof_index] == nullptr)
+				{
+					local_bit_rate_permutations_per_dof[dof_index] = allocate_type_array<uint8_t>(allocator, get_num_local_bit_rate_permutations(num_dof) * num_dof);
+					num_local_bit_rate_permutations_per_dof[dof_index] = generate_local_bit_rate_permutations(num_dof, local_bit_rate_permutations_per_dof[dof_index]);
+				}
+
+				out_num_permutations = num_local_bit_rate_permutations_per_dof[dof_index];
+				return local_bit_rate_permutations_per_dof[dof_index];
 			}
 
 			void set_segment(segment_context& segment_)
@@ -227,6 +373,7 @@ namespace acl
 				num_samples = segment_.num_samples;
 				segment_sample_start_index = segment_.clip_sample_offset;
 				bit_rate_database.set_segment(segment_.bone_streams, segment_.num_bones, segment_.num_samples);
+				lossy_object_transforms.reset();
 
 				// Update our shell distances
 				compute_segment_shell_distances(segment_, additive_base_clip, shell_metadata_per_transform);
@@ -321,6 +468,122 @@ namespace acl
 			quantization_context& operator=(quantization_context&&) = delete;
 		};
 
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates the bone chain permutations of a bone on multiple threads.
+		// Each worker owns a full quantization context (and bit rate database) since evaluating
+		// a permutation mutates them. Every permutation of a set is evaluated independently from
+		// the same starting bit rates and the results are reduced in permutation order on the
+		// calling thread which yields the same bit rates as a serial search.
+		struct parallel_permutation_search
+		{
+			iallocator& allocator;
+			worker_pool workers;
+			uint32_t num_workers;
+			uint32_t num_bones;
+
+			quantization_context** contexts;					// 1 per worker, the first is the main context
+			transform_bit_rates** permutation_bit_rates;		// 1 per worker, 1 per transform
+
+			uint8_t* permutations;								// 1 per chain link per permutation
+			transform_bit_rates* permutation_chain_bit_rates;	// 1 per chain link per permutation
+			float* permutation_errors;							// 1 per permutation, infinity if the permutation is invalid
+			size_t max_num_permutation_links;
+			size_t max_num_permutations;
+
+			parallel_permutation_search(quantization_context& main_context, const clip_context& additive_base_clip, const compression_settings& settings, uint32_t num_workers_)
+				: allocator(main_context.allocator)
+				, workers(main_context.allocator, num_workers_)
+				, num_workers(num_workers_)
+				, num_bones(main_context.num_bones)
+				, permutations(nullptr)
+				, permutation_chain_bit_rates(nullptr)
+				, permutation_errors(nullptr)
+				, max_num_permutation_links(0)
+				, max_num_permutations(0)
+			{
+				contexts = allocate_type_array<quantization_context*>(allocator, num_workers_);
+				permutation_bit_rates = allocate_type_array<transform_bit_rates*>(allocator, num_workers_);
+
+				contexts[0] = &main_context;
+				for (uint32_t worker_index = 1; worker_index < num_workers_; ++worker_index)
+					contexts[worker_index] = allocate_type<quantization_context>(allocator, allocator, main_context.clip, main_context.raw_clip, additive_base_clip, settings);
+
+				for (uint32_t worker_index = 0; worker_index < num_workers_; ++worker_index)
+					permutation_bit_rates[worker_index] = allocate_type_array<transform_bit_rates>(allocator, num_bones);
+			}
+
+			~parallel_permutation_search()
+			{
+				for (uint32_t worker_index = 1; worker_index < num_workers; ++worker_index)
+					deallocate_type(allocator, contexts[worker_index]);
+
+				for (uint32_t worker_index = 0; worker_index < num_workers; ++worker_index)
+					deallocate_type_array(allocator, permutation_bit_rates[worker_index], num_bones);
+
+				deallocate_type_array(allocator, contexts, num_workers);
+				deallocate_type_array(allocator, permutation_bit_rates, num_workers);
+				deallocate_type_array(allocator, permutations, max_num_permutation_links);
+				deallocate_type_array(allocator, permutation_chain_bit_rates, max_num_permutation_links);
+				deallocate_type_array(allocator, permutation_errors, max_num_permutations);
+			}
+
+			void set_segment(segment_context& segment)
+			{
+				for (uint32_t worker_index = 1; worker_index < num_workers; ++worker_index)
+					contexts[worker_index]->set_segment(segment);
+			}
+
+			// Makes sure we have room for the requested number of permutations, returns the permutation buffer
+			uint8_t* reserve(size_t num_permutations, uint32_t num_bones_in_chain)
+			{
+				const size_t num_permutation_links = num_permutations * num_bones_in_chain;
+				if (num_permutation_links > max_num_permutation_links)
+				{
+					const size_t new_max_num_permutation_links = std::max<size_t>(num_permutation_links, max_num_permutation_links * 2);
+
+					uint8_t* new_permutations = allocate_type_array<uint8_t>(allocator, new_max_num_permutation_links);
+					if (permutations != nullptr)
+						std::memcpy(new_permutations, permutations, max_num_permutation_links);
+
+					deallocate_type_array(allocator, permutations, max_num_permutation_links);
+					deallocate_type_array(allocator, permutation_chain_bit_rates, max_num_permutation_links);
+
+					permutations = new_permutations;
+					permutation_chain_bit_rates = allocate_type_array<transform_bit_rates>(allocator, new_max_num_permutation_links);
+					max_num_permutation_links = new_max_num_permutation_links;
+				}
+
+				if (num_permutations > max_num_permutations)
+				{
+					const size_t new_max_num_permutations = std::max<size_t>(num_permutations, max_num_permutations * 2);
+
+					deallocate_type_array(allocator, permutation_errors, max_num_permutations);
+					permutation_errors = allocate_type_array<float>(allocator, new_max_num_permutations);
+					max_num_permutations = new_max_num_permutations;
+				}
+
+				return permutations;
+			}
+
+			parallel_permutation_search(const parallel_permutation_search&) = delete;
+			parallel_permutation_search& operator=(const parallel_permutation_search&) = delete;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of threads to optimize bit rates with.
+		inline uint32_t get_num_bit_rate_optimization_threads(const compression_settings& settings)
+		{
+#if defined(ACL_USE_THREADS)
+			if (settings.num_bit_rate_optimization_threads != 0)
+				return settings.num_bit_rate_optimization_threads;
+
+			return get_num_hardware_threads();
+#else
+			(void)settings;
+			return 1;
+#endif
+		}
+
 		inline void quantize_fixed_rotation_stream(iallocator& allocator, const rotation_track_stream& raw_stream, rotation_format8 rotation_format, rotation_track_stream& out_quantized_stream)
 		{
 			// We expect all our samples to have the same width of sizeof(rtm::vector4f)
@@ -779,9 +1042,24 @@ namespace acl
 			const auto local_to_object_space_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::local_to_object_space : &itransform_error_metric::local_to_object_space_no_scale);
 			const auto calculate_error_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::calculate_error : &itransform_error_metric::calculate_error_no_scale);
 
+			// Parent transforms that retained their bit rates are already cached in object space, we only
+			// need to compute the chain links starting with the first one that changed
+			// The target bone might not be the last link of the chain, its descendants do not contribute to its error
+			uint32_t num_bones_in_target_chain = context.num_bones_in_chain;
+			while (num_bones_in_target_chain != 0 && context.chain_bone_indices[num_bones_in_target_chain - 1] != target_bone_index)
+				num_bones_in_target_chain--;
+
+			ACL_ASSERT(num_bones_in_target_chain != 0, "Target bone %u is not part of the bone chain", target_bone_index);
+
+			object_transform_cache& object_cache = context.lossy_object_transforms;
+			const uint32_t first_dirty_link_index = object_cache.find_first_dirty_link(context.chain_bone_indices, num_bones_in_target_chain, context.parent_transform_indices, context.bit_rate_per_bone);
+			const uint32_t* dirty_bone_indices = context.chain_bone_indices + first_dirty_link_index;
+			const uint32_t num_dirty_bones = num_bones_in_target_chain - first_dirty_link_index;
+			const bool has_dirty_bones = num_dirty_bones != 0;
+
 			itransform_error_metric::convert_transforms_args convert_transforms_args_lossy;
-			convert_transforms_args_lossy.dirty_transform_indices = context.chain_bone_indices;
-			convert_transforms_args_lossy.num_dirty_transforms = context.num_bones_in_chain;
+			convert_transforms_args_lossy.dirty_transform_indices = dirty_bone_indices;
+			convert_transforms_args_lossy.num_dirty_transforms = num_dirty_bones;
 			convert_transforms_args_lossy.transforms = context.lossy_local_pose;
 			convert_transforms_args_lossy.num_transforms = context.num_bones;
 			convert_transforms_args_lossy.sample_index = 0;
@@ -789,33 +1067,40 @@ namespace acl
 			convert_transforms_args_lossy.is_additive_base = false;
 
 			itransform_error_metric::apply_additive_to_base_args apply_additive_to_base_args_lossy;
-			apply_additive_to_base_args_lossy.dirty_transform_indices = context.chain_bone_indices;
-			apply_additive_to_base_args_lossy.num_dirty_transforms = context.num_bones_in_chain;
+			apply_additive_to_base_args_lossy.dirty_transform_indices = dirty_bone_indices;
+			apply_additive_to_base_args_lossy.num_dirty_transforms = num_dirty_bones;
 			apply_additive_to_base_args_lossy.local_transforms = needs_conversion ? (const void*)(context.local_transforms_converted) : (const void*)context.lossy_local_pose;
 			apply_additive_to_base_args_lossy.base_transforms = nullptr;
 			apply_additive_to_base_args_lossy.num_transforms = context.num_bones;
 
 			itransform_error_metric::local_to_object_space_args local_to_object_space_args_lossy;
-			local_to_object_space_args_lossy.dirty_transform_indices = context.chain_bone_indices;
-			local_to_object_space_args_lossy.num_dirty_transforms = context.num_bones_in_chain;
+			local_to_object_space_args_lossy.dirty_transform_indices = dirty_bone_indices;
+			local_to_object_space_args_lossy.num_dirty_transforms = num_dirty_bones;
 			local_to_object_space_args_lossy.parent_transform_indices = context.parent_transform_indices;
 			local_to_object_space_args_lossy.local_transforms = needs_conversion ? (const void*)(context.local_transforms_converted) : (const void*)context.lossy_local_pose;
 			local_to_object_space_args_lossy.num_transforms = context.num_bones;
 
 			itransform_error_metric::calculate_error_args calculate_error_args;
 			calculate_error_args.transform0 = nullptr;
-			calculate_error_args.transform1 = context.lossy_object_pose + (target_bone_index * context.metric_transform_size);
+			calculate_error_args.transform1 = nullptr;
 
 			const rigid_shell_metadata_t& transform_shell = context.shell_metadata_per_transform[target_bone_index];
 			const rtm::scalarf error_threshold = rtm::scalar_set(transform_shell.precision);
 
 			const uint8_t* raw_transform = context.raw_object_transforms + (target_bone_index * context.metric_transform_size);
 			const uint8_t* base_transforms = context.base_local_transforms;
+			uint8_t* lossy_object_transforms = object_cache.transforms;
 
-			context.object_query.build(target_bone_index, context.bit_rate_per_bone, context.bone_streams);
+			if (has_dirty_bones)
+			{
+				// Only the dirty chain links need to be sampled, we stop at the parent of the first one
+				const uint32_t stop_bone_index = context.parent_transform_indices[dirty_bone_indices[0]];
+				context.object_query.build(target_bone_index, context.bit_rate_per_bone, context.bone_streams, stop_bone_index);
+			}
 
 			float sample_indexf = float(context.segment_sample_start_index);
 			rtm::scalarf max_error = rtm::scalar_set(0.0F);
+			uint32_t num_samples_computed = context.num_samples;
 
 			for (uint32_t sample_index = 0; sample_index < context.num_samples; ++sample_index)
 			{
@@ -823,30 +1108,36 @@ namespace acl
 				// The sample time is calculated from the full clip duration to be consistent with decompression
 				const float sample_time = rtm::scalar_min(sample_indexf / sample_rate, clip_duration);
 
-				context.bit_rate_database.sample(context.object_query, sample_time, context.lossy_local_pose, context.num_bones);
-
-				if (needs_conversion)
+				if (has_dirty_bones)
 				{
-					convert_transforms_args_lossy.sample_index = sample_index;
-					convert_transforms_impl(error_metric, convert_transforms_args_lossy, context.local_transforms_converted);
-				}
+					context.bit_rate_database.sample(context.object_query, sample_time, context.lossy_local_pose, context.num_bones);
 
-				if (has_additive_base)
-				{
-					apply_additive_to_base_args_lossy.base_transforms = base_transforms;
-					base_transforms += sample_transform_size;
+					if (needs_conversion)
+					{
+						convert_transforms_args_lossy.sample_index = sample_index;
+						convert_transforms_impl(error_metric, convert_transforms_args_lossy, context.local_transforms_converted);
+					}
 
-					// TODO: Is this accurate if we have conversion? Our input is in the converted array for base/local
-					//       and we write to the local qvvf buffer? The calculate error below will read from the converted array
-					//       if we are converted.
-					apply_additive_to_base_impl(error_metric, apply_additive_to_base_args_lossy, context.lossy_local_pose);
-				}
+					if (has_additive_base)
+					{
+						apply_additive_to_base_args_lossy.base_transforms = base_transforms;
+						base_transforms += sample_transform_size;
+
+						// TODO: Is this accurate if we have conversion? Our input is in the converted array for base/local
+						//       and we write to the local qvvf buffer? The calculate error below will read from the converted array
+						//       if we are converted.
+						apply_additive_to_base_impl(error_metric, apply_additive_to_base_args_lossy, context.lossy_local_pose);
+					}
 
-				local_to_object_space_impl(error_metric, local_to_object_space_args_lossy, context.lossy_object_pose);
+					// The clean parents are read from and the dirty links are written to our cache
+					local_to_object_space_impl(error_metric, local_to_object_space_args_lossy, lossy_object_transforms);
+				}
 
 				calculate_error_args.construct_sphere_shell(transform_shell.local_shell_distance);
 				calculate_error_args.transform0 = raw_transform;
+				calculate_error_args.transform1 = lossy_object_transforms + (target_bone_index * context.metric_transform_size);
 				raw_transform += sample_transform_size;
+				lossy_object_transforms += sample_transform_size;
 
 #if defined(RTM_COMPILER_MSVC) && defined(RTM_ARCH_X86) && RTM_COMPILER_MSVC == RTM_COMPILER_MSVC_2015
 				// VS2015 fails to generate the right x86 assembly, branch instead
@@ -858,11 +1149,17 @@ namespace acl
 
 				max_error = rtm::scalar_max(max_error, error);
 				if (stop_condition == error_scan_stop_condition::until_error_too_high && rtm::scalar_greater_equal(error, error_threshold))
+				{
+					num_samples_computed = sample_index + 1;
 					break;
+				}
 
 				sample_indexf += 1.0F;
 			}
 
+			// If we stopped early, the dirty links are only partially cached and we'll need to compute them again
+			object_cache.commit(dirty_bone_indices, num_dirty_bones, context.parent_transform_indices, context.bit_rate_per_bone, num_samples_computed == context.num_samples);
+
 			return rtm::scalar_cast(max_error);
 		}
 
@@ -872,19 +1169,6 @@ namespace acl
 			// until our error is acceptable.
 			// We try permutations from the lowest memory footprint to the highest.
 
-			const uint8_t* const bit_rate_permutations_per_dofs[] =
-			{
-				&acl_impl::k_local_bit_rate_permutations_1_dof[0][0],
-				&acl_impl::k_local_bit_rate_permutations_2_dof[0][0],
-				&acl_impl::k_local_bit_rate_permutations_3_dof[0][0],
-			};
-			const size_t num_bit_rate_permutations_per_dofs[] =
-			{
-				get_array_size(acl_impl::k_local_bit_rate_permutations_1_dof),
-				get_array_size(acl_impl::k_local_bit_rate_permutations_2_dof),
-				get_array_size(acl_impl::k_local_bit_rate_permutations_3_dof),
-			};
-
 			const uint32_t num_bones = context.num_bones;
 			for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
 			{
@@ -916,14 +1200,15 @@ namespace acl
 				num_dof += bone_bit_rates.translation != k_invalid_bit_rate ? 1 : 0;
 				num_dof += bone_bit_rates.scale != k_invalid_bit_rate ? 1 : 0;
 
-				const uint8_t* bit_rate_permutations_per_dof = bit_rate_permutations_per_dofs[num_dof - 1];
-				const size_t num_bit_rate_permutations = num_bit_rate_permutations_per_dofs[num_dof - 1];
+				// Permutations are generated once per context, the first time we need them
+				uint32_t num_bit_rate_permutations = 0;
+				const uint8_t* bit_rate_permutations_per_dof = context.get_local_bit_rate_permutations(num_dof, num_bit_rate_permutations);
 
 				// Our desired bit rates start with the initial value
 				transform_bit_rates desired_bit_rates = bone_bit_rates;
 
 				size_t permutation_offset = 0;
-				for (size_t permutation_index = 0; permutation_index < num_bit_rate_permutations; ++permutation_index)
+				for (uint32_t permutation_index = 0; permutation_index < num_bit_rate_permutations; ++permutation_index)
 				{
 					// If a bit rate is variable, grab a permutation for it
 					// We'll only consume as many bit rates as we have degrees of freedom
@@ -1049,40 +1334,145 @@ namespace acl
 			return best_error;
 		}
 
-		inline float calculate_bone_permutation_error(quantization_context& context, transform_bit_rates* permutation_bit_rates, uint8_t* bone_chain_permutation, uint32_t bone_index, transform_bit_rates* best_bit_rates, float old_error)
+		// Applies a bone chain permutation to our current bit rates and measures its error.
+		// Returns false if the permutation couldn't increase any bit rate.
+		inline bool evaluate_bone_permutation(quantization_context& context, transform_bit_rates* permutation_bit_rates, const uint8_t* bone_chain_permutation, uint32_t bone_index, float old_error, float& out_permutation_error)
+		{
+			// Copy our current bit rates to the permutation rates
+			std::memcpy(permutation_bit_rates, context.bit_rate_per_bone, sizeof(transform_bit_rates) * context.num_bones);
+
+			bool is_permutation_valid = false;
+			const uint32_t num_bones_in_chain = context.num_bones_in_chain;
+			for (uint32_t chain_link_index = 0; chain_link_index < num_bones_in_chain; ++chain_link_index)
+			{
+				if (bone_chain_permutation[chain_link_index] != 0)
+				{
+					// Increase bit rate
+					const uint32_t chain_bone_index = context.chain_bone_indices[chain_link_index];
+					transform_bit_rates chain_bone_best_bit_rates;
+					increase_bone_bit_rate(context, chain_bone_index, bone_chain_permutation[chain_link_index], old_error, chain_bone_best_bit_rates);
+					is_permutation_valid |= chain_bone_best_bit_rates.rotation != permutation_bit_rates[chain_bone_index].rotation;
+					is_permutation_valid |= chain_bone_best_bit_rates.translation != permutation_bit_rates[chain_bone_index].translation;
+					is_permutation_valid |= chain_bone_best_bit_rates.scale != permutation_bit_rates[chain_bone_index].scale;
+					permutation_bit_rates[chain_bone_index] = chain_bone_best_bit_rates;
+				}
+			}
+
+			if (!is_permutation_valid)
+				return false;	// Couldn't increase any bit rate, skip this permutation
+
+			// Measure error
+			std::swap(context.bit_rate_per_bone, permutation_bit_rates);
+			out_permutation_error = calculate_max_error_at_bit_rate_object(context, bone_index, error_scan_stop_condition::until_error_too_high);
+			std::swap(context.bit_rate_per_bone, permutation_bit_rates);
+
+			return true;
+		}
+
+		inline float calculate_bone_permutation_error_parallel(quantization_context& context, uint8_t* bone_chain_permutation, uint32_t bone_index, transform_bit_rates* best_bit_rates, float old_error)
 		{
+			parallel_permutation_search& search = *context.permutation_search;
+
 			const float error_threshold = context.shell_metadata_per_transform[bone_index].precision;
-			float best_error = old_error;
+			const uint32_t num_bones_in_chain = context.num_bones_in_chain;
+			const uint32_t num_bones = context.num_bones;
 
+			// Gather every permutation in the same order as the serial search
+			uint32_t num_permutations = 0;
 			do
 			{
-				// Copy our current bit rates to the permutation rates
-				std::memcpy(permutation_bit_rates, context.bit_rate_per_bone, sizeof(transform_bit_rates) * context.num_bones);
+				uint8_t* permutations = search.reserve(num_permutations + 1, num_bones_in_chain);
+				std::memcpy(permutations + (num_permutations * num_bones_in_chain), bone_chain_permutation, num_bones_in_chain);
+				num_permutations++;
+			} while (std::next_permutation(bone_chain_permutation, bone_chain_permutation + num_bones_in_chain));
 
-				bool is_permutation_valid = false;
-				const uint32_t num_bones_in_chain = context.num_bones_in_chain;
-				for (uint32_t chain_link_index = 0; chain_link_index < num_bones_in_chain; ++chain_link_index)
+			// Every worker starts from our current bit rates
+			for (uint32_t worker_index = 1; worker_index < search.num_workers; ++worker_index)
+			{
+				quantization_context& worker_context = *search.contexts[worker_index];
+				std::memcpy(worker_context.bit_rate_per_bone, context.bit_rate_per_bone, sizeof(transform_bit_rates) * num_bones);
+				std::memcpy(worker_context.chain_bone_indices, context.chain_bone_indices, sizeof(uint32_t) * num_bones_in_chain);
+				worker_context.num_bones_in_chain = num_bones_in_chain;
+			}
+
+			// Workers grab permutations in order. Once a permutation meets our error threshold, the serial search
+			// would stop there and the permutations that follow it no longer need to be evaluated.
+			std::atomic<uint32_t> next_permutation_index(0);
+			std::atomic<uint32_t> first_acceptable_permutation_index(num_permutations);
+
+			auto evaluate_permutations = [&](uint32_t worker_index)
+			{
+				quantization_context& worker_context = *search.contexts[worker_index];
+				transform_bit_rates* permutation_bit_rates = search.permutation_bit_rates[worker_index];
+
+				while (true)
 				{
-					if (bone_chain_permutation[chain_link_index] != 0)
+					const uint32_t permutation_index = next_permutation_index.fetch_add(1);
+					if (permutation_index >= num_permutations || permutation_index > first_acceptable_permutation_index.load())
+						break;
+
+					const uint8_t* permutation = search.permutations + (permutation_index * num_bones_in_chain);
+
+					float permutation_error;
+					if (!evaluate_bone_permutation(worker_context, permutation_bit_rates, permutation, bone_index, old_error, permutation_error))
+						permutation_error = std::numeric_limits<float>::infinity();
+
+					search.permutation_errors[permutation_index] = permutation_error;
+
+					transform_bit_rates* chain_bit_rates = search.permutation_chain_bit_rates + (permutation_index * num_bones_in_chain);
+					for (uint32_t chain_link_index = 0; chain_link_index < num_bones_in_chain; ++chain_link_index)
+						chain_bit_rates[chain_link_index] = permutation_bit_rates[worker_context.chain_bone_indices[chain_link_index]];
+
+					if (permutation_error < error_threshold)
 					{
-						// Increase bit rate
-						const uint32_t chain_bone_index = context.chain_bone_indices[chain_link_index];
-						transform_bit_rates chain_bone_best_bit_rates;
-						increase_bone_bit_rate(context, chain_bone_index, bone_chain_permutation[chain_link_index], old_error, chain_bone_best_bit_rates);
-						is_permutation_valid |= chain_bone_best_bit_rates.rotation != permutation_bit_rates[chain_bone_index].rotation;
-						is_permutation_valid |= chain_bone_best_bit_rates.translation != permutation_bit_rates[chain_bone_index].translation;
-						is_permutation_valid |= chain_bone_best_bit_rates.scale != permutation_bit_rates[chain_bone_index].scale;
-						permutation_bit_rates[chain_bone_index] = chain_bone_best_bit_rates;
+						uint32_t acceptable_permutation_index = first_acceptable_permutation_index.load();
+						while (permutation_index < acceptable_permutation_index && !first_acceptable_permutation_index.compare_exchange_weak(acceptable_permutation_index, permutation_index))
+						{
+						}
 					}
 				}
+			};
 
-				if (!is_permutation_valid)
-					continue;	// Couldn't increase any bit rate, skip this permutation
+			search.workers.run(evaluate_permutations);
 
-				// Measure error
-				std::swap(context.bit_rate_per_bone, permutation_bit_rates);
-				const float permutation_error = calculate_max_error_at_bit_rate_object(context, bone_index, error_scan_stop_condition::until_error_too_high);
-				std::swap(context.bit_rate_per_bone, permutation_bit_rates);
+			// Reduce in permutation order, permutations past the first acceptable one might not have been evaluated
+			const uint32_t num_evaluated_permutations = std::min<uint32_t>(num_permutations, first_acceptable_permutation_index.load() + 1);
+
+			float best_error = old_error;
+			for (uint32_t permutation_index = 0; permutation_index < num_evaluated_permutations; ++permutation_index)
+			{
+				const float permutation_error = search.permutation_errors[permutation_index];
+				if (permutation_error < best_error)
+				{
+					best_error = permutation_error;
+
+					std::memcpy(best_bit_rates, context.bit_rate_per_bone, sizeof(transform_bit_rates) * num_bones);
+
+					const transform_bit_rates* chain_bit_rates = search.permutation_chain_bit_rates + (permutation_index * num_bones_in_chain);
+					for (uint32_t chain_link_index = 0; chain_link_index < num_bones_in_chain; ++chain_link_index)
+						best_bit_rates[context.chain_bone_indices[chain_link_index]] = chain_bit_rates[chain_link_index];
+
+					if (permutation_error < error_threshold)
+						break;
+				}
+			}
+
+			return best_error;
+		}
+
+		inline float calculate_bone_permutation_error(quantization_context& context, transform_bit_rates* permutation_bit_rates, uint8_t* bone_chain_permutation, uint32_t bone_index, transform_bit_rates* best_bit_rates, float old_error)
+		{
+			if (context.permutation_search != nullptr)
+				return calculate_bone_permutation_error_parallel(context, bone_chain_permutation, bone_index, best_bit_rates, old_error);
+
+			const float error_threshold = context.shell_metadata_per_transform[bone_index].precision;
+			float best_error = old_error;
+
+			do
+			{
+				float permutation_error;
+				if (!evaluate_bone_permutation(context, permutation_bit_rates, bone_chain_permutation, bone_index, old_error, permutation_error))
+					continue;	// Couldn't increase any bit rate, skip this permutation
 
 				if (permutation_error < best_error)
 				{
@@ -1224,10 +1614,10 @@ namespace acl
 			//		[bone 0] + 0 [bone 1] + 1 [bone 2] + 2 (9)
 			//		[bone 0] + 0 [bone 1] + 0 [bone 2] + 3 (9)
 
-			uint8_t* bone_chain_permutation = allocate_type_array<uint8_t>(context.allocator, context.num_bones);
-			transform_bit_rates* permutation_bit_rates = allocate_type_array<transform_bit_rates>(context.allocator, context.num_bones);
-			transform_bit_rates* best_permutation_bit_rates = allocate_type_array<transform_bit_rates>(context.allocator, context.num_bones);
-			transform_bit_rates* best_bit_rates = allocate_type_array<transform_bit_rates>(context.allocator, context.num_bones);
+			uint8_t* bone_chain_permutation = allocate_type_array<uint8_t>(*context.scratch_allocator, context.num_bones);
+			transform_bit_rates* permutation_bit_rates = allocate_type_array<transform_bit_rates>(*context.scratch_allocator, context.num_bones);
+			transform_bit_rates* best_permutation_bit_rates = allocate_type_array<transform_bit_rates>(*context.scratch_allocator, context.num_bones);
+			transform_bit_rates* best_bit_rates = allocate_type_array<transform_bit_rates>(*context.scratch_allocator, context.num_bones);
 			std::memcpy(best_bit_rates, context.bit_rate_per_bone, sizeof(transform_bit_rates) * context.num_bones);
 
 			// Iterate from the root transforms first
@@ -1516,10 +1906,111 @@ namespace acl
 			}
 #endif
 
-			deallocate_type_array(context.allocator, bone_chain_permutation, num_bones);
-			deallocate_type_array(context.allocator, permutation_bit_rates, num_bones);
-			deallocate_type_array(context.allocator, best_permutation_bit_rates, num_bones);
-			deallocate_type_array(context.allocator, best_bit_rates, num_bones);
+			deallocate_type_array(*context.scratch_allocator, bone_chain_permutation, num_bones);
+			deallocate_type_array(*context.scratch_allocator, permutation_bit_rates, num_bones);
+			deallocate_type_array(*context.scratch_allocator, best_permutation_bit_rates, num_bones);
+			deallocate_type_array(*context.scratch_allocator, best_bit_rates, num_bones);
+		}
+
+		inline uint32_t get_animated_sub_track_bit_size(bool is_variable, uint8_t bit_rate, uint32_t fixed_sample_size)
+		{
+			if (!is_variable)
+				return fixed_sample_size * 8;
+
+			return get_num_bits_at_bit_rate(bit_rate) * 3;	// 3 components
+		}
+
+		// Raises the bit rate of every animated sub-track to 8 or 16 bits per component (or full precision)
+		// when the animated pose of the segment grows by no more than the provided proportion.
+		// Every animated sample then starts on a byte boundary and can be unpacked with aligned loads.
+		// Returns true if the bit rates were raised.
+		inline bool snap_to_byte_aligned_bit_rates(quantization_context& context, float size_threshold)
+		{
+			ACL_ASSERT(context.is_valid(), "quantization_context isn't valid");
+
+			const bool is_rotation_variable = is_rotation_format_variable(context.rotation_format);
+			const bool is_translation_variable = is_vector_format_variable(context.translation_format);
+			const bool is_scale_variable = is_vector_format_variable(context.scale_format);
+
+			const uint32_t rotation_sample_size = is_rotation_variable ? 0 : get_packed_rotation_size(context.rotation_format);
+			const uint32_t translation_sample_size = is_translation_variable ? 0 : get_packed_vector_size(context.translation_format);
+			const uint32_t scale_sample_size = is_scale_variable ? 0 : get_packed_vector_size(context.scale_format);
+
+			const uint32_t num_bones = context.num_bones;
+			const segment_context& segment = *context.segment;
+
+			uint32_t num_animated_pose_bits = 0;
+			uint32_t num_byte_aligned_pose_bits = 0;
+
+			for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				const transform_streams& bone_stream = segment.bone_streams[bone_index];
+				const transform_bit_rates& bone_bit_rate = context.bit_rate_per_bone[bone_index];
+
+				if (!bone_stream.is_rotation_constant)
+				{
+					num_animated_pose_bits += get_animated_sub_track_bit_size(is_rotation_variable, bone_bit_rate.rotation, rotation_sample_size);
+					num_byte_aligned_pose_bits += get_animated_sub_track_bit_size(is_rotation_variable, get_byte_aligned_bit_rate(bone_bit_rate.rotation), rotation_sample_size);
+				}
+
+				if (!bone_stream.is_translation_constant)
+				{
+					num_animated_pose_bits += get_animated_sub_track_bit_size(is_translation_variable, bone_bit_rate.translation, translation_sample_size);
+					num_byte_aligned_pose_bits += get_animated_sub_track_bit_size(is_translation_variable, get_byte_aligned_bit_rate(bone_bit_rate.translation), translation_sample_size);
+				}
+
+				if (context.has_scale && !bone_stream.is_scale_constant)
+				{
+					num_animated_pose_bits += get_animated_sub_track_bit_size(is_scale_variable, bone_bit_rate.scale, scale_sample_size);
+					num_byte_aligned_pose_bits += get_animated_sub_track_bit_size(is_scale_variable, get_byte_aligned_bit_rate(bone_bit_rate.scale), scale_sample_size);
+				}
+			}
+
+			if (num_byte_aligned_pose_bits == num_animated_pose_bits)
+				return false;	// Already byte aligned, nothing to do
+
+			const float size_increase = float(num_byte_aligned_pose_bits - num_animated_pose_bits) / float(num_animated_pose_bits);
+			if (size_increase > size_threshold)
+				return false;	// Too large, retain our optimal bit rates
+
+			transform_bit_rates* optimal_bit_rates = allocate_type_array<transform_bit_rates>(*context.scratch_allocator, num_bones);
+			std::memcpy(optimal_bit_rates, context.bit_rate_per_bone, sizeof(transform_bit_rates) * num_bones);
+
+			for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				transform_bit_rates& bone_bit_rate = context.bit_rate_per_bone[bone_index];
+				bone_bit_rate.rotation = get_byte_aligned_bit_rate(bone_bit_rate.rotation);
+				bone_bit_rate.translation = get_byte_aligned_bit_rate(bone_bit_rate.translation);
+				bone_bit_rate.scale = get_byte_aligned_bit_rate(bone_bit_rate.scale);
+			}
+
+			// Higher bit rates have a lower quantization error bound but the error of a particular sample
+			// can still increase. Make sure every transform that met its precision still does.
+			bool is_error_too_high = false;
+			for (uint32_t bone_index = 0; bone_index < num_bones && !is_error_too_high; ++bone_index)
+			{
+				const float error_threshold = context.shell_metadata_per_transform[bone_index].precision;
+
+				context.num_bones_in_chain = calculate_bone_chain_indices(context.clip, bone_index, context.chain_bone_indices);
+
+				if (calculate_max_error_at_bit_rate_object(context, bone_index, error_scan_stop_condition::until_error_too_high) < error_threshold)
+					continue;
+
+				// Our optimal bit rates might not have met the precision either, allow the snapped bit rates if they do no worse
+				const float error = calculate_max_error_at_bit_rate_object(context, bone_index, error_scan_stop_condition::until_end_of_segment);
+				std::swap(context.bit_rate_per_bone, optimal_bit_rates);
+				const float optimal_error = calculate_max_error_at_bit_rate_object(context, bone_index, error_scan_stop_condition::until_end_of_segment);
+				std::swap(context.bit_rate_per_bone, optimal_bit_rates);
+
+				is_error_too_high = optimal_error < error_threshold || error > optimal_error;
+			}
+
+			if (is_error_too_high)
+				std::memcpy(context.bit_rate_per_bone, optimal_bit_rates, sizeof(transform_bit_rates) * num_bones);
+
+			deallocate_type_array(*context.scratch_allocator, optimal_bit_rates, num_bones);
+
+			return !is_error_too_high;
 		}
 
 		// Partitioning will be done as follow in two phases: calculating the error contribution for every frame and a global optimization pass.
@@ -1558,19 +2049,24 @@ namespace acl
 
 		inline void find_contributing_error(quantization_context& context)
 		{
-			ACL_ASSERT(context.num_samples <= 32, "Expected no more than 32 samples per track");
+			// Segments have no more than 32 frames when we calculate the contributing error, see compress_transform_track_list
+			// Our retained frame bit set and the scratch arrays below are sized with it
+			constexpr uint32_t k_max_num_segment_frames = 32;
+
+			ACL_ASSERT(context.num_samples <= k_max_num_segment_frames, "Expected no more than %u samples per track", k_max_num_segment_frames);
 
 			if (context.segment->contributing_error == nullptr)
-				context.segment->contributing_error = allocate_type_array<keyframe_stripping_metadata_t>(context.allocator, 32);	// Always no more than 32 frames per segment
+				context.segment->contributing_error = allocate_type_array<keyframe_stripping_metadata_t>(context.allocator, k_max_num_segment_frames);
 
 			const uint32_t num_frames = context.num_samples;
 			const uint32_t num_bones = context.num_bones;
 			const uint32_t segment_index = context.segment->segment_index;
-			const bitset_description desc = bitset_description::make_from_num_bits<32>();
+			const bitset_description desc = bitset_description::make_from_num_bits<k_max_num_segment_frames>();
 			constexpr float infinity = std::numeric_limits<float>::infinity();
 
 			keyframe_stripping_metadata_t* contributing_error = context.segment->contributing_error;
 			uint32_t frames_retained = ~0U;	// By default, every frame is present
+			static_assert(sizeof(frames_retained) * 8 >= k_max_num_segment_frames, "Retained frame bit set is too small");
 
 			// First and last frame of the segment cannot be removed and thus contribute infinite error
 			// TODO: We could retain only the first/last frames of the clip instead but it would mean interpolating
@@ -1633,116 +2129,150 @@ namespace acl
 			context.all_local_query.build(context.bit_rate_per_bone);
 			// END OF ERROR METRIC STUFF
 
-			// We iterate until every frame but the first and last have been removed
-			for (uint32_t iteration_count = 1; iteration_count < num_frames - 1; ++iteration_count)
+			// Calculates how much error a frame contributes if we remove it given the frames currently retained.
+			// Its error only depends on its retained neighbors and on the frames already removed in between them.
+			auto calculate_contributing_error = [&](uint32_t frame_index, bool& out_is_keyframe_trivial)
 			{
-				keyframe_stripping_metadata_t best_error(~0U, segment_index, ~0U, infinity, false);
+				// Find the first frame before the current one that is retained, it'll be our interpolation start point
+				uint32_t interp_start_frame_index = frame_index - 1;
+				while (!bitset_test(&frames_retained, desc, interp_start_frame_index))
+					interp_start_frame_index--;	// This frame isn't being retained, skip it
 
-#if ACL_IMPL_DEBUG_CONTRIBUTING_ERROR
-				printf("Contributing error for segment %u (%u frames), iteration %u ...\n", context.segment->segment_index, num_frames, iteration_count);
-#endif
+				// Find the first frame after the current one that is retained, it'll be out interpolation end point
+				uint32_t interp_end_frame_index = frame_index + 1;
+				while (!bitset_test(&frames_retained, desc, interp_end_frame_index))
+					interp_end_frame_index++;	// This frame isn't being retained, skip it
+
+				// The sample time is calculated from the full clip duration to be consistent with decompression
+				const float interp_start_time = rtm::scalar_min(float(interp_start_frame_index + segment_sample_start_index) / sample_rate, clip_duration);
+				const float interp_end_time = rtm::scalar_min(float(interp_end_frame_index + segment_sample_start_index) / sample_rate, clip_duration);
 
-				// Calculate how much error each frame contributes as we remove them, skip the first and last
-				for (uint32_t frame_index = 1; frame_index < num_frames - 1; ++frame_index)
+				// We'll calculate the resulting error on every frame already removed that lives in between the remaining
+				// two interpolation frames.
+				context.bit_rate_database.sample(context.all_local_query, interp_start_time, lossy_transforms_start, num_bones);
+				context.bit_rate_database.sample(context.all_local_query, interp_end_time, lossy_transforms_end, num_bones);
+
+				// We'll retain the worst error as the current frame's contributing error.
+				rtm::scalarf max_contributing_error = rtm::scalar_set(0.0F);
+				bool is_keyframe_trivial = true;
+
+				for (uint32_t interp_frame_index = interp_start_frame_index + 1; interp_frame_index < interp_end_frame_index; ++interp_frame_index)
 				{
-					// We'll attempt to remove the current frame if it hasn't been removed already
-					if (!bitset_test(&frames_retained, desc, frame_index))
-						continue;	// This frame has already been removed, skip it
+					// Calculate our interpolation alpha
+					const float interpolation_alpha = find_linear_interpolation_alpha(float(interp_frame_index), interp_start_frame_index, interp_end_frame_index, sample_rounding_policy::none, sample_looping_policy::clamp);
 
-					// Find the first frame before the current one that is retained, it'll be our interpolation start point
-					uint32_t interp_start_frame_index = frame_index - 1;
-					while (!bitset_test(&frames_retained, desc, interp_start_frame_index))
-						interp_start_frame_index--;	// This frame isn't being retained, skip it
+					// Interpolate our transforms in local space before we convert or apply the additive and transform to object space
+					for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+					{
+						// TODO: Implement qvv_lerp(..)
+						const rtm::quatf interp_rotation = rtm::quat_lerp(lossy_transforms_start[bone_index].rotation, lossy_transforms_end[bone_index].rotation, interpolation_alpha);
+						const rtm::vector4f interp_translation = rtm::vector_lerp(lossy_transforms_start[bone_index].translation, lossy_transforms_end[bone_index].translation, interpolation_alpha);
+						const rtm::vector4f interp_scale = rtm::vector_lerp(lossy_transforms_start[bone_index].scale, lossy_transforms_end[bone_index].scale, interpolation_alpha);
 
-					// Find the first frame after the current one that is retained, it'll be out interpolation end point
-					uint32_t interp_end_frame_index = frame_index + 1;
-					while (!bitset_test(&frames_retained, desc, interp_end_frame_index))
-						interp_end_frame_index++;	// This frame isn't being retained, skip it
+						context.lossy_local_pose[bone_index] = rtm::qvv_set(interp_rotation, interp_translation, interp_scale);
+					}
 
-					// TODO: We could cache the contributing error and only invalidate it when we remove a frame
+					// Convert to our object space representation
+					if (needs_conversion)
+					{
+						convert_transforms_args_lossy.sample_index = interp_frame_index;
+						convert_transforms_impl(error_metric, convert_transforms_args_lossy, context.local_transforms_converted);
+					}
 
-					// The sample time is calculated from the full clip duration to be consistent with decompression
-					const float interp_start_time = rtm::scalar_min(float(interp_start_frame_index + segment_sample_start_index) / sample_rate, clip_duration);
-					const float interp_end_time = rtm::scalar_min(float(interp_end_frame_index + segment_sample_start_index) / sample_rate, clip_duration);
+					if (has_additive_base)
+					{
+						apply_additive_to_base_args_lossy.base_transforms = base_transforms + (interp_frame_index * sample_transform_size);
+
+						apply_additive_to_base_impl(error_metric, apply_additive_to_base_args_lossy, context.lossy_local_pose);
+					}
 
-					// We'll calculate the resulting error on every frame already removed that lives in between the remaining
-					// two interpolation frames.
-					context.bit_rate_database.sample(context.all_local_query, interp_start_time, lossy_transforms_start, num_bones);
-					context.bit_rate_database.sample(context.all_local_query, interp_end_time, lossy_transforms_end, num_bones);
+					local_to_object_space_impl(error_metric, local_to_object_space_args_lossy, context.lossy_object_pose);
 
-					// We'll retain the worst error as the current frame's contributing error.
-					rtm::scalarf max_contributing_error = rtm::scalar_set(0.0F);
-					bool is_keyframe_trivial = true;
+					// Calculate our error
+					const uint8_t* raw_frame_transform = raw_transform + (interp_frame_index * sample_transform_size);
 
-					for (uint32_t interp_frame_index = interp_start_frame_index + 1; interp_frame_index < interp_end_frame_index; ++interp_frame_index)
+					for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
 					{
-						// Calculate our interpolation alpha
-						const float interpolation_alpha = find_linear_interpolation_alpha(float(interp_frame_index), interp_start_frame_index, interp_end_frame_index, sample_rounding_policy::none, sample_looping_policy::clamp);
+						itransform_error_metric::calculate_error_args calculate_error_args;
+						calculate_error_args.transform0 = raw_frame_transform + (bone_index * context.metric_transform_size);
+						calculate_error_args.transform1 = context.lossy_object_pose + (bone_index * context.metric_transform_size);
 
-						// Interpolate our transforms in local space before we convert or apply the additive and transform to object space
-						for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
-						{
-							// TODO: Implement qvv_lerp(..)
-							const rtm::quatf interp_rotation = rtm::quat_lerp(lossy_transforms_start[bone_index].rotation, lossy_transforms_end[bone_index].rotation, interpolation_alpha);
-							const rtm::vector4f interp_translation = rtm::vector_lerp(lossy_transforms_start[bone_index].translation, lossy_transforms_end[bone_index].translation, interpolation_alpha);
-							const rtm::vector4f interp_scale = rtm::vector_lerp(lossy_transforms_start[bone_index].scale, lossy_transforms_end[bone_index].scale, interpolation_alpha);
+						const rigid_shell_metadata_t& transform_shell = context.shell_metadata_per_transform[bone_index];
+						calculate_error_args.construct_sphere_shell(transform_shell.local_shell_distance);
 
-							context.lossy_local_pose[bone_index] = rtm::qvv_set(interp_rotation, interp_translation, interp_scale);
-						}
+#if defined(RTM_COMPILER_MSVC) && defined(RTM_ARCH_X86) && RTM_COMPILER_MSVC == RTM_COMPILER_MSVC_2015
+						// VS2015 fails to generate the right x86 assembly, branch instead
+						(void)calculate_error_impl;
+						const rtm::scalarf error = context.has_scale ? error_metric->calculate_error(calculate_error_args) : error_metric->calculate_error_no_scale(calculate_error_args);
+#else
+						const rtm::scalarf error = calculate_error_impl(error_metric, calculate_error_args);
+#endif
 
-						// Convert to our object space representation
-						if (needs_conversion)
-						{
-							convert_transforms_args_lossy.sample_index = interp_frame_index;
-							convert_transforms_impl(error_metric, convert_transforms_args_lossy, context.local_transforms_converted);
-						}
+						max_contributing_error = rtm::scalar_max(max_contributing_error, error);
+						is_keyframe_trivial &= rtm::scalar_cast(error) <= transform_shell.precision;
+					}
+				}
 
-						if (has_additive_base)
-						{
-							apply_additive_to_base_args_lossy.base_transforms = base_transforms + (interp_frame_index * sample_transform_size);
+				const float max_contributing_errorf = rtm::scalar_cast(max_contributing_error);
 
-							apply_additive_to_base_impl(error_metric, apply_additive_to_base_args_lossy, context.lossy_local_pose);
-						}
+#if ACL_IMPL_DEBUG_CONTRIBUTING_ERROR
+				printf("    Error between frame [%u, %u] while testing %u: %f\n", interp_start_frame_index, interp_end_frame_index, frame_index, max_contributing_errorf);
+#endif
 
-						local_to_object_space_impl(error_metric, local_to_object_space_args_lossy, context.lossy_object_pose);
+				out_is_keyframe_trivial = is_keyframe_trivial;
+				return max_contributing_errorf;
+			};
 
-						// Calculate our error
-						const uint8_t* raw_frame_transform = raw_transform + (interp_frame_index * sample_transform_size);
+			// Removing a frame only changes the contributing error of its two retained neighbors.
+			// We cache the error of every frame in a min-heap and only re-evaluate the neighbors of each
+			// frame we remove. Stale heap entries are skipped lazily when popped.
+			// Ties are broken by frame index to remove frames in the same order as an exhaustive search would.
+			struct heap_entry
+			{
+				float error;
+				uint32_t frame_index;
+				uint32_t generation;
+				bool is_keyframe_trivial;
+			};
 
-						for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
-						{
-							itransform_error_metric::calculate_error_args calculate_error_args;
-							calculate_error_args.transform0 = raw_frame_transform + (bone_index * context.metric_transform_size);
-							calculate_error_args.transform1 = context.lossy_object_pose + (bone_index * context.metric_transform_size);
+			auto heap_predicate = [](const heap_entry& lhs, const heap_entry& rhs) { return lhs.error > rhs.error || (lhs.error == rhs.error && lhs.frame_index > rhs.frame_index); };
 
-							const rigid_shell_metadata_t& transform_shell = context.shell_metadata_per_transform[bone_index];
-							calculate_error_args.construct_sphere_shell(transform_shell.local_shell_distance);
+			// We push every frame once, then at most two neighbors for every frame removed
+			heap_entry heap[k_max_num_segment_frames * 3];
+			uint32_t num_heap_entries = 0;
+			uint32_t frame_generations[k_max_num_segment_frames] = { 0 };
 
-#if defined(RTM_COMPILER_MSVC) && defined(RTM_ARCH_X86) && RTM_COMPILER_MSVC == RTM_COMPILER_MSVC_2015
-							// VS2015 fails to generate the right x86 assembly, branch instead
-							(void)calculate_error_impl;
-							const rtm::scalarf error = context.has_scale ? error_metric->calculate_error(calculate_error_args) : error_metric->calculate_error_no_scale(calculate_error_args);
-#else
-							const rtm::scalarf error = calculate_error_impl(error_metric, calculate_error_args);
-#endif
+			auto push_frame = [&](uint32_t frame_index)
+			{
+				bool is_keyframe_trivial = true;
+				const float error = calculate_contributing_error(frame_index, is_keyframe_trivial);
 
-							max_contributing_error = rtm::scalar_max(max_contributing_error, error);
-							is_keyframe_trivial &= rtm::scalar_cast(error) <= transform_shell.precision;
-						}
-					}
+				ACL_ASSERT(num_heap_entries < get_array_size(heap), "Too many heap entries");
+				heap[num_heap_entries++] = heap_entry{ error, frame_index, frame_generations[frame_index], is_keyframe_trivial };
+				std::push_heap(heap, heap + num_heap_entries, heap_predicate);
+			};
 
-					const float max_contributing_errorf = rtm::scalar_cast(max_contributing_error);
+			// Calculate how much error each frame contributes, skip the first and last
+			for (uint32_t frame_index = 1; frame_index < num_frames - 1; ++frame_index)
+				push_frame(frame_index);
 
+			// We iterate until every frame but the first and last have been removed
+			for (uint32_t iteration_count = 1; iteration_count < num_frames - 1; ++iteration_count)
+			{
 #if ACL_IMPL_DEBUG_CONTRIBUTING_ERROR
-					printf("    Error between frame [%u, %u] while testing %u: %f\n", interp_start_frame_index, interp_end_frame_index, frame_index, max_contributing_errorf);
+				printf("Contributing error for segment %u (%u frames), iteration %u ...\n", context.segment->segment_index, num_frames, iteration_count);
 #endif
 
-					// If our current frame's contributing error is lowest, it is the best candidate for removal
-					if (max_contributing_errorf < best_error.stripping_error)
-						best_error = keyframe_stripping_metadata_t(frame_index, segment_index, iteration_count - 1, max_contributing_errorf, is_keyframe_trivial);
-				}
+				// Find the frame with the lowest contributing error, skipping stale entries
+				heap_entry best_entry;
+				do
+				{
+					ACL_ASSERT(num_heap_entries != 0, "Failed to find the best contributing error");
+					std::pop_heap(heap, heap + num_heap_entries, heap_predicate);
+					best_entry = heap[--num_heap_entries];
+				} while (!bitset_test(&frames_retained, desc, best_entry.frame_index) || best_entry.generation != frame_generations[best_entry.frame_index]);
 
-				ACL_ASSERT(best_error.keyframe_index != ~0U, "Failed to find the best contributing error");
+				const keyframe_stripping_metadata_t best_error(best_entry.frame_index, segment_index, iteration_count - 1, best_entry.error, best_entry.is_keyframe_trivial);
 
 #if ACL_IMPL_DEBUG_CONTRIBUTING_ERROR
 				printf("    Best frame to remove: %u (%f)\n", best_error.keyframe_index, best_error.stripping_error);
@@ -1751,6 +2281,27 @@ namespace acl
 				// We found the best frame to remove, remove it
 				contributing_error[best_error.keyframe_index] = best_error;
 				bitset_set(&frames_retained, desc, best_error.keyframe_index, false);
+
+				// Its retained neighbors now interpolate over a larger range, update them
+				uint32_t prev_frame_index = best_error.keyframe_index - 1;
+				while (!bitset_test(&frames_retained, desc, prev_frame_index))
+					prev_frame_index--;
+
+				uint32_t next_frame_index = best_error.keyframe_index + 1;
+				while (!bitset_test(&frames_retained, desc, next_frame_index))
+					next_frame_index++;
+
+				if (prev_frame_index != 0)
+				{
+					frame_generations[prev_frame_index]++;
+					push_frame(prev_frame_index);
+				}
+
+				if (next_frame_index != num_frames - 1)
+				{
+					frame_generations[next_frame_index]++;
+					push_frame(next_frame_index);
+				}
 			}
 
 			// We found the contributing error for every keyframe, sort them by the order they should be stripped from this segment
@@ -1814,6 +2365,8 @@ namespace acl
 			const output_stats& out_stats,
 			compression_stats_t& compression_stats)
 		{
+			ACL_PROFILE_SCOPE("acl::quantize_streams");
+
 			(void)out_stats;
 			(void)compression_stats;
 
@@ -1822,6 +2375,7 @@ namespace acl
 
 #if defined(ACL_USE_SJSON)
 			scope_profiler bit_rate_optimization_time;
+			scope_stage_memory_tracker bit_rate_optimization_memory(compression_stats, compression_stats.bit_rate_optimization_memory);
 #endif
 
 			const bool is_rotation_variable = is_rotation_format_variable(settings.rotation_format);
@@ -1831,6 +2385,17 @@ namespace acl
 
 			quantization_context context(allocator, clip, raw_clip_context, additive_base_clip_context, settings);
 
+			// Bone chain permutations can optionally be evaluated on multiple threads, the resulting bit rates are identical
+			const uint32_t num_threads = is_any_variable ? get_num_bit_rate_optimization_threads(settings) : 1;
+			if (num_threads > 1)
+				context.permutation_search = allocate_type<parallel_permutation_search>(allocator, context, additive_base_clip_context, settings, num_threads);
+
+			// Scratch memory used while optimizing a segment is carved out of an arena that we reset once the segment is done.
+			// Only the main thread allocates from it, worker jobs never do. The block holds what a segment needs for the common case.
+			const size_t scratch_block_size = (sizeof(uint8_t) + sizeof(transform_bit_rates) * 5) * clip.num_bones + 1024;
+			arena_allocator scratch_allocator(allocator, scratch_block_size);
+			context.scratch_allocator = &scratch_allocator;
+
 			for (segment_context& segment : clip.segment_iterator())
 			{
 #if ACL_IMPL_DEBUG_VARIABLE_QUANTIZATION >= ACL_IMPL_DEBUG_LEVEL_SUMMARY_ONLY
@@ -1845,6 +2410,9 @@ namespace acl
 					{
 						context.set_segment(segment);
 
+						if (context.permutation_search != nullptr)
+							context.permutation_search->set_segment(segment);
+
 						if (is_any_variable)
 							find_optimal_bit_rates(context);
 					}
@@ -1861,18 +2429,39 @@ namespace acl
 
 				context.set_segment(segment);
 
+				if (context.permutation_search != nullptr)
+					context.permutation_search->set_segment(segment);
+
 				// If we use a variable bit rate, run our optimization algorithm to find the optimal bit rates
 				if (is_any_variable)
+				{
 					find_optimal_bit_rates(context);
 
+					// Trade a bit of memory for faster decompression if requested
+					if (settings.enable_byte_aligned_bit_rates)
+						snap_to_byte_aligned_bit_rates(context, settings.byte_aligned_bit_rate_size_threshold);
+				}
+
 				// If we need the contributing error of each frame, find it now before we quantize
 				if (settings.metadata.include_contributing_error)
 					find_contributing_error(context);
 
 				// Quantize our streams now that we found the optimal bit rates
 				quantize_all_streams(context);
+
+				scratch_allocator.reset();
 			}
 
+#if defined(ACL_USE_SJSON)
+			compression_stats.bit_rate_optimization_scratch_high_water_mark = scratch_allocator.get_high_water_mark();
+#endif
+
+			context.scratch_allocator = &allocator;
+			scratch_allocator.release();
+
+			deallocate_type(allocator, context.permutation_search);
+			context.permutation_search = nullptr;
+
 			// If we need the contributing error of each keyframe, sort them for the whole clip
 			if (settings.metadata.include_contributing_error)
 				sort_contributing_error(allocator, clip);
@@ -1886,6 +2475,13 @@ namespace acl
 			{
 				sjson::ObjectWriter& writer = *out_stats.writer;
 				writer["track_bit_rate_database_size"] = static_cast<uint32_t>(context.bit_rate_database.get_allocated_size());
+				writer["track_bit_rate_database_num_bit_rates_cached"] = context.bit_rate_database.get_num_bit_rates_cached_per_track();
+
+				const track_bit_rate_database_stats& database_stats = context.bit_rate_database.get_stats();
+				writer["track_bit_rate_database_entry_hits"] = database_stats.num_entry_hits;
+				writer["track_bit_rate_database_entry_misses"] = database_stats.num_entry_misses;
+				writer["track_bit_rate_database_sample_hits"] = database_stats.num_sample_hits;
+				writer["track_bit_rate_database_sample_misses"] = database_stats.num_sample_misses;
 
 				size_t transform_cache_size = 0;
 				transform_cache_size += sizeof(rtm::qvvf) * context.num_bones;	// raw_local_pose
@@ -1893,6 +2489,7 @@ namespace acl
 				transform_cache_size += context.metric_transform_size * context.num_bones;	// lossy_object_pose
 				transform_cache_size += context.metric_transform_size * context.num_bones * context.clip.segments->num_samples;	// raw_local_transforms
 				transform_cache_size += context.metric_transform_size * context.num_bones * context.clip.segments->num_samples;	// raw_object_transforms
+				transform_cache_size += context.metric_transform_size * context.num_bones * context.clip.segments->num_samples;	// lossy_object_transforms
 
 				if (context.needs_conversion)
 					transform_cache_size += context.metric_transform_size * context.num_bones;	// local_transforms_converted
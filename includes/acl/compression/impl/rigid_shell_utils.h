@@ -26,6 +26,7 @@
 
 #include "acl/version.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/profiling.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/compression/impl/clip_context.h"
 #include "acl/compression/impl/sample_streams.h"
@@ -53,6 +54,8 @@ namespace acl
 			const clip_adapter_t& raw_clip,
 			const clip_adapter_t& additive_base_clip)
 		{
+			ACL_PROFILE_SCOPE("acl::compute_clip_shell_distances");
+
 			static_assert(std::is_base_of<transform_clip_adapter_t, clip_adapter_t>::value, "Clip adapter must derive from transform_clip_adapter_t");
 
 			const uint32_t num_transforms = raw_clip.get_num_transforms();
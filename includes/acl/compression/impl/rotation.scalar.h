@@ -0,0 +1,120 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/track_desc.h"
+#include "acl/core/track_types.h"
+#include "acl/core/profiling.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/track.h"
+#include "acl/compression/track_array.h"
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Quaternion tracks are compressed as float3f tracks. Their rotations are normalized
+		// and made to have a positive W component which allows us to drop it. It is
+		// reconstructed during decompression.
+		//////////////////////////////////////////////////////////////////////////
+		inline track_array pack_quatf_track_list(iallocator& allocator, const track_array& track_list)
+		{
+			ACL_PROFILE_SCOPE("acl::pack_quatf_track_list");
+
+			ACL_ASSERT(track_list.get_track_type() == track_type8::quatf, "Expected quatf tracks");
+
+			const track_array_quatf& quatf_track_list = track_array_cast<track_array_quatf>(track_list);
+			const uint32_t num_tracks = track_list.get_num_tracks();
+			const uint32_t num_samples = track_list.get_num_samples_per_track();
+			const float sample_rate = track_list.get_sample_rate();
+
+			track_array out_track_list(allocator, num_tracks);
+			out_track_list.set_name(track_list.get_name());
+			out_track_list.set_looping_policy(track_list.get_looping_policy());
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const track_quatf& ref_track = quatf_track_list[track_index];
+				track_float3f track = track_float3f::make_reserve(ref_track.get_description(), allocator, num_samples, sample_rate);
+
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				{
+					const rtm::quatf rotation = rtm::quat_ensure_positive_w(rtm::quat_normalize(ref_track[sample_index]));
+					rtm::vector_store3(rtm::quat_to_vector(rotation), &track[sample_index]);
+				}
+
+				out_track_list[track_index] = std::move(track);
+			}
+
+			return out_track_list;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reconstructs a rotation from its packed X, Y, and Z components.
+		// Quantization can leave us slightly off the unit sphere, we always normalize.
+		//////////////////////////////////////////////////////////////////////////
+		inline rtm::quatf RTM_SIMD_CALL unpack_packed_quatf(rtm::vector4f_arg0 rotation_xyz)
+		{
+			return rtm::quat_normalize(rtm::quat_from_positive_w(rotation_xyz));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the angle in radians between two rotations.
+		// We use the half angle tangent which remains accurate for small angles unlike
+		// the arc cosine of the W component.
+		//////////////////////////////////////////////////////////////////////////
+		inline float RTM_SIMD_CALL calculate_quatf_error(rtm::quatf_arg0 raw_rotation, rtm::quatf_arg1 lossy_rotation)
+		{
+			const rtm::quatf delta = rtm::quat_mul(rtm::quat_conjugate(raw_rotation), lossy_rotation);
+
+			const float sin_half_angle = rtm::vector_length3(rtm::quat_to_vector(delta));
+			const float cos_half_angle = rtm::scalar_abs(rtm::quat_get_w(delta));
+			return 2.0F * rtm::scalar_atan2(sin_half_angle, cos_half_angle);
+		}
+
+		// Returns the angle in radians between two packed rotations
+		inline float RTM_SIMD_CALL calculate_packed_quatf_error(rtm::vector4f_arg0 raw_rotation_xyz, rtm::vector4f_arg1 lossy_rotation_xyz)
+		{
+			return calculate_quatf_error(unpack_packed_quatf(raw_rotation_xyz), unpack_packed_quatf(lossy_rotation_xyz));
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,110 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/profiling.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/impl/segment.transform.h"
+#include "acl/compression/impl/segment_context.h"
+#include "acl/compression/impl/track_list_context.h"
+
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Splits our samples into segments using the same heuristic as transform tracks.
+		// We always have at least one segment. When segmenting is disabled or when we
+		// have too few samples, a single segment spans every sample and its ranges are
+		// the identity. Such a segment isn't stored in the compressed data.
+		//////////////////////////////////////////////////////////////////////////
+		inline void segment_tracks(track_list_context& context, bool enable_segmenting)
+		{
+			ACL_PROFILE_SCOPE("acl::segment_tracks");
+
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+			ACL_ASSERT(context.num_segments == 0, "Tracks already segmented");
+
+			uint32_t num_estimated_segments = 0;
+			uint32_t num_segments = 0;
+			uint32_t* num_samples_per_segment = nullptr;
+
+			if (enable_segmenting)
+			{
+				compression_segmenting_settings settings;
+				num_samples_per_segment = split_samples_per_segment(*context.allocator, context.num_samples, settings, num_estimated_segments, num_segments);
+			}
+
+			if (num_samples_per_segment == nullptr)
+			{
+				// A single segment with every sample
+				context.segment_start_sample_indices = allocate_type_array<uint32_t>(*context.allocator, 1);
+				context.segment_start_sample_indices[0] = 0;
+				context.num_segments = 1;
+				context.has_segments = false;
+			}
+			else
+			{
+				context.segment_start_sample_indices = allocate_type_array<uint32_t>(*context.allocator, num_segments);
+				context.num_segments = num_segments;
+				context.has_segments = true;
+
+				uint32_t start_sample_index = 0;
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					context.segment_start_sample_indices[segment_index] = start_sample_index;
+					start_sample_index += num_samples_per_segment[segment_index];
+				}
+
+				ACL_ASSERT(start_sample_index == context.num_samples, "Segments do not span every sample");
+
+				deallocate_type_array(*context.allocator, num_samples_per_segment, num_estimated_segments);
+			}
+
+			// Every segment range starts as the identity
+			const size_t num_segment_ranges = size_t(context.num_segments) * context.num_tracks;
+			context.segment_ranges = allocate_type_array<scalar_segment_range>(*context.allocator, num_segment_ranges);
+
+			const rtm::vector4f zero = rtm::vector_zero();
+			const rtm::vector4f one = rtm::vector_set(1.0F);
+			for (size_t range_index = 0; range_index < num_segment_ranges; ++range_index)
+				context.segment_ranges[range_index] = scalar_segment_range{ zero, one };
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -29,6 +29,7 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/error.h"
 #include "acl/core/scope_profiler.h"
+#include "acl/core/profiling.h"
 #include "acl/compression/compression_settings.h"
 #include "acl/compression/impl/clip_context.h"
 #include "acl/compression/impl/compression_stats.h"
@@ -133,6 +134,8 @@ namespace acl
 			const compression_segmenting_settings& settings,
 			compression_stats_t& compression_stats)
 		{
+			ACL_PROFILE_SCOPE("acl::segment_streams");
+
 			ACL_ASSERT(clip.num_segments == 1, "clip_context must have a single segment.");
 			ACL_ASSERT(settings.ideal_num_samples <= settings.max_num_samples, "Invalid num samples for segmenting settings. %u > %u", settings.ideal_num_samples, settings.max_num_samples);
 
@@ -143,6 +146,7 @@ namespace acl
 
 #if defined(ACL_USE_SJSON)
 			scope_profiler segmenting_time;
+			scope_stage_memory_tracker segmenting_memory(compression_stats, compression_stats.segmenting_memory);
 #endif
 
 			// We split our samples over multiple segments, but some might be empty at the end after re-balancing
@@ -177,6 +181,7 @@ namespace acl
 				segment.animated_translation_bit_size = 0;
 				segment.animated_scale_bit_size = 0;
 				segment.animated_pose_bit_size = 0;
+				segment.are_samples_byte_aligned = false;
 				segment.animated_data_size = 0;
 				segment.range_data_size = 0;
 				segment.total_header_size = 0;
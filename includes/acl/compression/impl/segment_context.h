@@ -106,6 +106,7 @@ namespace acl
 			uint32_t animated_translation_bit_size			= 0;		// Tier 0
 			uint32_t animated_scale_bit_size				= 0;		// Tier 0
 			uint32_t animated_pose_bit_size					= 0;		// Tier 0
+			bool are_samples_byte_aligned					= false;	// Whether every animated sample starts on a byte boundary
 			uint32_t animated_data_size						= 0;		// Tier 0
 			uint32_t range_data_size						= 0;
 			uint32_t segment_data_size						= 0;
@@ -0,0 +1,293 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/bitset.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/profiling.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/impl/quantize.scalar.h"
+#include "acl/compression/impl/track_list_context.h"
+
+#include <rtm/mask4f.h>
+#include <rtm/vector4f.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// A track is sparse when at most 1/N of its samples are active
+		constexpr uint32_t k_sparse_track_max_active_sample_ratio = 4;
+
+		// Active spans separated by this many inactive samples or less are merged, a span header costs more than a few samples
+		constexpr uint32_t k_sparse_track_max_span_gap = 4;
+
+		// Returns whether or not a sample is within our precision of the inactive value
+		inline bool is_sparse_sample_inactive(const track& ref_track, uint32_t sample_index, uint32_t inactive_sample_index, const rtm::vector4f& precision, const rtm::mask4f& sample_mask)
+		{
+			using namespace rtm;
+
+			const uint32_t ref_element_size = ref_track.get_sample_size();
+
+			vector4f sample = vector_zero();
+			vector4f inactive_sample = vector_zero();
+			std::memcpy(&sample, ref_track[sample_index], ref_element_size);
+			std::memcpy(&inactive_sample, ref_track[inactive_sample_index], ref_element_size);
+
+			const vector4f delta = vector_abs(vector_sub(sample, inactive_sample));
+			const vector4f masked_delta = vector_select(sample_mask, delta, vector_zero());
+			return vector_all_less_equal(masked_delta, precision);
+		}
+
+		inline uint32_t count_sparse_active_samples(const track& ref_track, uint32_t num_samples, uint32_t inactive_sample_index, const rtm::vector4f& precision, const rtm::mask4f& sample_mask)
+		{
+			uint32_t num_active_samples = 0;
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				if (!is_sparse_sample_inactive(ref_track, sample_index, inactive_sample_index, precision, sample_mask))
+					num_active_samples++;
+			}
+
+			return num_active_samples;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Detects animated tracks that retain the same value, within their precision,
+		// for most of their samples. Such tracks are split into active spans, outside
+		// of which their inactive value is used as-is.
+		// The inactive value is either the first or the last sample, whichever
+		// leaves us with the fewest active samples.
+		//////////////////////////////////////////////////////////////////////////
+		inline void extract_sparse_tracks(track_list_context& context, bool enable_sparse_tracks)
+		{
+			ACL_PROFILE_SCOPE("acl::extract_sparse_tracks");
+
+			using namespace rtm;
+
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			const bitset_description bitset_desc = bitset_description::make_from_num_bits(context.num_tracks);
+			context.sparse_tracks_bitset = allocate_type_array<uint32_t>(*context.allocator, bitset_desc.get_size());
+			bitset_reset(context.sparse_tracks_bitset, bitset_desc, false);
+
+			if (!enable_sparse_tracks || context.num_samples == 0)
+				return;
+
+			context.sparse_tracks = allocate_type_array<sparse_track>(*context.allocator, context.num_tracks);
+
+			const uint32_t num_samples = context.num_samples;
+			const mask4f all_true_mask = mask_set(true, true, true, true);
+
+			for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
+			{
+				if (context.is_constant(track_index))
+					continue;
+
+				const track& ref_track = (*context.reference_list)[track_index];
+				const track_vector4f& mut_track = track_cast<track_vector4f>(context.track_list[track_index]);
+
+				const vector4f precision = vector_load1(&mut_track.get_description().precision);
+				mask4f sample_mask = mask_set(false, false, false, false);
+				std::memcpy(&sample_mask, &all_true_mask, ref_track.get_sample_size());
+
+				const uint32_t last_sample_index = num_samples - 1;
+				const uint32_t num_active_samples_first = count_sparse_active_samples(ref_track, num_samples, 0, precision, sample_mask);
+				const uint32_t num_active_samples_last = count_sparse_active_samples(ref_track, num_samples, last_sample_index, precision, sample_mask);
+
+				const uint32_t inactive_sample_index = num_active_samples_first <= num_active_samples_last ? 0 : last_sample_index;
+				const uint32_t num_active_samples = std::min(num_active_samples_first, num_active_samples_last);
+
+				if (num_active_samples * k_sparse_track_max_active_sample_ratio > num_samples)
+					continue;	// Too many active samples
+
+				// Find our active spans, merging them when they are close
+				uint32_t num_spans = 0;
+				uint32_t span_end_sample_index = 0;
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				{
+					if (is_sparse_sample_inactive(ref_track, sample_index, inactive_sample_index, precision, sample_mask))
+						continue;
+
+					if (num_spans == 0 || sample_index > span_end_sample_index + k_sparse_track_max_span_gap)
+						num_spans++;
+
+					span_end_sample_index = sample_index + 1;
+				}
+
+				sparse_track& sparse = context.sparse_tracks[track_index];
+				sparse.spans = allocate_type_array<sparse_track_span>(*context.allocator, num_spans);
+				sparse.num_spans = num_spans;
+				sparse.inactive_sample_index = inactive_sample_index;
+
+				uint32_t span_index = 0;
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				{
+					if (is_sparse_sample_inactive(ref_track, sample_index, inactive_sample_index, precision, sample_mask))
+						continue;
+
+					if (span_index == 0 || sample_index > span_end_sample_index + k_sparse_track_max_span_gap)
+					{
+						sparse_track_span& span = sparse.spans[span_index++];
+						span.start_sample_index = sample_index;
+						span.num_samples = 0;
+						span.bit_rate = k_invalid_bit_rate;
+					}
+
+					sparse_track_span& span = sparse.spans[span_index - 1];
+					span_end_sample_index = sample_index + 1;
+					span.num_samples = span_end_sample_index - span.start_sample_index;
+				}
+
+				ACL_ASSERT(span_index == num_spans, "Unexpected number of spans");
+
+				bitset_set(context.sparse_tracks_bitset, bitset_desc, track_index, true);
+			}
+		}
+
+		// Normalizes the samples of a span within its range and finds the lowest bit rate that meets our precision
+		inline void quantize_sparse_track_span(track_list_context& context, uint32_t track_index, sparse_track_span& span)
+		{
+			using namespace rtm;
+
+			const track& ref_track = (*context.reference_list)[track_index];
+			track_vector4f& mut_track = track_cast<track_vector4f>(context.track_list[track_index]);
+
+			const vector4f precision = vector_load1(&mut_track.get_description().precision);
+			const uint32_t ref_element_size = ref_track.get_sample_size();
+			const uint32_t start_sample_index = span.start_sample_index;
+			const uint32_t end_sample_index = start_sample_index + span.num_samples;
+
+			const vector4f one = rtm::vector_set(1.0F);
+			const vector4f zero = vector_zero();
+			const mask4f all_true_mask = mask_set(true, true, true, true);
+			mask4f sample_mask = mask_set(false, false, false, false);
+			std::memcpy(&sample_mask, &all_true_mask, ref_element_size);
+
+			// Our mutable track still contains the raw samples, extract our range
+			vector4f range_min = mut_track[start_sample_index];
+			vector4f range_max = range_min;
+			for (uint32_t sample_index = start_sample_index + 1; sample_index < end_sample_index; ++sample_index)
+			{
+				range_min = vector_min(range_min, mut_track[sample_index]);
+				range_max = vector_max(range_max, mut_track[sample_index]);
+			}
+
+			const vector4f range_extent = vector_sub(range_max, range_min);
+			const mask4f is_range_zero_mask = vector_less_than(range_extent, rtm::vector_set(0.000000001F));
+
+			span.range_min = range_min;
+			span.range_extent = range_extent;
+
+			for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; ++sample_index)
+			{
+				vector4f normalized_sample = vector_div(vector_sub(mut_track[sample_index], range_min), range_extent);
+
+				// Clamp because the division might be imprecise
+				normalized_sample = vector_clamp(normalized_sample, zero, one);
+				normalized_sample = vector_select(is_range_zero_mask, zero, normalized_sample);
+
+				mut_track[sample_index] = normalized_sample;
+			}
+
+			vector4f raw_sample = zero;
+			uint8_t best_bit_rate = k_highest_bit_rate;	// Default to raw if we fail to find something better
+
+			// Same search as with animated tracks, every bit rate above the one we find meets our precision
+			for (uint8_t bit_rate = k_highest_bit_rate - 1; bit_rate != 0; --bit_rate)	// Skip the raw bit rate and the constant bit rate
+			{
+				const quantization_scales scales(get_num_bits_at_bit_rate(bit_rate));
+
+				bool is_error_to_high = false;
+				for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; ++sample_index)
+				{
+					std::memcpy(&raw_sample, ref_track[sample_index], ref_element_size);
+
+					const vector4f decayed_normalized_sample = decay_vector4_uXX(mut_track[sample_index], scales);
+					const vector4f decayed_sample = vector_mul_add(decayed_normalized_sample, range_extent, range_min);
+
+					const vector4f delta = vector_abs(vector_sub(raw_sample, decayed_sample));
+					const vector4f masked_delta = vector_select(sample_mask, delta, zero);
+					if (!vector_all_less_equal(masked_delta, precision))
+					{
+						is_error_to_high = true;
+						break;
+					}
+				}
+
+				if (is_error_to_high)
+					break;	// Our error is too high, use the previous bit rate
+
+				best_bit_rate = bit_rate;
+			}
+
+			span.bit_rate = best_bit_rate;
+
+			if (best_bit_rate == k_highest_bit_rate)
+			{
+				// We can't quantize this span, keep it raw
+				for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; ++sample_index)
+					std::memcpy(&mut_track[sample_index], ref_track[sample_index], ref_element_size);
+			}
+			else
+			{
+				const quantization_scales scales(get_num_bits_at_bit_rate(best_bit_rate));
+
+				for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; ++sample_index)
+					mut_track[sample_index] = pack_vector4_uXX(mut_track[sample_index], scales);
+			}
+		}
+
+		inline void quantize_sparse_tracks(track_list_context& context)
+		{
+			ACL_PROFILE_SCOPE("acl::quantize_sparse_tracks");
+
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
+			{
+				if (!context.is_sparse(track_index))
+					continue;
+
+				sparse_track& sparse = context.sparse_tracks[track_index];
+				for (uint32_t span_index = 0; span_index < sparse.num_spans; ++span_index)
+					quantize_sparse_track_span(context, track_index, sparse.spans[span_index]);
+			}
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
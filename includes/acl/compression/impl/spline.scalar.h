@@ -0,0 +1,279 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/profiling.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/spline_key_utils.h"
+#include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/impl/track_list_context.h"
+
+#include <rtm/mask4f.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// The bit rate used by tracks with quantized spline keys
+		constexpr uint8_t k_spline_key_bit_rate = 16;
+
+		static_assert(k_bit_rate_num_bits[k_spline_key_bit_rate] == k_spline_key_num_bits, "Unexpected spline key bit rate");
+
+		inline void quantize_spline_key(rtm::vector4f_arg0 normalized_value, uint32_t num_components, uint16_t* out_quantized_value)
+		{
+			const float max_value = float((1 << k_spline_key_num_bits) - 1);
+
+			float normalized_values[4];
+			rtm::vector_store(normalized_value, &normalized_values[0]);
+
+			for (uint32_t component_index = 0; component_index < 4; ++component_index)
+			{
+				const float quantized_value = component_index < num_components ? rtm::scalar_round_symmetric(normalized_values[component_index] * max_value) : 0.0F;
+				out_quantized_value[component_index] = safe_static_cast<uint16_t>(quantized_value);
+			}
+		}
+
+		// Samples the keys of a block exactly like decompression does
+		inline rtm::vector4f RTM_SIMD_CALL sample_spline_key_block(const spline_key_block& block, float sample_offset)
+		{
+			uint32_t key_indices[4];
+			find_spline_keys(block.sample_offsets, block.num_keys, sample_offset, key_indices);
+
+			const float key_sample_offsets[4] =
+			{
+				float(block.sample_offsets[key_indices[0]]),
+				float(block.sample_offsets[key_indices[1]]),
+				float(block.sample_offsets[key_indices[2]]),
+				float(block.sample_offsets[key_indices[3]]),
+			};
+
+			return interpolate_spline_keys(block.values[key_indices[0]], block.values[key_indices[1]], block.values[key_indices[2]], block.values[key_indices[3]], key_sample_offsets, sample_offset);
+		}
+
+		// Tracks are quantized on 16 bits per component unless it isn't accurate enough, then they are raw
+		inline uint8_t find_spline_key_bit_rate(const track_list_context& context, uint32_t track_index)
+		{
+			using namespace rtm;
+
+			const track& ref_track = (*context.reference_list)[track_index];
+			const track_vector4f& mut_track = track_cast<const track_vector4f>(context.track_list[track_index]);
+
+			const vector4f precision = vector_load1(&mut_track.get_description().precision);
+			const uint32_t ref_element_size = ref_track.get_sample_size();
+			const uint32_t num_components = ref_element_size / sizeof(float);
+
+			const scalarf_range& range = context.range_list[track_index].range.scalarf;
+			const vector4f range_min = range.get_min();
+			const vector4f range_extent = range.get_extent();
+
+			const mask4f all_true_mask = mask_set(true, true, true, true);
+			mask4f sample_mask = mask_set(false, false, false, false);
+			std::memcpy(&sample_mask, &all_true_mask, ref_element_size);
+
+			for (uint32_t sample_index = 0; sample_index < context.num_samples; ++sample_index)
+			{
+				vector4f raw_sample = vector_zero();
+				std::memcpy(&raw_sample, ref_track[sample_index], ref_element_size);
+
+				uint16_t quantized_sample[4];
+				quantize_spline_key(mut_track[sample_index], num_components, &quantized_sample[0]);
+
+				const vector4f decayed_sample = unpack_spline_key_u16(&quantized_sample[0], num_components, range_min, range_extent);
+
+				const vector4f delta = vector_abs(vector_sub(raw_sample, decayed_sample));
+				const vector4f masked_delta = vector_select(sample_mask, delta, vector_zero());
+				if (!vector_all_less_equal(masked_delta, precision))
+					return k_highest_bit_rate;	// Not accurate enough, keep our keys raw
+			}
+
+			return k_spline_key_bit_rate;
+		}
+
+		// Adds a key at the specified sample offset, keys remain sorted
+		inline void insert_spline_key(spline_key_block& block, uint32_t sample_offset, rtm::vector4f_arg0 value, const uint16_t* quantized_value)
+		{
+			uint32_t insert_index = block.num_keys;
+			while (insert_index != 0 && block.sample_offsets[insert_index - 1] > sample_offset)
+			{
+				block.sample_offsets[insert_index] = block.sample_offsets[insert_index - 1];
+				block.values[insert_index] = block.values[insert_index - 1];
+				std::memcpy(&block.quantized_values[insert_index][0], &block.quantized_values[insert_index - 1][0], sizeof(block.quantized_values[0]));
+				insert_index--;
+			}
+
+			block.sample_offsets[insert_index] = safe_static_cast<uint8_t>(sample_offset);
+			block.values[insert_index] = value;
+			std::memcpy(&block.quantized_values[insert_index][0], quantized_value, sizeof(block.quantized_values[0]));
+			block.num_keys++;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Places the keys of a track within a block through error bounded curve fitting.
+		// We start with a key on both edges of the block and we greedily add a key
+		// where the error is the highest until every sample is within our precision.
+		// Keys are exact within our precision which guarantees that this terminates.
+		//////////////////////////////////////////////////////////////////////////
+		inline void fit_spline_track_block(track_list_context& context, uint32_t track_index, uint32_t block_index)
+		{
+			using namespace rtm;
+
+			const track& ref_track = (*context.reference_list)[track_index];
+			const track_vector4f& mut_track = track_cast<const track_vector4f>(context.track_list[track_index]);
+
+			const vector4f precision = vector_load1(&mut_track.get_description().precision);
+			const uint32_t ref_element_size = ref_track.get_sample_size();
+			const uint32_t num_components = ref_element_size / sizeof(float);
+			const bool is_raw = is_raw_bit_rate(context.bit_rate_list[track_index].scalar.value);
+
+			const scalarf_range& range = context.range_list[track_index].range.scalarf;
+			const vector4f range_min = range.get_min();
+			const vector4f range_extent = range.get_extent();
+
+			const mask4f all_true_mask = mask_set(true, true, true, true);
+			mask4f sample_mask = mask_set(false, false, false, false);
+			std::memcpy(&sample_mask, &all_true_mask, ref_element_size);
+
+			const uint32_t first_sample_index = block_index * context.num_samples_per_spline_key_block;
+			const uint32_t last_sample_index = std::min<uint32_t>(first_sample_index + context.num_samples_per_spline_key_block, context.num_samples - 1);
+			const uint32_t num_block_samples = last_sample_index - first_sample_index + 1;
+
+			// Every sample is a key candidate, decode them like decompression would
+			vector4f raw_samples[k_spline_key_max_num_samples_per_block + 1];
+			vector4f decoded_samples[k_spline_key_max_num_samples_per_block + 1];
+			uint16_t quantized_samples[k_spline_key_max_num_samples_per_block + 1][4] = {};
+			bool is_key[k_spline_key_max_num_samples_per_block + 1] = {};
+
+			for (uint32_t sample_offset = 0; sample_offset < num_block_samples; ++sample_offset)
+			{
+				const uint32_t sample_index = first_sample_index + sample_offset;
+
+				raw_samples[sample_offset] = vector_zero();
+				std::memcpy(&raw_samples[sample_offset], ref_track[sample_index], ref_element_size);
+
+				if (is_raw)
+					decoded_samples[sample_offset] = raw_samples[sample_offset];
+				else
+				{
+					quantize_spline_key(mut_track[sample_index], num_components, &quantized_samples[sample_offset][0]);
+					decoded_samples[sample_offset] = unpack_spline_key_u16(&quantized_samples[sample_offset][0], num_components, range_min, range_extent);
+				}
+			}
+
+			spline_key_block& block = context.spline_key_blocks[block_index * context.num_tracks + track_index];
+			block.num_keys = 0;
+
+			// Our edges are always keys
+			const uint32_t last_sample_offset = num_block_samples - 1;
+			insert_spline_key(block, 0, decoded_samples[0], &quantized_samples[0][0]);
+			is_key[0] = true;
+
+			if (last_sample_offset != 0)
+			{
+				insert_spline_key(block, last_sample_offset, decoded_samples[last_sample_offset], &quantized_samples[last_sample_offset][0]);
+				is_key[last_sample_offset] = true;
+			}
+
+			while (true)
+			{
+				float worst_error = 0.0F;
+				uint32_t worst_sample_offset = ~0U;
+
+				for (uint32_t sample_offset = 1; sample_offset < last_sample_offset; ++sample_offset)
+				{
+					if (is_key[sample_offset])
+						continue;	// Keys are within our precision
+
+					const vector4f lossy_sample = sample_spline_key_block(block, float(sample_offset));
+
+					const vector4f delta = vector_abs(vector_sub(raw_samples[sample_offset], lossy_sample));
+					const vector4f masked_delta = vector_select(sample_mask, delta, vector_zero());
+					if (vector_all_less_equal(masked_delta, precision))
+						continue;	// Accurate enough
+
+					float deltas[4];
+					vector_store(masked_delta, &deltas[0]);
+
+					const float error = std::max(std::max(deltas[0], deltas[1]), std::max(deltas[2], deltas[3]));
+					if (worst_sample_offset == ~0U || error > worst_error)
+					{
+						worst_error = error;
+						worst_sample_offset = sample_offset;
+					}
+				}
+
+				if (worst_sample_offset == ~0U)
+					break;	// Every sample is within our precision
+
+				insert_spline_key(block, worst_sample_offset, decoded_samples[worst_sample_offset], &quantized_samples[worst_sample_offset][0]);
+				is_key[worst_sample_offset] = true;
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Used with spline key reduction instead of quantizing every sample.
+		// Selects how the keys of each animated track are stored and places a
+		// variable number of keys per track within each block of samples.
+		// Our tracks must be normalized.
+		//////////////////////////////////////////////////////////////////////////
+		inline void fit_spline_keys(track_list_context& context)
+		{
+			ACL_PROFILE_SCOPE("acl::fit_spline_keys");
+
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			context.bit_rate_list = allocate_type_array<track_bit_rate>(*context.allocator, context.num_tracks);
+			context.num_samples_per_spline_key_block = k_spline_key_max_num_samples_per_block;
+			context.num_spline_key_blocks = calculate_num_spline_key_blocks(context.num_samples, k_spline_key_max_num_samples_per_block);
+			context.spline_key_blocks = allocate_type_array<spline_key_block>(*context.allocator, size_t(context.num_spline_key_blocks) * context.num_tracks);
+
+			for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
+			{
+				if (!context.is_animated(track_index))
+					continue;	// Constant tracks have no keys
+
+				context.bit_rate_list[track_index].scalar.value = find_spline_key_bit_rate(context, track_index);
+
+				for (uint32_t block_index = 0; block_index < context.num_spline_key_blocks; ++block_index)
+					fit_spline_track_block(context, track_index, block_index);
+			}
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
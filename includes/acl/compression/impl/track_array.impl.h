@@ -34,7 +34,9 @@
 #include "acl/core/track_writer.h"
 
 #include <rtm/quatf.h>
+#include <rtm/scalard.h>
 #include <rtm/scalarf.h>
+#include <rtm/vector4d.h>
 #include <rtm/vector4f.h>
 
 #include <cstdint>
@@ -317,6 +319,96 @@ namespace acl
 				writer.write_vector4(track_index, value);
 			}
 			break;
+		case track_type8::quatf:
+			for (uint32_t track_index = 0; track_index < m_num_tracks; ++track_index)
+			{
+				const track_quatf& track__ = track_cast<track_quatf>(m_tracks[track_index]);
+
+				const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+				ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+				const float alpha = interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)];
+
+				const rtm::quatf value0 = track__[key_frame0];
+				const rtm::quatf value1 = track__[key_frame1];
+				const rtm::quatf value = rtm::quat_lerp(value0, value1, alpha);
+				writer.write_quat(track_index, value);
+			}
+			break;
+		case track_type8::float1d:
+			for (uint32_t track_index = 0; track_index < m_num_tracks; ++track_index)
+			{
+				const track_float1d& track__ = track_cast<track_float1d>(m_tracks[track_index]);
+
+				const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+				ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+				const float alpha = interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)];
+
+				const double value0 = track__[key_frame0];
+				const double value1 = track__[key_frame1];
+				const double value = rtm::scalar_lerp(value0, value1, double(alpha));
+				writer.write_float1d(track_index, value);
+			}
+			break;
+		case track_type8::float2d:
+			for (uint32_t track_index = 0; track_index < m_num_tracks; ++track_index)
+			{
+				const track_float2d& track__ = track_cast<track_float2d>(m_tracks[track_index]);
+
+				const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+				ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+				const float alpha = interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)];
+
+				const rtm::vector4d value0 = rtm::vector_load2(&track__[key_frame0]);
+				const rtm::vector4d value1 = rtm::vector_load2(&track__[key_frame1]);
+				const rtm::vector4d value = rtm::vector_lerp(value0, value1, double(alpha));
+				writer.write_float2d(track_index, value);
+			}
+			break;
+		case track_type8::float3d:
+			for (uint32_t track_index = 0; track_index < m_num_tracks; ++track_index)
+			{
+				const track_float3d& track__ = track_cast<track_float3d>(m_tracks[track_index]);
+
+				const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+				ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+				const float alpha = interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)];
+
+				const rtm::vector4d value0 = rtm::vector_load3(&track__[key_frame0]);
+				const rtm::vector4d value1 = rtm::vector_load3(&track__[key_frame1]);
+				const rtm::vector4d value = rtm::vector_lerp(value0, value1, double(alpha));
+				writer.write_float3d(track_index, value);
+			}
+			break;
+		case track_type8::float4d:
+			for (uint32_t track_index = 0; track_index < m_num_tracks; ++track_index)
+			{
+				const track_float4d& track__ = track_cast<track_float4d>(m_tracks[track_index]);
+
+				const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+				ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+				const float alpha = interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)];
+
+				const rtm::vector4d value0 = rtm::vector_load(&track__[key_frame0]);
+				const rtm::vector4d value1 = rtm::vector_load(&track__[key_frame1]);
+				const rtm::vector4d value = rtm::vector_lerp(value0, value1, double(alpha));
+				writer.write_float4d(track_index, value);
+			}
+			break;
+		case track_type8::vector4d:
+			for (uint32_t track_index = 0; track_index < m_num_tracks; ++track_index)
+			{
+				const track_vector4d& track__ = track_cast<track_vector4d>(m_tracks[track_index]);
+
+				const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+				ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+				const float alpha = interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)];
+
+				const rtm::vector4d value0 = track__[key_frame0];
+				const rtm::vector4d value1 = track__[key_frame1];
+				const rtm::vector4d value = rtm::vector_lerp(value0, value1, double(alpha));
+				writer.write_vector4d(track_index, value);
+			}
+			break;
 		case track_type8::qvvf:
 			for (uint32_t track_index = 0; track_index < m_num_tracks; ++track_index)
 			{
@@ -417,6 +509,66 @@ namespace acl
 			writer.write_vector4(track_index, value);
 			break;
 		}
+		case track_type8::quatf:
+		{
+			const track_quatf& track__ = track_cast<track_quatf>(track_);
+
+			const rtm::quatf value0 = track__[key_frame0];
+			const rtm::quatf value1 = track__[key_frame1];
+			const rtm::quatf value = rtm::quat_lerp(value0, value1, interpolation_alpha);
+			writer.write_quat(track_index, value);
+			break;
+		}
+		case track_type8::float1d:
+		{
+			const track_float1d& track__ = track_cast<track_float1d>(track_);
+
+			const double value0 = track__[key_frame0];
+			const double value1 = track__[key_frame1];
+			const double value = rtm::scalar_lerp(value0, value1, double(interpolation_alpha));
+			writer.write_float1d(track_index, value);
+			break;
+		}
+		case track_type8::float2d:
+		{
+			const track_float2d& track__ = track_cast<track_float2d>(track_);
+
+			const rtm::vector4d value0 = rtm::vector_load2(&track__[key_frame0]);
+			const rtm::vector4d value1 = rtm::vector_load2(&track__[key_frame1]);
+			const rtm::vector4d value = rtm::vector_lerp(value0, value1, double(interpolation_alpha));
+			writer.write_float2d(track_index, value);
+			break;
+		}
+		case track_type8::float3d:
+		{
+			const track_float3d& track__ = track_cast<track_float3d>(track_);
+
+			const rtm::vector4d value0 = rtm::vector_load3(&track__[key_frame0]);
+			const rtm::vector4d value1 = rtm::vector_load3(&track__[key_frame1]);
+			const rtm::vector4d value = rtm::vector_lerp(value0, value1, double(interpolation_alpha));
+			writer.write_float3d(track_index, value);
+			break;
+		}
+		case track_type8::float4d:
+		{
+			const track_float4d& track__ = track_cast<track_float4d>(track_);
+
+			const rtm::vector4d value0 = rtm::vector_load(&track__[key_frame0]);
+			const rtm::vector4d value1 = rtm::vector_load(&track__[key_frame1]);
+			const rtm::vector4d value = rtm::vector_lerp(value0, value1, double(interpolation_alpha));
+			writer.write_float4d(track_index, value);
+			break;
+		}
+		case track_type8::vector4d:
+		{
+			const track_vector4d& track__ = track_cast<track_vector4d>(track_);
+
+			const rtm::vector4d value0 = track__[key_frame0];
+			const rtm::vector4d value1 = track__[key_frame1];
+			const rtm::vector4d value = rtm::vector_lerp(value0, value1, double(interpolation_alpha));
+			writer.write_vector4d(track_index, value);
+			break;
+		}
 		case track_type8::qvvf:
 		{
 			const track_qvvf& track__ = track_cast<track_qvvf>(track_);
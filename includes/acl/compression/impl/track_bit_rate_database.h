@@ -32,11 +32,13 @@
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/compression/impl/sample_streams.h"
 #include "acl/compression/impl/track_stream.h"
+#include "acl/compression/compression_level.h"
 
 #include <rtm/quatf.h>
 #include <rtm/qvvf.h>
 #include <rtm/vector4f.h>
 
+#include <algorithm>
 #include <cstdint>
 
 // 0 = disabled, 1 = enabled
@@ -59,6 +61,7 @@ namespace acl
 				: m_allocator(allocator)
 				, m_database(nullptr)
 				, m_track_index(0xFFFFFFFFU)
+				, m_stop_track_index(0xFFFFFFFFU)
 				, m_bit_rates(nullptr)
 				, m_indices(nullptr)
 				, m_num_transforms(0)
@@ -70,7 +73,9 @@ namespace acl
 			}
 
 			void bind(track_bit_rate_database& database);
-			void build(uint32_t track_index, const transform_bit_rates* bit_rates, const transform_streams* bone_streams);
+			// Builds a query for the specified track and its parents
+			// When a stop track index is provided, that ancestor and its own parents are not sampled
+			void build(uint32_t track_index, const transform_bit_rates* bit_rates, const transform_streams* bone_streams, uint32_t stop_track_index = k_invalid_track_index);
 
 		private:
 			hierarchical_track_query(const hierarchical_track_query&) = delete;
@@ -86,6 +91,7 @@ namespace acl
 			iallocator&						m_allocator;
 			track_bit_rate_database*		m_database;
 			uint32_t						m_track_index;
+			uint32_t						m_stop_track_index;
 			const transform_bit_rates*				m_bit_rates;
 			transform_indices*				m_indices;
 			uint32_t						m_num_transforms;
@@ -164,27 +170,32 @@ namespace acl
 			friend track_bit_rate_database;
 		};
 
-		union bit_rates_union
+		//////////////////////////////////////////////////////////////////////////
+		// Cache statistics, useful to tune the number of bit rates cached per sub-track.
+		struct track_bit_rate_database_stats
 		{
-			// We are 0xFF, 0xFF, 0xFF, 0xFF if we are uninitialized and 0xFF, 0xFF, 0xFF, 0x00 if all three tracks are not variable
-			uint32_t value;
-			uint8_t bit_rates[4];
-
-			bit_rates_union() : value(0xFFFFFFFFU) {}
-			explicit bit_rates_union(const transform_bit_rates& input) : bit_rates{ input.rotation, input.translation, input.scale, 0 } {}
+			// Cache entry lookups when building queries, a miss evicts the least recently used bit rate
+			uint64_t num_entry_hits = 0;
+			uint64_t num_entry_misses = 0;
 
-			inline bool operator==(bit_rates_union other) const { return value == other.value; }
-			inline bool operator!=(bit_rates_union other) const { return value != other.value; }
+			// Sample lookups, a miss quantizes and caches the sample
+			uint64_t num_sample_hits = 0;
+			uint64_t num_sample_misses = 0;
 		};
 
 		//////////////////////////////////////////////////////////////////////////
 		// This class manages bit rate queries against tracks.
 		// It will cache recently requested bit rates to speed up repeating queries.
+		// The number of bit rates cached per sub-track is provided on construction, see
+		// calculate_num_bit_rates_cached_per_track(..) for a sensible default.
 		//////////////////////////////////////////////////////////////////////////
 		class track_bit_rate_database
 		{
 		public:
-			track_bit_rate_database(iallocator& allocator, rotation_format8 rotation_format, vector_format8 translation_format, vector_format8 scale_format, const transform_streams* bone_streams, const transform_streams* raw_bone_steams, uint32_t num_transforms, uint32_t num_samples_per_track);
+			// We cache at most this many bit rates per rotation/translation/scale sub-track
+			static constexpr uint32_t k_max_num_bit_rates_cached_per_track = 8;
+
+			track_bit_rate_database(iallocator& allocator, rotation_format8 rotation_format, vector_format8 translation_format, vector_format8 scale_format, const transform_streams* bone_streams, const transform_streams* raw_bone_steams, uint32_t num_transforms, uint32_t num_samples_per_track, uint32_t num_bit_rates_cached_per_track);
 			~track_bit_rate_database();
 
 			void set_segment(const transform_streams* bone_streams, uint32_t num_transforms, uint32_t num_samples_per_track);
@@ -194,34 +205,43 @@ namespace acl
 			void sample(const every_track_query& query, float sample_time, rtm::qvvf* out_transforms, uint32_t num_transforms);
 
 			size_t get_allocated_size() const;
+			uint32_t get_num_bit_rates_cached_per_track() const { return m_num_bit_rates_cached_per_track; }
+			const track_bit_rate_database_stats& get_stats() const { return m_stats; }
 
 		private:
 			track_bit_rate_database(const track_bit_rate_database&) = delete;
 			track_bit_rate_database& operator=(const track_bit_rate_database&) = delete;
 
-			void find_cache_entries(uint32_t track_index, const transform_bit_rates& bit_rates, uint32_t& out_rotation_cache_index, uint32_t& out_translation_cache_index, uint32_t& out_scale_cache_index);
+			struct sub_track_cache_entry
+			{
+				// We cache up to 'm_num_bit_rates_cached_per_track' different bit rates.
+				// We also keep a generation id to determine the least recently used bit rate to evict from the cache.
+				// A generation id of 0 means the slot is unused.
 
-			RTM_FORCE_INLINE rtm::quatf RTM_SIMD_CALL sample_rotation(const sample_context& context, uint32_t rotation_cache_index);
-			RTM_FORCE_INLINE rtm::vector4f RTM_SIMD_CALL sample_translation(const sample_context& context, uint32_t translation_cache_index);
-			RTM_FORCE_INLINE rtm::vector4f RTM_SIMD_CALL sample_scale(const sample_context& context, uint32_t scale_cache_index);
+				uint8_t				bit_rates[k_max_num_bit_rates_cached_per_track];
+				uint32_t			generation_ids[k_max_num_bit_rates_cached_per_track];
+
+				sub_track_cache_entry()
+				{
+					std::fill(bit_rates, bit_rates + k_max_num_bit_rates_cached_per_track, k_invalid_bit_rate);
+					std::fill(generation_ids, generation_ids + k_max_num_bit_rates_cached_per_track, 0U);
+				}
+			};
 
 			struct transform_cache_entry
 			{
 				// Each transform has a rotation/translation/scale.
-				// We cache up to 4 different bit rates for each.
-				// We also keep a generation id to determine the least recently used bit rates to evict from the cache.
-
-				bit_rates_union		rotation_bit_rates;
-				uint32_t			rotation_generation_ids[4] = { 0, 0, 0, 0 };
-
-				bit_rates_union		translation_bit_rates;
-				uint32_t			translation_generation_ids[4] = { 0, 0, 0, 0 };
+				sub_track_cache_entry	rotation;
+				sub_track_cache_entry	translation;
+				sub_track_cache_entry	scale;
+			};
 
-				bit_rates_union		scale_bit_rates;
-				uint32_t			scale_generation_ids[4] = { 0, 0, 0, 0 };
+			void find_cache_entries(uint32_t track_index, const transform_bit_rates& bit_rates, uint32_t& out_rotation_cache_index, uint32_t& out_translation_cache_index, uint32_t& out_scale_cache_index);
+			uint32_t find_cache_entry(sub_track_cache_entry& entry, uint32_t base_offset, uint8_t bit_rate);
 
-				static int32_t find_bit_rate_index(const bit_rates_union& bit_rates, uint32_t search_bit_rate);
-			};
+			RTM_FORCE_INLINE rtm::quatf RTM_SIMD_CALL sample_rotation(const sample_context& context, uint32_t rotation_cache_index);
+			RTM_FORCE_INLINE rtm::vector4f RTM_SIMD_CALL sample_translation(const sample_context& context, uint32_t translation_cache_index);
+			RTM_FORCE_INLINE rtm::vector4f RTM_SIMD_CALL sample_scale(const sample_context& context, uint32_t scale_cache_index);
 
 			iallocator&					m_allocator;
 			const transform_streams*	m_mutable_bone_streams;
@@ -229,6 +249,7 @@ namespace acl
 
 			uint32_t			m_num_transforms;
 			uint32_t			m_num_samples_per_track;
+			uint32_t			m_num_bit_rates_cached_per_track;
 			uint32_t			m_num_entries_per_transform;
 			uint32_t			m_track_size;
 
@@ -253,7 +274,7 @@ namespace acl
 			size_t				m_data_size;
 			size_t				m_num_cached_tracks;
 
-			static constexpr uint32_t k_num_bit_rates_cached_per_track = 4;
+			track_bit_rate_database_stats	m_stats;
 
 			friend single_track_query;
 			friend hierarchical_track_query;
@@ -272,16 +293,18 @@ namespace acl
 			m_num_transforms = database.m_num_transforms;
 		}
 
-		inline void hierarchical_track_query::build(uint32_t track_index, const transform_bit_rates* bit_rates, const transform_streams* bone_streams)
+		inline void hierarchical_track_query::build(uint32_t track_index, const transform_bit_rates* bit_rates, const transform_streams* bone_streams, uint32_t stop_track_index)
 		{
 			ACL_ASSERT(m_database != nullptr, "Query not bound to a database");
 			ACL_ASSERT(track_index < m_num_transforms, "Invalid track index");
+			ACL_ASSERT(track_index != stop_track_index, "Cannot stop on the queried track");
 
 			m_track_index = track_index;
+			m_stop_track_index = stop_track_index;
 			m_bit_rates = bit_rates;
 
 			uint32_t current_track_index = track_index;
-			while (current_track_index != k_invalid_track_index)
+			while (current_track_index != stop_track_index)
 			{
 				const transform_bit_rates& current_bit_rates = bit_rates[current_track_index];
 				transform_indices& indices = m_indices[current_track_index];
@@ -333,31 +356,52 @@ namespace acl
 			}
 		}
 
-		inline int32_t track_bit_rate_database::transform_cache_entry::find_bit_rate_index(const bit_rates_union& bit_rates, uint32_t search_bit_rate)
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of bit rates to cache per sub-track.
+		// Higher compression levels try more bit rate permutations per transform and benefit from
+		// a larger cache. We reduce it again, never below the lowest level, to fit within our memory budget.
+		// If a non-zero value is requested, it is used as-is.
+		inline uint32_t calculate_num_bit_rates_cached_per_track(uint32_t requested_num_bit_rates, compression_level8 level, uint32_t num_transforms, uint32_t num_samples_per_track, bool has_scale)
 		{
-			for (int32_t i = 0; i < 4; ++i)
-			{
-				if (bit_rates.bit_rates[i] == search_bit_rate)
-					return i;
-			}
+			if (requested_num_bit_rates != 0)
+				return std::min<uint32_t>(requested_num_bit_rates, track_bit_rate_database::k_max_num_bit_rates_cached_per_track);
+
+			constexpr uint32_t k_min_num_bit_rates = 4;
+			constexpr size_t k_memory_budget = 256 * 1024 * 1024;	// 256 MB
 
-			return -1;
+			uint32_t num_bit_rates = k_min_num_bit_rates;
+			if (level >= compression_level8::highest)
+				num_bit_rates = 8;
+			else if (level >= compression_level8::high)
+				num_bit_rates = 6;
+
+			const uint32_t num_tracks_per_transform = has_scale ? 3U : 2U;
+			const size_t track_size = align_to<size_t>(sizeof(rtm::vector4f) * num_samples_per_track, 64);
+			const size_t num_bit_rate_bytes = size_t(num_transforms) * num_tracks_per_transform * track_size;
+
+			while (num_bit_rates > k_min_num_bit_rates && num_bit_rate_bytes * num_bit_rates > k_memory_budget)
+				num_bit_rates--;
+
+			return num_bit_rates;
 		}
 
-		inline track_bit_rate_database::track_bit_rate_database(iallocator& allocator, rotation_format8 rotation_format, vector_format8 translation_format, vector_format8 scale_format, const transform_streams* bone_streams, const transform_streams* raw_bone_steams, uint32_t num_transforms, uint32_t num_samples_per_track)
+		inline track_bit_rate_database::track_bit_rate_database(iallocator& allocator, rotation_format8 rotation_format, vector_format8 translation_format, vector_format8 scale_format, const transform_streams* bone_streams, const transform_streams* raw_bone_steams, uint32_t num_transforms, uint32_t num_samples_per_track, uint32_t num_bit_rates_cached_per_track)
 			: m_allocator(allocator)
 			, m_mutable_bone_streams(bone_streams)
 			, m_raw_bone_streams(raw_bone_steams)
 			, m_num_transforms(num_transforms)
 			, m_num_samples_per_track(num_samples_per_track)
+			, m_num_bit_rates_cached_per_track(num_bit_rates_cached_per_track)
 		{
+			ACL_ASSERT(num_bit_rates_cached_per_track != 0 && num_bit_rates_cached_per_track <= k_max_num_bit_rates_cached_per_track, "Invalid number of bit rates cached per track: %u", num_bit_rates_cached_per_track);
+
 			m_transforms = allocate_type_array<transform_cache_entry>(allocator, num_transforms);
 
 			const bool has_scale = raw_bone_steams->segment->clip->has_scale;
 			m_has_scale = has_scale;
 
 			const uint32_t num_tracks_per_transform = has_scale ? 3U : 2U;
-			const uint32_t num_entries_per_transform = num_tracks_per_transform * k_num_bit_rates_cached_per_track;
+			const uint32_t num_entries_per_transform = num_tracks_per_transform * num_bit_rates_cached_per_track;
 			m_num_entries_per_transform = num_entries_per_transform;
 
 			const uint32_t num_cached_tracks = num_transforms * m_num_entries_per_transform;
@@ -378,7 +422,7 @@ namespace acl
 			m_track_entry_bitsets = allocate_type_array<uint32_t>(allocator, track_bitsets_size);
 			m_track_bitsets_size = track_bitsets_size;
 
-			// We allocate a single float buffer to accommodate 4 bit rates for every rot/trans/scale track of each transform.
+			// We allocate a single float buffer to accommodate every cached bit rate for every rot/trans/scale track of each transform.
 			// Each track is padded and aligned to ensure that it starts on a cache line boundary.
 			const uint32_t track_size = align_to<uint32_t>(sizeof(rtm::vector4f) * num_samples_per_track, 64);
 			m_track_size = track_size;
@@ -416,211 +460,101 @@ namespace acl
 #endif
 		}
 
-		inline void track_bit_rate_database::find_cache_entries(uint32_t track_index, const transform_bit_rates& bit_rates, uint32_t& out_rotation_cache_index, uint32_t& out_translation_cache_index, uint32_t& out_scale_cache_index)
+		inline uint32_t track_bit_rate_database::find_cache_entry(sub_track_cache_entry& entry, uint32_t base_offset, uint8_t bit_rate)
 		{
-			// Memory layout:
-			//    track 0
-			//        rotation
-			//            entry 0		0
-			//            entry 1		1
-			//            entry 2		2
-			//            entry 3		3
-			//        translation
-			//            entry 0		4
-			//            entry 1		5
-			//            entry 2		6
-			//            entry 3		7
-			//        scale
-			//            entry 0		8
-			//            entry 1		9
-			//            entry 2		10
-			//            entry 3		11
-			//    track 1
-			// ...
-
-			const uint32_t num_entries_per_transform = m_num_entries_per_transform;
-			const uint32_t base_track_offset = track_index * num_entries_per_transform;
-			const uint32_t base_rotation_offset = base_track_offset + (0 * k_num_bit_rates_cached_per_track);
-			const uint32_t base_translation_offset = base_track_offset + (1 * k_num_bit_rates_cached_per_track);
-
 			const size_t bitset_size = m_bitset_desc.get_size();
 
-			transform_cache_entry& entry = m_transforms[track_index];
-
-			uint32_t rotation_cache_index;
-			if (bit_rates.rotation == k_invalid_bit_rate)
+			if (bit_rate == k_invalid_bit_rate)
 			{
 				// Constant/default tracks or tracks that do not use a variable bit rate can use a single slot
-				rotation_cache_index = base_rotation_offset;
-				ACL_ASSERT(rotation_cache_index < m_num_cached_tracks, "Invalid cache index");
+				const uint32_t cache_index = base_offset;
+				ACL_ASSERT(cache_index < m_num_cached_tracks, "Invalid cache index");
 
-				if (entry.rotation_generation_ids[0] == 0)
+				if (entry.generation_ids[0] == 0)
 				{
 					// The first time around, we invalidate all our cached samples and they will remain valid until we change segment
-					uint32_t* validity_bitset = m_track_entry_bitsets + (bitset_size * rotation_cache_index);
+					uint32_t* validity_bitset = m_track_entry_bitsets + (bitset_size * cache_index);
 					bitset_reset(validity_bitset, m_bitset_desc, false);
 
-					entry.rotation_generation_ids[0] = m_generation_id++;
-
-#if ACL_IMPL_DEBUG_DATABASE_IMPL
-					printf("Reserved cache index %u for rotation track %u...\n", rotation_cache_index, track_index);
-#endif
+					entry.generation_ids[0] = m_generation_id++;
+					m_stats.num_entry_misses++;
 				}
-			}
-			else
-			{
-				const int32_t slot_index = entry.find_bit_rate_index(entry.rotation_bit_rates, bit_rates.rotation);
-				if (slot_index >= 0)
-					rotation_cache_index = base_rotation_offset + slot_index;
 				else
-				{
-					// Failed to find a cached entry for this track and bit rate, clear the oldest entry
-					uint32_t oldest_generation_id = entry.rotation_generation_ids[0];
-					uint32_t oldest_index = 0;
-					for (uint32_t i = 1; i < 4; ++i)
-					{
-						if (entry.rotation_generation_ids[i] < oldest_generation_id)
-						{
-							oldest_generation_id = entry.rotation_generation_ids[i];
-							oldest_index = i;
-						}
-					}
-
-					rotation_cache_index = base_rotation_offset + oldest_index;
-					ACL_ASSERT(rotation_cache_index < m_num_cached_tracks, "Invalid cache index");
-
-					entry.rotation_bit_rates.bit_rates[oldest_index] = bit_rates.rotation;
-					entry.rotation_generation_ids[oldest_index] = m_generation_id++;
-
-					uint32_t* validity_bitset = m_track_entry_bitsets + (bitset_size * rotation_cache_index);
-					bitset_reset(validity_bitset, m_bitset_desc, false);
+					m_stats.num_entry_hits++;
 
-#if ACL_IMPL_DEBUG_DATABASE_IMPL
-					printf("Reserved cache index %u for rotation track %u...\n", rotation_cache_index, track_index);
-#endif
-				}
+				return cache_index;
 			}
 
-			out_rotation_cache_index = rotation_cache_index;
-
-			uint32_t translation_cache_index;
-			if (bit_rates.translation == k_invalid_bit_rate)
+			const uint32_t num_bit_rates_cached = m_num_bit_rates_cached_per_track;
+			for (uint32_t slot_index = 0; slot_index < num_bit_rates_cached; ++slot_index)
 			{
-				// Constant/default tracks or tracks that do not use a variable bit rate can use a single slot
-				translation_cache_index = base_translation_offset;
-				ACL_ASSERT(translation_cache_index < m_num_cached_tracks, "Invalid cache index");
-
-				if (entry.translation_generation_ids[0] == 0)
+				if (entry.bit_rates[slot_index] == bit_rate)
 				{
-					// The first time around, we invalidate all our cached samples and they will remain valid until we change segment
-					uint32_t* validity_bitset = m_track_entry_bitsets + (bitset_size * translation_cache_index);
-					bitset_reset(validity_bitset, m_bitset_desc, false);
-
-					entry.translation_generation_ids[0] = m_generation_id++;
-
-#if ACL_IMPL_DEBUG_DATABASE_IMPL
-					printf("Reserved cache index %u for translation track %u...\n", translation_cache_index, track_index);
-#endif
+					m_stats.num_entry_hits++;
+					return base_offset + slot_index;
 				}
 			}
-			else
+
+			// Failed to find a cached entry for this track and bit rate, clear the oldest entry
+			uint32_t oldest_generation_id = entry.generation_ids[0];
+			uint32_t oldest_index = 0;
+			for (uint32_t slot_index = 1; slot_index < num_bit_rates_cached; ++slot_index)
 			{
-				const int32_t slot_index = entry.find_bit_rate_index(entry.translation_bit_rates, bit_rates.translation);
-				if (slot_index >= 0)
-					translation_cache_index = base_translation_offset + slot_index;
-				else
+				if (entry.generation_ids[slot_index] < oldest_generation_id)
 				{
-					// Failed to find a cached entry for this track and bit rate, clear the oldest entry
-					uint32_t oldest_generation_id = entry.translation_generation_ids[0];
-					uint32_t oldest_index = 0;
-					for (uint32_t i = 1; i < 4; ++i)
-					{
-						if (entry.translation_generation_ids[i] < oldest_generation_id)
-						{
-							oldest_generation_id = entry.translation_generation_ids[i];
-							oldest_index = i;
-						}
-					}
-
-					translation_cache_index = base_translation_offset + oldest_index;
-					ACL_ASSERT(translation_cache_index < m_num_cached_tracks, "Invalid cache index");
-
-					entry.translation_bit_rates.bit_rates[oldest_index] = bit_rates.translation;
-					entry.translation_generation_ids[oldest_index] = m_generation_id++;
-
-					uint32_t* validity_bitset = m_track_entry_bitsets + (bitset_size * translation_cache_index);
-					bitset_reset(validity_bitset, m_bitset_desc, false);
-
-#if ACL_IMPL_DEBUG_DATABASE_IMPL
-					printf("Reserved cache index %u for translation track %u...\n", translation_cache_index, track_index);
-#endif
+					oldest_generation_id = entry.generation_ids[slot_index];
+					oldest_index = slot_index;
 				}
 			}
 
-			out_translation_cache_index = translation_cache_index;
+			const uint32_t cache_index = base_offset + oldest_index;
+			ACL_ASSERT(cache_index < m_num_cached_tracks, "Invalid cache index");
 
-			uint32_t scale_cache_index;
-			if (!m_has_scale)
-				scale_cache_index = 0xFFFFFFFFU;
-			else
-			{
-				const uint32_t base_scale_offset = base_track_offset + (2 * k_num_bit_rates_cached_per_track);
+			entry.bit_rates[oldest_index] = bit_rate;
+			entry.generation_ids[oldest_index] = m_generation_id++;
+			m_stats.num_entry_misses++;
 
-				if (bit_rates.scale == k_invalid_bit_rate)
-				{
-					// Constant/default tracks or tracks that do not use a variable bit rate can use a single slot
-					scale_cache_index = base_scale_offset;
-					ACL_ASSERT(scale_cache_index < m_num_cached_tracks, "Invalid cache index");
+			uint32_t* validity_bitset = m_track_entry_bitsets + (bitset_size * cache_index);
+			bitset_reset(validity_bitset, m_bitset_desc, false);
 
-					if (entry.scale_generation_ids[0] == 0)
-					{
-						// The first time around, we invalidate all our cached samples and they will remain valid until we change segment
-						uint32_t* validity_bitset = m_track_entry_bitsets + (bitset_size * scale_cache_index);
-						bitset_reset(validity_bitset, m_bitset_desc, false);
+			return cache_index;
+		}
 
-						entry.scale_generation_ids[0] = m_generation_id++;
+		inline void track_bit_rate_database::find_cache_entries(uint32_t track_index, const transform_bit_rates& bit_rates, uint32_t& out_rotation_cache_index, uint32_t& out_translation_cache_index, uint32_t& out_scale_cache_index)
+		{
+			// Memory layout with N bit rates cached per track:
+			//    track 0
+			//        rotation
+			//            entry 0		0
+			//            ...
+			//            entry N-1		N-1
+			//        translation
+			//            entry 0		N
+			//            ...
+			//            entry N-1		2N-1
+			//        scale
+			//            entry 0		2N
+			//            ...
+			//            entry N-1		3N-1
+			//    track 1
+			// ...
 
-#if ACL_IMPL_DEBUG_DATABASE_IMPL
-						printf("Reserved cache index %u for scale track %u...\n", scale_cache_index, track_index);
-#endif
-					}
-				}
-				else
-				{
-					const int32_t slot_index = entry.find_bit_rate_index(entry.scale_bit_rates, bit_rates.scale);
-					if (slot_index >= 0)
-						scale_cache_index = base_scale_offset + slot_index;
-					else
-					{
-						// Failed to find a cached entry for this track and bit rate, clear the oldest entry
-						uint32_t oldest_generation_id = entry.scale_generation_ids[0];
-						uint32_t oldest_index = 0;
-						for (uint32_t i = 1; i < 4; ++i)
-						{
-							if (entry.scale_generation_ids[i] < oldest_generation_id)
-							{
-								oldest_generation_id = entry.scale_generation_ids[i];
-								oldest_index = i;
-							}
-						}
-
-						scale_cache_index = base_scale_offset + oldest_index;
-						ACL_ASSERT(scale_cache_index < m_num_cached_tracks, "Invalid cache index");
-
-						entry.scale_bit_rates.bit_rates[oldest_index] = bit_rates.scale;
-						entry.scale_generation_ids[oldest_index] = m_generation_id++;
-
-						uint32_t* validity_bitset = m_track_entry_bitsets + (bitset_size * scale_cache_index);
-						bitset_reset(validity_bitset, m_bitset_desc, false);
+			const uint32_t num_bit_rates_cached = m_num_bit_rates_cached_per_track;
+			const uint32_t base_track_offset = track_index * m_num_entries_per_transform;
+
+			transform_cache_entry& entry = m_transforms[track_index];
+
+			out_rotation_cache_index = find_cache_entry(entry.rotation, base_track_offset + (0 * num_bit_rates_cached), bit_rates.rotation);
+			out_translation_cache_index = find_cache_entry(entry.translation, base_track_offset + (1 * num_bit_rates_cached), bit_rates.translation);
+
+			if (m_has_scale)
+				out_scale_cache_index = find_cache_entry(entry.scale, base_track_offset + (2 * num_bit_rates_cached), bit_rates.scale);
+			else
+				out_scale_cache_index = 0xFFFFFFFFU;
 
 #if ACL_IMPL_DEBUG_DATABASE_IMPL
-						printf("Reserved cache index %u for scale track %u...\n", scale_cache_index, track_index);
+			printf("Using cache indices %u, %u, %u for track %u...\n", out_rotation_cache_index, out_translation_cache_index, out_scale_cache_index, track_index);
 #endif
-					}
-				}
-			}
-
-			out_scale_cache_index = scale_cache_index;
 
 			ACL_ASSERT(m_generation_id < (0xFFFFFFFFU - 8), "Generation ID is about to wrap, bad things will happen");
 		}
@@ -642,6 +576,7 @@ namespace acl
 				if (bitset_test(validity_bitset, m_bitref_constant))
 				{
 					// Cached
+					m_stats.num_sample_hits++;
 					rotation = cached_samples[0];
 
 #if ACL_IMPL_DEBUG_DATABASE_IMPL
@@ -651,6 +586,7 @@ namespace acl
 				else
 				{
 					// Not cached
+					m_stats.num_sample_misses++;
 					if (m_is_rotation_variable)
 						rotation = get_rotation_sample(m_raw_bone_streams[track_index], 0);
 					else
@@ -677,6 +613,7 @@ namespace acl
 				if (bitset_test(validity_bitset, bitref0))
 				{
 					// Cached
+					m_stats.num_sample_hits++;
 					rotation = cached_samples[context.sample_key];
 
 #if ACL_IMPL_DEBUG_DATABASE_IMPL
@@ -686,6 +623,7 @@ namespace acl
 				else
 				{
 					// Not cached
+					m_stats.num_sample_misses++;
 					if (m_is_rotation_variable)
 						rotation = get_rotation_sample(bone_stream, raw_bone_stream, context.sample_key, context.bit_rates.rotation);
 					else
@@ -722,6 +660,7 @@ namespace acl
 				if (bitset_test(validity_bitset, m_bitref_constant))
 				{
 					// Cached
+					m_stats.num_sample_hits++;
 					translation = cached_samples[0];
 
 #if ACL_IMPL_DEBUG_DATABASE_IMPL
@@ -731,6 +670,7 @@ namespace acl
 				else
 				{
 					// Not cached
+					m_stats.num_sample_misses++;
 					translation = get_translation_sample(m_raw_bone_streams[track_index], 0, vector_format8::vector3f_full);
 
 					cached_samples[0] = translation;
@@ -752,6 +692,7 @@ namespace acl
 				if (bitset_test(validity_bitset, bitref0))
 				{
 					// Cached
+					m_stats.num_sample_hits++;
 					translation = cached_samples[context.sample_key];
 
 #if ACL_IMPL_DEBUG_DATABASE_IMPL
@@ -761,6 +702,7 @@ namespace acl
 				else
 				{
 					// Not cached
+					m_stats.num_sample_misses++;
 					if (m_is_translation_variable)
 						translation = get_translation_sample(bone_stream, raw_bone_stream, context.sample_key, context.bit_rates.translation);
 					else
@@ -795,6 +737,7 @@ namespace acl
 				if (bitset_test(validity_bitset, m_bitref_constant))
 				{
 					// Cached
+					m_stats.num_sample_hits++;
 					scale = cached_samples[0];
 
 #if ACL_IMPL_DEBUG_DATABASE_IMPL
@@ -804,6 +747,7 @@ namespace acl
 				else
 				{
 					// Not cached
+					m_stats.num_sample_misses++;
 					scale = get_scale_sample(m_raw_bone_streams[track_index], 0, vector_format8::vector3f_full);
 
 					cached_samples[0] = scale;
@@ -825,6 +769,7 @@ namespace acl
 				if (bitset_test(validity_bitset, bitref0))
 				{
 					// Cached
+					m_stats.num_sample_hits++;
 					scale = cached_samples[context.sample_key];
 
 #if ACL_IMPL_DEBUG_DATABASE_IMPL
@@ -834,6 +779,7 @@ namespace acl
 				else
 				{
 					// Not cached
+					m_stats.num_sample_misses++;
 					if (m_is_scale_variable)
 						scale = get_scale_sample(bone_stream, raw_bone_stream, context.sample_key, context.bit_rates.scale);
 					else
@@ -890,7 +836,7 @@ namespace acl
 			context.sample_time = sample_time;
 
 			uint32_t current_track_index = query.m_track_index;
-			while (current_track_index != k_invalid_track_index)
+			while (current_track_index != query.m_stop_track_index)
 			{
 				const transform_streams& bone_stream = m_mutable_bone_streams[current_track_index];
 				const hierarchical_track_query::transform_indices& indices = query.m_indices[current_track_index];
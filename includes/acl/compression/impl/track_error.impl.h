@@ -34,10 +34,14 @@
 #include "acl/core/impl/debug_track_writer.h"
 #include "acl/compression/track_array.h"
 #include "acl/compression/transform_error_metrics.h"
+#include "acl/compression/impl/rotation.scalar.h"
 #include "acl/compression/impl/track_list_context.h"
 #include "acl/decompression/decompress.h"
 
+#include <rtm/quatf.h>
+#include <rtm/scalard.h>
 #include <rtm/scalarf.h>
+#include <rtm/vector4d.h>
 #include <rtm/vector4f.h>
 
 #include <cstdint>
@@ -92,6 +96,51 @@ namespace acl
 				error = rtm::vector_abs(rtm::vector_sub(raw_value, lossy_value));
 				break;
 			}
+			case track_type8::quatf:
+			{
+				// Rotations measure their error as the angle between them
+				const rtm::quatf raw_value = raw_tracks_writer.read_quat(raw_track_index);
+				const rtm::quatf lossy_value = lossy_tracks_writer.read_quat(lossy_track_index);
+				error = rtm::vector_set(calculate_quatf_error(raw_value, lossy_value));
+				break;
+			}
+			case track_type8::float1d:
+			{
+				const double raw_value = raw_tracks_writer.read_float1d(raw_track_index);
+				const double lossy_value = lossy_tracks_writer.read_float1d(lossy_track_index);
+				error = rtm::vector_set(float(rtm::scalar_abs(raw_value - lossy_value)));
+				break;
+			}
+			case track_type8::float2d:
+			{
+				const rtm::vector4d raw_value = raw_tracks_writer.read_float2d(raw_track_index);
+				const rtm::vector4d lossy_value = lossy_tracks_writer.read_float2d(lossy_track_index);
+				error = rtm::vector_cast(rtm::vector_abs(rtm::vector_sub(raw_value, lossy_value)));
+				error = rtm::vector_mix<rtm::mix4::x, rtm::mix4::y, rtm::mix4::c, rtm::mix4::d>(error, rtm::vector_zero());
+				break;
+			}
+			case track_type8::float3d:
+			{
+				const rtm::vector4d raw_value = raw_tracks_writer.read_float3d(raw_track_index);
+				const rtm::vector4d lossy_value = lossy_tracks_writer.read_float3d(lossy_track_index);
+				error = rtm::vector_cast(rtm::vector_abs(rtm::vector_sub(raw_value, lossy_value)));
+				error = rtm::vector_mix<rtm::mix4::x, rtm::mix4::y, rtm::mix4::z, rtm::mix4::d>(error, rtm::vector_zero());
+				break;
+			}
+			case track_type8::float4d:
+			{
+				const rtm::vector4d raw_value = raw_tracks_writer.read_float4d(raw_track_index);
+				const rtm::vector4d lossy_value = lossy_tracks_writer.read_float4d(lossy_track_index);
+				error = rtm::vector_cast(rtm::vector_abs(rtm::vector_sub(raw_value, lossy_value)));
+				break;
+			}
+			case track_type8::vector4d:
+			{
+				const rtm::vector4d raw_value = raw_tracks_writer.read_vector4d(raw_track_index);
+				const rtm::vector4d lossy_value = lossy_tracks_writer.read_vector4d(lossy_track_index);
+				error = rtm::vector_cast(rtm::vector_abs(rtm::vector_sub(raw_value, lossy_value)));
+				break;
+			}
 			case track_type8::qvvf:
 			default:
 				ACL_ASSERT(false, "Unsupported track type");
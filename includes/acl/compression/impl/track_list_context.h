@@ -29,6 +29,7 @@
 #include "acl/core/iallocator.h"
 #include "acl/core/bitset.h"
 #include "acl/core/track_desc.h"
+#include "acl/core/profiling.h"
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/compression/track_array.h"
 #include "acl/compression/impl/track_range.h"
@@ -65,6 +66,66 @@ namespace acl
 			track_bit_rate() : qvv{k_invalid_bit_rate, k_invalid_bit_rate, k_invalid_bit_rate} {}
 		};
 
+		// A track range reduced within a segment, normalized within the clip range of the track
+		struct scalar_segment_range
+		{
+			rtm::vector4f min;
+			rtm::vector4f extent;
+		};
+
+		// A span of contiguous samples where a sparse track is active
+		struct sparse_track_span
+		{
+			rtm::vector4f range_min;
+			rtm::vector4f range_extent;
+			uint32_t start_sample_index;
+			uint32_t num_samples;
+			uint8_t bit_rate;
+		};
+
+		// A track that retains its inactive value outside of its active spans
+		struct sparse_track
+		{
+			sparse_track_span* spans = nullptr;
+			uint32_t num_spans = 0;
+			uint32_t inactive_sample_index = 0;
+		};
+
+		// A track stored at a lower sample rate, see 'extract_decimated_tracks'
+		struct decimated_track
+		{
+			rtm::vector4f range_min;
+			rtm::vector4f range_extent;
+
+			// Retained samples, packed at our bit rate unless it is raw
+			rtm::vector4f* samples = nullptr;
+			uint32_t num_samples = 0;
+
+			uint8_t decimation_shift = 0;
+			uint8_t bit_rate = k_invalid_bit_rate;
+		};
+
+		// The maximum number of samples covered by a block of spline keys, see 'fit_spline_keys'
+		constexpr uint32_t k_spline_key_max_num_samples_per_block = 32;
+
+		// The keys of a track within a block of spline keys
+		struct spline_key_block
+		{
+			// Decoded value of each key, identical to what decompression reconstructs
+			rtm::vector4f values[k_spline_key_max_num_samples_per_block + 1];
+
+			// Quantized value of each key, only used when the keys aren't raw
+			uint16_t quantized_values[k_spline_key_max_num_samples_per_block + 1][4];
+
+			// Sorted sample offset of each key within the block
+			uint8_t sample_offsets[k_spline_key_max_num_samples_per_block + 1];
+
+			uint8_t num_keys;
+		};
+
+		// Double precision tracks have 4 base values regardless of their type, see 'pack_double_track_list'
+		constexpr uint32_t k_num_base_values_per_track = 4;
+
 		struct track_list_context
 		{
 			iallocator* allocator = nullptr;
@@ -77,11 +138,34 @@ namespace acl
 			track_bit_rate* bit_rate_list = nullptr;
 			uint32_t* track_output_indices = nullptr;
 
+			// Our samples are split into one or more segments, see 'segment_tracks'
+			uint32_t* segment_start_sample_indices = nullptr;
+			scalar_segment_range* segment_ranges = nullptr;		// Indexed by: segment_index * num_tracks + track_index
+
+			// Sparse tracks are neither constant nor animated, see 'extract_sparse_tracks'
+			uint32_t* sparse_tracks_bitset = nullptr;
+			sparse_track* sparse_tracks = nullptr;				// Only valid for sparse tracks
+
+			// Decimated tracks are neither constant nor animated, see 'extract_decimated_tracks'
+			uint32_t* decimated_tracks_bitset = nullptr;
+			decimated_track* decimated_tracks = nullptr;		// Only valid for decimated tracks
+
+			// Only used with spline key reduction, see 'fit_spline_keys'
+			spline_key_block* spline_key_blocks = nullptr;		// Indexed by: block_index * num_tracks + track_index
+			uint32_t num_spline_key_blocks = 0;
+			uint32_t num_samples_per_spline_key_block = 0;
+
+			// Only used by double precision tracks, see 'pack_double_track_list'
+			double* track_base_values = nullptr;				// Indexed by: track_index * k_num_base_values_per_track + component_index
+
 			uint32_t num_tracks = 0;
 			uint32_t num_output_tracks = 0;
 			uint32_t num_samples = 0;
 			float sample_rate = 0.0F;
 			float duration = 0.0F;
+			uint32_t num_segments = 0;
+			bool has_segments = false;							// Whether or not our segment ranges are stored in the compressed data
+			bool has_quatf_tracks = false;						// Whether or not our tracks are rotations packed as float3f, see 'pack_quatf_track_list'
 
 			sample_looping_policy looping_policy = sample_looping_policy::non_looping;
 
@@ -99,11 +183,50 @@ namespace acl
 					deallocate_type_array(*allocator, bit_rate_list, num_tracks);
 
 					deallocate_type_array(*allocator, track_output_indices, num_output_tracks);
+
+					deallocate_type_array(*allocator, segment_start_sample_indices, num_segments);
+					deallocate_type_array(*allocator, segment_ranges, size_t(num_segments) * num_tracks);
+
+					deallocate_type_array(*allocator, sparse_tracks_bitset, bitset_desc.get_size());
+
+					if (sparse_tracks != nullptr)
+					{
+						for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+							deallocate_type_array(*allocator, sparse_tracks[track_index].spans, sparse_tracks[track_index].num_spans);
+
+						deallocate_type_array(*allocator, sparse_tracks, num_tracks);
+					}
+
+					deallocate_type_array(*allocator, decimated_tracks_bitset, bitset_desc.get_size());
+
+					if (decimated_tracks != nullptr)
+					{
+						for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+							deallocate_type_array(*allocator, decimated_tracks[track_index].samples, decimated_tracks[track_index].num_samples);
+
+						deallocate_type_array(*allocator, decimated_tracks, num_tracks);
+					}
+
+					deallocate_type_array(*allocator, spline_key_blocks, size_t(num_spline_key_blocks) * num_tracks);
+
+					deallocate_type_array(*allocator, track_base_values, size_t(num_tracks) * k_num_base_values_per_track);
 				}
 			}
 
 			bool is_valid() const { return allocator != nullptr; }
 			bool is_constant(uint32_t track_index) const { return bitset_test(constant_tracks_bitset, bitset_description::make_from_num_bits(num_tracks), track_index); }
+			bool is_sparse(uint32_t track_index) const { return bitset_test(sparse_tracks_bitset, bitset_description::make_from_num_bits(num_tracks), track_index); }
+
+			bool is_decimated(uint32_t track_index) const { return bitset_test(decimated_tracks_bitset, bitset_description::make_from_num_bits(num_tracks), track_index); }
+
+			// Whether or not the track has samples in our animated values
+			bool is_animated(uint32_t track_index) const { return !is_constant(track_index) && !is_sparse(track_index) && !is_decimated(track_index); }
+
+			uint32_t get_segment_num_samples(uint32_t segment_index) const
+			{
+				const uint32_t end_sample_index = (segment_index + 1) < num_segments ? segment_start_sample_indices[segment_index + 1] : num_samples;
+				return end_sample_index - segment_start_sample_indices[segment_index];
+			}
 
 			track_list_context(const track_list_context&) = delete;
 			track_list_context(track_list_context&&) = delete;
@@ -232,6 +355,8 @@ namespace acl
 
 		inline bool initialize_context(iallocator& allocator, const track_array& track_list, track_list_context& context)
 		{
+			ACL_PROFILE_SCOPE("acl::initialize_context");
+
 			ACL_ASSERT(track_list.is_valid().empty(), "Invalid track list");
 			ACL_ASSERT(!context.is_valid(), "Context already initialized");
 
@@ -243,11 +368,24 @@ namespace acl
 			context.range_list = nullptr;
 			context.constant_tracks_bitset = nullptr;
 			context.track_output_indices = nullptr;
+			context.segment_start_sample_indices = nullptr;
+			context.segment_ranges = nullptr;
+			context.sparse_tracks_bitset = nullptr;
+			context.sparse_tracks = nullptr;
+			context.decimated_tracks_bitset = nullptr;
+			context.decimated_tracks = nullptr;
+			context.spline_key_blocks = nullptr;
+			context.num_spline_key_blocks = 0;
+			context.num_samples_per_spline_key_block = 0;
+			context.track_base_values = nullptr;
 			context.num_tracks = track_list.get_num_tracks();
 			context.num_output_tracks = 0;
 			context.num_samples = track_list.get_num_samples_per_track();
 			context.sample_rate = track_list.get_sample_rate();
 			context.duration = track_list.get_finite_duration();
+			context.num_segments = 0;
+			context.has_segments = false;
+			context.has_quatf_tracks = false;
 			context.looping_policy = track_list.get_looping_policy();
 
 			context.track_output_indices = create_output_track_mapping(allocator, track_list, context.num_output_tracks);
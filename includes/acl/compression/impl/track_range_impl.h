@@ -27,6 +27,7 @@
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/profiling.h"
 #include "acl/compression/impl/track_list_context.h"
 
 #include <rtm/vector4f.h>
@@ -64,6 +65,8 @@ namespace acl
 
 		inline void extract_track_ranges(track_list_context& context)
 		{
+			ACL_PROFILE_SCOPE("acl::extract_track_ranges");
+
 			ACL_ASSERT(context.is_valid(), "Invalid context");
 
 			context.range_list = allocate_type_array<track_range>(*context.allocator, context.num_tracks);
@@ -0,0 +1,233 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/error.h"
+
+#include <cstdint>
+
+#if defined(ACL_USE_THREADS)
+	#include <condition_variable>
+	#include <mutex>
+	#include <thread>
+#endif
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// A minimal pool of persistent worker threads used to speed up offline compression.
+		// A job is a callable invoked once per worker with the worker index [0, num_workers).
+		// The calling thread participates as worker 0 and 'run' blocks until every worker is done.
+		// Jobs must not allocate from the pool allocator unless it is thread safe.
+		//
+		// Threads are only used when ACL_USE_THREADS is defined, otherwise no thread is ever
+		// created and every job runs on the calling thread as worker 0.
+		//////////////////////////////////////////////////////////////////////////
+		class worker_pool
+		{
+		public:
+			worker_pool(iallocator& allocator, uint32_t num_workers);
+			~worker_pool();
+
+			uint32_t get_num_workers() const { return m_num_threads + 1; }
+
+			template<typename job_type>
+			void run(job_type& job) { dispatch(&invoke_job<job_type>, &job); }
+
+		private:
+			worker_pool(const worker_pool&) = delete;
+			worker_pool& operator=(const worker_pool&) = delete;
+
+			using job_function = void(*)(void* job, uint32_t worker_index);
+
+			template<typename job_type>
+			static void invoke_job(void* job, uint32_t worker_index) { (*static_cast<job_type*>(job))(worker_index); }
+
+			void dispatch(job_function function, void* job);
+			void worker_main(uint32_t worker_index);
+
+			uint32_t					m_num_threads;
+
+#if defined(ACL_USE_THREADS)
+			iallocator&					m_allocator;
+			std::thread*				m_threads;
+
+			std::mutex					m_mutex;
+			std::condition_variable		m_job_ready;
+			std::condition_variable		m_job_done;
+
+			job_function				m_job_function;
+			void*						m_job;
+			uint32_t					m_job_generation;
+			uint32_t					m_num_pending_workers;
+			bool						m_is_exiting;
+#endif
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of hardware threads available, 1 if unknown or when threads are disabled.
+		inline uint32_t get_num_hardware_threads()
+		{
+#if defined(ACL_USE_THREADS)
+			const uint32_t num_hardware_threads = std::thread::hardware_concurrency();
+			return num_hardware_threads != 0 ? num_hardware_threads : 1;
+#else
+			return 1;
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Implementation
+
+#if defined(ACL_USE_THREADS)
+		inline worker_pool::worker_pool(iallocator& allocator, uint32_t num_workers)
+			: m_num_threads(num_workers > 1 ? (num_workers - 1) : 0)
+			, m_allocator(allocator)
+			, m_threads(nullptr)
+			, m_job_function(nullptr)
+			, m_job(nullptr)
+			, m_job_generation(0)
+			, m_num_pending_workers(0)
+			, m_is_exiting(false)
+		{
+			if (m_num_threads == 0)
+				return;
+
+			m_threads = allocate_type_array<std::thread>(allocator, m_num_threads);
+			for (uint32_t thread_index = 0; thread_index < m_num_threads; ++thread_index)
+				m_threads[thread_index] = std::thread(&worker_pool::worker_main, this, thread_index + 1);
+		}
+
+		inline worker_pool::~worker_pool()
+		{
+			if (m_num_threads == 0)
+				return;
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_is_exiting = true;
+			}
+			m_job_ready.notify_all();
+
+			for (uint32_t thread_index = 0; thread_index < m_num_threads; ++thread_index)
+				m_threads[thread_index].join();
+
+			deallocate_type_array(m_allocator, m_threads, m_num_threads);
+		}
+
+		inline void worker_pool::dispatch(job_function function, void* job)
+		{
+			if (m_num_threads != 0)
+			{
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_job_function = function;
+					m_job = job;
+					m_num_pending_workers = m_num_threads;
+					m_job_generation++;
+				}
+				m_job_ready.notify_all();
+			}
+
+			function(job, 0);
+
+			if (m_num_threads != 0)
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_job_done.wait(lock, [this]() { return m_num_pending_workers == 0; });
+
+				m_job_function = nullptr;
+				m_job = nullptr;
+			}
+		}
+
+		inline void worker_pool::worker_main(uint32_t worker_index)
+		{
+			uint32_t last_job_generation = 0;
+
+			while (true)
+			{
+				job_function function;
+				void* job;
+
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_job_ready.wait(lock, [this, last_job_generation]() { return m_is_exiting || m_job_generation != last_job_generation; });
+
+					if (m_is_exiting)
+						return;
+
+					last_job_generation = m_job_generation;
+					function = m_job_function;
+					job = m_job;
+				}
+
+				function(job, worker_index);
+
+				bool is_last_worker;
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					is_last_worker = --m_num_pending_workers == 0;
+				}
+
+				if (is_last_worker)
+					m_job_done.notify_one();
+			}
+		}
+#else
+		inline worker_pool::worker_pool(iallocator& allocator, uint32_t num_workers)
+			: m_num_threads(0)
+		{
+			(void)allocator;
+			(void)num_workers;
+		}
+
+		inline worker_pool::~worker_pool() {}
+
+		inline void worker_pool::dispatch(job_function function, void* job)
+		{
+			function(job, 0);
+		}
+
+		inline void worker_pool::worker_main(uint32_t worker_index)
+		{
+			(void)worker_index;
+		}
+#endif
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -45,20 +45,20 @@ namespace acl
 
 	namespace acl_impl
 	{
-		inline void write_compression_stats(const track_list_context& context, const compressed_tracks& tracks, const scope_profiler& compression_time, output_stats& stats)
+		inline void write_compression_stats(const track_list_context& context, const track_array& track_list, const compressed_tracks& tracks, const scope_profiler& compression_time, output_stats& stats)
 		{
 			ACL_ASSERT(stats.writer != nullptr, "Attempted to log stats without a writer");
 			if (stats.writer == nullptr)
 				return;
 
-			const uint32_t raw_size = context.reference_list->get_raw_size();
+			const uint32_t raw_size = track_list.get_raw_size();
 			const uint32_t compressed_size = tracks.get_size();
 			const double compression_ratio = double(raw_size) / double(compressed_size);
 
 			sjson::ObjectWriter& writer = *stats.writer;
-			writer["algorithm_name"] = get_algorithm_name(algorithm_type8::uniformly_sampled);
+			writer["algorithm_name"] = get_algorithm_name(tracks.get_algorithm_type());
 			//writer["algorithm_uid"] = settings.get_hash();
-			writer["clip_name"] = context.reference_list->get_name().c_str();
+			writer["clip_name"] = track_list.get_name().c_str();
 			writer["raw_size"] = raw_size;
 			writer["compressed_size"] = compressed_size;
 			writer["compression_ratio"] = compression_ratio;
@@ -81,9 +81,9 @@ namespace acl
 				{
 					stripped_segment_header_t& header = stripped_segment_headers[segment_index];
 
-					ACL_ASSERT(header.animated_pose_bit_size == 0, "Buffer overrun detected");
+					ACL_ASSERT(header.animated_pose_packed == 0, "Buffer overrun detected");
 
-					header.animated_pose_bit_size = segment.animated_pose_bit_size;
+					header.set_animated_pose(compressed_tracks_version16::latest, segment.animated_pose_bit_size, segment.are_samples_byte_aligned);
 					header.animated_rotation_bit_size = segment.animated_rotation_bit_size;
 					header.animated_translation_bit_size = segment.animated_translation_bit_size;
 					header.segment_data = segment_data_offset;
@@ -101,9 +101,9 @@ namespace acl
 				{
 					segment_header& header = segment_headers[segment_index];
 
-					ACL_ASSERT(header.animated_pose_bit_size == 0, "Buffer overrun detected");
+					ACL_ASSERT(header.animated_pose_packed == 0, "Buffer overrun detected");
 
-					header.animated_pose_bit_size = segment.animated_pose_bit_size;
+					header.set_animated_pose(compressed_tracks_version16::latest, segment.animated_pose_bit_size, segment.are_samples_byte_aligned);
 					header.animated_rotation_bit_size = segment.animated_rotation_bit_size;
 					header.animated_translation_bit_size = segment.animated_translation_bit_size;
 					header.segment_data = segment_data_offset;
@@ -630,6 +630,35 @@ namespace acl
 					timings_writer["keyframe_stripping"] = compression_stats.keyframe_stripping_elapsed_seconds;
 					timings_writer["output_packing"] = compression_stats.output_packing_elapsed_seconds;
 				};
+
+				writer["memory"] = [&](sjson::ObjectWriter& memory_writer)
+				{
+					memory_writer["peak_size"] = static_cast<uint64_t>(compression_stats.peak_memory_size);
+					memory_writer["num_allocations"] = compression_stats.num_allocations;
+
+					auto write_stage_memory_stats = [&](const char* stage_name, const compression_stage_memory_stats_t& stage_stats)
+					{
+						memory_writer[stage_name] = [&](sjson::ObjectWriter& stage_writer)
+						{
+							stage_writer["peak_size"] = static_cast<uint64_t>(stage_stats.peak_size);
+							stage_writer["num_allocations"] = stage_stats.num_allocations;
+							stage_writer["num_deallocations"] = stage_stats.num_deallocations;
+						};
+					};
+
+					write_stage_memory_stats("initialization", compression_stats.initialization_memory);
+					write_stage_memory_stats("convert_rotations", compression_stats.convert_rotations_memory);
+					write_stage_memory_stats("extract_clip_ranges", compression_stats.extract_clip_ranges_memory);
+					write_stage_memory_stats("compact_constant_sub_tracks", compression_stats.compact_constant_sub_tracks_memory);
+					write_stage_memory_stats("segmenting", compression_stats.segmenting_memory);
+					write_stage_memory_stats("extract_segment_ranges", compression_stats.extract_segment_ranges_memory);
+					write_stage_memory_stats("bit_rate_optimization", compression_stats.bit_rate_optimization_memory);
+					write_stage_memory_stats("keyframe_stripping", compression_stats.keyframe_stripping_memory);
+					write_stage_memory_stats("output_packing", compression_stats.output_packing_memory);
+
+					memory_writer["bit_rate_optimization_scratch_high_water_mark"] = static_cast<uint64_t>(compression_stats.bit_rate_optimization_scratch_high_water_mark);
+					memory_writer["bit_rate_optimization_scratch_ratio"] = compression_stats.peak_memory_size != 0 ? (double(compression_stats.bit_rate_optimization_scratch_high_water_mark) / double(compression_stats.peak_memory_size)) : 0.0;
+				};
 			}
 		}
 	}
@@ -108,11 +108,15 @@ namespace acl
 			out_num_animated_pose_bits += num_bits_at_bit_rate;
 		}
 
-		inline void calculate_animated_data_size(const track_stream& track_stream, uint32_t& num_animated_pose_bits)
+		inline void calculate_animated_data_size(const track_stream& track_stream, uint32_t& num_animated_pose_bits, bool& are_samples_byte_aligned)
 		{
 			if (track_stream.is_bit_rate_variable())
 			{
-				get_animated_variable_bit_rate_data_size(track_stream, num_animated_pose_bits);
+				uint32_t num_sample_bits = 0;
+				get_animated_variable_bit_rate_data_size(track_stream, num_sample_bits);
+
+				num_animated_pose_bits += num_sample_bits;
+				are_samples_byte_aligned &= is_byte_aligned_bit_rate(track_stream.get_bit_rate());
 			}
 			else
 			{
@@ -128,6 +132,7 @@ namespace acl
 				uint32_t num_animated_pose_rotation_data_bits = 0;
 				uint32_t num_animated_pose_translation_data_bits = 0;
 				uint32_t num_animated_pose_scale_data_bits = 0;
+				bool are_samples_byte_aligned = true;
 
 				for (uint32_t output_index = 0; output_index < num_output_bones; ++output_index)
 				{
@@ -135,13 +140,13 @@ namespace acl
 					const transform_streams& bone_stream = segment.bone_streams[bone_index];
 
 					if (!bone_stream.is_rotation_constant)
-						calculate_animated_data_size(bone_stream.rotations, num_animated_pose_rotation_data_bits);
+						calculate_animated_data_size(bone_stream.rotations, num_animated_pose_rotation_data_bits, are_samples_byte_aligned);
 
 					if (!bone_stream.is_translation_constant)
-						calculate_animated_data_size(bone_stream.translations, num_animated_pose_translation_data_bits);
+						calculate_animated_data_size(bone_stream.translations, num_animated_pose_translation_data_bits, are_samples_byte_aligned);
 
 					if (!bone_stream.is_scale_constant)
-						calculate_animated_data_size(bone_stream.scales, num_animated_pose_scale_data_bits);
+						calculate_animated_data_size(bone_stream.scales, num_animated_pose_scale_data_bits, are_samples_byte_aligned);
 				}
 
 				const uint32_t num_animated_pose_bits = num_animated_pose_rotation_data_bits + num_animated_pose_translation_data_bits + num_animated_pose_scale_data_bits;
@@ -152,6 +157,7 @@ namespace acl
 				segment.animated_scale_bit_size = num_animated_pose_scale_data_bits;
 				segment.animated_data_size = align_to(num_animated_data_bits, 8) / 8;
 				segment.animated_pose_bit_size = num_animated_pose_bits;
+				segment.are_samples_byte_aligned = are_samples_byte_aligned;
 			}
 		}
 
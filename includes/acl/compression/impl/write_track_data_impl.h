@@ -25,12 +25,16 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/memory_utils.h"
 #include "acl/core/impl/bit_cast.impl.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/impl/compressed_headers.h"
+#include "acl/core/impl/spline_key_utils.h"
 #include "acl/core/impl/variable_bit_rates.h"
+#include "acl/core/range_reduction_types.h"
 #include "acl/compression/impl/track_list_context.h"
 
+#include <rtm/scalarf.h>
 #include <rtm/vector4f.h>
 
 #include <cstdint>
@@ -55,7 +59,19 @@ namespace acl
 				const uint32_t track_index = context.track_output_indices[output_index];
 
 				if (per_track_metadata != nullptr)
-					per_track_metadata[output_index].bit_rate = context.is_constant(track_index) ? static_cast<uint8_t>(0) : context.bit_rate_list[track_index].scalar.value;
+				{
+					uint8_t bit_rate;
+					if (context.is_constant(track_index))
+						bit_rate = 0;
+					else if (context.is_sparse(track_index))
+						bit_rate = k_scalar_sparse_track_bit_rate;
+					else if (context.is_decimated(track_index))
+						bit_rate = k_scalar_decimated_track_bit_rate;
+					else
+						bit_rate = context.bit_rate_list[track_index].scalar.value;
+
+					per_track_metadata[output_index].bit_rate = bit_rate;
+				}
 
 				output_buffer += sizeof(track_metadata);
 			}
@@ -63,6 +79,75 @@ namespace acl
 			return safe_static_cast<uint32_t>(output_buffer - output_buffer_start);
 		}
 
+		inline uint32_t write_track_offsets(const track_list_context& context, scalar_track_offsets* track_offsets)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			const uint8_t* output_buffer = bit_cast<uint8_t*>(track_offsets);
+			const uint8_t* output_buffer_start = output_buffer;
+
+			const uint32_t num_components = get_track_num_sample_elements(context.reference_list->get_track_type());
+
+			// With spline key reduction, we count the animated tracks instead of their bits
+			const bool use_spline_keys = context.spline_key_blocks != nullptr;
+
+			uint32_t animated_bit_offset = 0;
+			uint32_t constant_value_offset = 0;
+			uint32_t range_value_offset = 0;
+			uint32_t sparse_track_offset = 0;
+			uint32_t decimated_track_offset = 0;
+
+			for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+			{
+				if ((output_index % k_scalar_track_offsets_stride) == 0)
+				{
+					// Start of a new group, write the offsets of its first track
+					if (track_offsets != nullptr)
+					{
+						scalar_track_offsets& offsets = track_offsets[output_index / k_scalar_track_offsets_stride];
+						offsets.animated_bit_offset = animated_bit_offset;
+						offsets.constant_value_offset = constant_value_offset;
+						offsets.range_value_offset = range_value_offset;
+						offsets.sparse_track_offset = sparse_track_offset;
+						offsets.decimated_track_offset = decimated_track_offset;
+					}
+
+					output_buffer += sizeof(scalar_track_offsets);
+				}
+
+				const uint32_t track_index = context.track_output_indices[output_index];
+
+				if (context.is_constant(track_index))
+				{
+					constant_value_offset += num_components;
+					continue;
+				}
+
+				if (context.is_sparse(track_index))
+				{
+					// Sparse tracks store their inactive value with the constant values
+					constant_value_offset += num_components;
+					sparse_track_offset++;
+					continue;
+				}
+
+				if (context.is_decimated(track_index))
+				{
+					// Decimated tracks live entirely in the decimated track data
+					decimated_track_offset++;
+					continue;
+				}
+
+				const uint8_t bit_rate = context.bit_rate_list[track_index].scalar.value;
+				animated_bit_offset += use_spline_keys ? 1 : (get_num_bits_at_bit_rate(bit_rate) * num_components);
+
+				if (!is_raw_bit_rate(bit_rate))
+					range_value_offset += num_components * 2;
+			}
+
+			return safe_static_cast<uint32_t>(output_buffer - output_buffer_start);
+		}
+
 		inline uint32_t write_track_constant_values(const track_list_context& context, float* constant_values)
 		{
 			ACL_ASSERT(context.is_valid(), "Invalid context");
@@ -74,14 +159,17 @@ namespace acl
 			{
 				const uint32_t track_index = context.track_output_indices[output_index];
 
-				if (!context.is_constant(track_index))
+				if (context.is_animated(track_index) || context.is_decimated(track_index))
 					continue;
 
 				const track& ref_track = (*context.reference_list)[track_index];
 				const uint32_t element_size = ref_track.get_sample_size();
 
+				// Sparse tracks store their inactive value
+				const uint32_t sample_index = context.is_sparse(track_index) ? context.sparse_tracks[track_index].inactive_sample_index : 0;
+
 				if (constant_values != nullptr)
-					std::memcpy(output_buffer, ref_track[0], element_size);
+					std::memcpy(output_buffer, ref_track[sample_index], element_size);
 
 				output_buffer += element_size;
 			}
@@ -100,7 +188,7 @@ namespace acl
 			{
 				const uint32_t track_index = context.track_output_indices[output_index];
 
-				if (context.is_constant(track_index))
+				if (!context.is_animated(track_index))
 					continue;
 
 				const uint8_t bit_rate = context.bit_rate_list[track_index].scalar.value;
@@ -129,49 +217,131 @@ namespace acl
 			return safe_static_cast<uint32_t>(output_buffer - output_buffer_start);
 		}
 
-		inline uint32_t write_track_animated_values(const track_list_context& context, uint8_t* animated_values)
+		// Returns the number of bits used by a whole frame of animated values
+		inline uint32_t calculate_num_bits_per_frame(const track_list_context& context)
 		{
 			ACL_ASSERT(context.is_valid(), "Invalid context");
 
-			uint8_t* output_buffer = animated_values;
-			uint64_t output_bit_offset = 0;
+			const uint32_t num_components = get_track_num_sample_elements(context.reference_list->get_track_type());
+
+			uint32_t num_bits_per_frame = 0;
+			for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+			{
+				const uint32_t track_index = context.track_output_indices[output_index];
+
+				if (!context.is_animated(track_index))
+					continue;
+
+				num_bits_per_frame += get_num_bits_at_bit_rate(context.bit_rate_list[track_index].scalar.value) * num_components;
+			}
+
+			return num_bits_per_frame;
+		}
+
+		// Returns the number of bytes used by the range data of a segment, one per range value
+		inline uint32_t calculate_segment_range_data_size(const track_list_context& context)
+		{
+			if (!context.has_segments)
+				return 0;
+
+			return write_track_range_values(context, nullptr) / sizeof(float);
+		}
+
+		inline uint32_t write_segment_table(const track_list_context& context, uint32_t* segment_table)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			if (!context.has_segments)
+				return 0;
+
+			const uint32_t num_bits_per_frame = calculate_num_bits_per_frame(context);
+			const uint32_t segment_range_data_size = calculate_segment_range_data_size(context);
+
+			if (segment_table != nullptr)
+				segment_table[0] = context.num_segments;
+
+			scalar_segment_header* segment_headers = segment_table != nullptr ? bit_cast<scalar_segment_header*>(segment_table + 1) : nullptr;
+
+			uint32_t segment_data_offset = 0;
+			for (uint32_t segment_index = 0; segment_index < context.num_segments; ++segment_index)
+			{
+				if (segment_headers != nullptr)
+				{
+					segment_headers[segment_index].start_sample_index = context.segment_start_sample_indices[segment_index];
+					segment_headers[segment_index].segment_data_offset = segment_data_offset;
+				}
+
+				const uint64_t num_animated_bits = uint64_t(context.get_segment_num_samples(segment_index)) * num_bits_per_frame;
+				segment_data_offset += segment_range_data_size + safe_static_cast<uint32_t>((num_animated_bits + 7) / 8);	// Round up to nearest byte
+			}
+
+			return sizeof(uint32_t) + context.num_segments * sizeof(scalar_segment_header);
+		}
+
+		inline uint32_t write_decimated_track_data(const track_list_context& context, uint8_t* decimated_track_data)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			if (context.decimated_tracks == nullptr)
+				return 0;
 
 			const uint32_t num_components = get_track_num_sample_elements(context.reference_list->get_track_type());
 			ACL_ASSERT(num_components <= 4, "Unexpected number of elements");
 
-			for (uint32_t sample_index = 0; sample_index < context.num_samples; ++sample_index)
+			uint32_t num_decimated_tracks = 0;
+			for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
 			{
-				for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
-				{
-					const uint32_t track_index = context.track_output_indices[output_index];
+				if (context.is_decimated(context.track_output_indices[output_index]))
+					num_decimated_tracks++;
+			}
 
-					if (context.is_constant(track_index))
-						continue;
+			if (num_decimated_tracks == 0)
+				return 0;
 
-					const track& ref_track = (*context.reference_list)[track_index];
-					const track& mut_track = context.track_list[track_index];
+			const uint32_t track_headers_offset = sizeof(uint32_t) * 2;
+			uint32_t track_data_offset = track_headers_offset + num_decimated_tracks * sizeof(scalar_decimated_track_header);
 
-					// Only support scalarf for now
-					ACL_ASSERT(ref_track.get_category() == track_category8::scalarf, "Unsupported category");
+			uint32_t decimated_track_index = 0;
+			for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+			{
+				const uint32_t track_index = context.track_output_indices[output_index];
+				if (!context.is_decimated(track_index))
+					continue;
 
-					const scalar_bit_rate bit_rate = context.bit_rate_list[track_index].scalar;
-					const uint64_t num_bits_per_component = get_num_bits_at_bit_rate(bit_rate.value);
+				const decimated_track& decimated = context.decimated_tracks[track_index];
+				const uint64_t num_bits_per_component = get_num_bits_at_bit_rate(decimated.bit_rate);
 
-					const track& src_track = is_raw_bit_rate(bit_rate.value) ? ref_track : mut_track;
+				if (decimated_track_data != nullptr)
+				{
+					scalar_decimated_track_header& header = safe_ptr_cast<scalar_decimated_track_header>(decimated_track_data + track_headers_offset)[decimated_track_index];
+					header.data_offset = track_data_offset;
+					header.decimation_shift = decimated.decimation_shift;
+					header.bit_rate = decimated.bit_rate;
+
+					// Our range comes first, it is always present even if the track is raw
+					const uint32_t element_size = num_components * sizeof(float);
+					std::memcpy(decimated_track_data + track_data_offset, &decimated.range_min, element_size);
+					std::memcpy(decimated_track_data + track_data_offset + element_size, &decimated.range_extent, element_size);
+				}
+
+				track_data_offset += num_components * sizeof(float) * 2;
+
+				uint8_t* output_buffer = decimated_track_data != nullptr ? (decimated_track_data + track_data_offset) : nullptr;
+				uint64_t output_bit_offset = 0;
 
-					const uint32_t* sample_u32 = safe_ptr_cast<const uint32_t>(src_track[sample_index]);
-					const float* sample_f32 = safe_ptr_cast<const float>(src_track[sample_index]);
+				for (uint32_t decimated_index = 0; decimated_index < decimated.num_samples; ++decimated_index)
+				{
+					const uint32_t* sample_u32 = safe_ptr_cast<const uint32_t>(&decimated.samples[decimated_index]);
+					const float* sample_f32 = safe_ptr_cast<const float>(&decimated.samples[decimated_index]);
 					for (uint32_t component_index = 0; component_index < num_components; ++component_index)
 					{
-						if (animated_values != nullptr)
+						if (decimated_track_data != nullptr)
 						{
 							uint32_t value;
-							if (is_raw_bit_rate(bit_rate.value))
+							if (is_raw_bit_rate(decimated.bit_rate))
 								value = byte_swap(sample_u32[component_index]);
 							else
 							{
-								// TODO: Hacked, our values are still as floats, cast to int, shift, and byte swap
-								// Ideally should be done in the cache/mutable track with SIMD
 								value = safe_static_cast<uint32_t>(sample_f32[component_index]);
 								value = value << (32 - num_bits_per_component);
 								value = byte_swap(value);
@@ -183,6 +353,326 @@ namespace acl
 						output_bit_offset += num_bits_per_component;
 					}
 				}
+
+				track_data_offset += align_to(safe_static_cast<uint32_t>((output_bit_offset + 7) / 8), 4);	// Round up to nearest byte and keep our floats aligned
+				decimated_track_index++;
+			}
+
+			if (decimated_track_data != nullptr)
+			{
+				safe_ptr_cast<uint32_t>(decimated_track_data)[0] = track_data_offset;
+				safe_ptr_cast<uint32_t>(decimated_track_data)[1] = num_decimated_tracks;
+			}
+
+			return track_data_offset;
+		}
+
+		inline uint32_t write_sparse_track_data(const track_list_context& context, uint8_t* sparse_track_data)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			if (context.sparse_tracks == nullptr)
+				return 0;
+
+			const uint32_t num_components = get_track_num_sample_elements(context.reference_list->get_track_type());
+			ACL_ASSERT(num_components <= 4, "Unexpected number of elements");
+
+			uint32_t num_sparse_tracks = 0;
+			uint32_t num_spans = 0;
+			for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+			{
+				const uint32_t track_index = context.track_output_indices[output_index];
+				if (context.is_sparse(track_index))
+				{
+					num_sparse_tracks++;
+					num_spans += context.sparse_tracks[track_index].num_spans;
+				}
+			}
+
+			if (num_sparse_tracks == 0)
+				return 0;
+
+			if (sparse_track_data != nullptr)
+				*safe_ptr_cast<uint32_t>(sparse_track_data) = num_sparse_tracks;
+
+			const uint32_t track_headers_offset = sizeof(uint32_t);
+			uint32_t spans_offset = track_headers_offset + num_sparse_tracks * sizeof(scalar_sparse_track_header);
+			uint32_t span_data_offset = spans_offset + num_spans * sizeof(scalar_sparse_span);
+
+			uint32_t sparse_track_index = 0;
+			for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+			{
+				const uint32_t track_index = context.track_output_indices[output_index];
+				if (!context.is_sparse(track_index))
+					continue;
+
+				const track& ref_track = (*context.reference_list)[track_index];
+				const track& mut_track = context.track_list[track_index];
+				const sparse_track& sparse = context.sparse_tracks[track_index];
+
+				if (sparse_track_data != nullptr)
+				{
+					scalar_sparse_track_header& header = safe_ptr_cast<scalar_sparse_track_header>(sparse_track_data + track_headers_offset)[sparse_track_index];
+					header.num_spans = sparse.num_spans;
+					header.spans_offset = spans_offset;
+				}
+
+				for (uint32_t span_index = 0; span_index < sparse.num_spans; ++span_index)
+				{
+					const sparse_track_span& span = sparse.spans[span_index];
+					const uint64_t num_bits_per_component = get_num_bits_at_bit_rate(span.bit_rate);
+
+					if (sparse_track_data != nullptr)
+					{
+						scalar_sparse_span& span_header = *safe_ptr_cast<scalar_sparse_span>(sparse_track_data + spans_offset);
+						span_header.start_sample_index = span.start_sample_index;
+						span_header.num_samples = span.num_samples;
+						span_header.data_offset = span_data_offset;
+						span_header.bit_rate = span.bit_rate;
+
+						// Our range comes first, it is always present even if the span is raw
+						const uint32_t element_size = num_components * sizeof(float);
+						std::memcpy(sparse_track_data + span_data_offset, &span.range_min, element_size);
+						std::memcpy(sparse_track_data + span_data_offset + element_size, &span.range_extent, element_size);
+					}
+
+					spans_offset += sizeof(scalar_sparse_span);
+					span_data_offset += num_components * sizeof(float) * 2;
+
+					uint8_t* output_buffer = sparse_track_data != nullptr ? (sparse_track_data + span_data_offset) : nullptr;
+					uint64_t output_bit_offset = 0;
+
+					const uint32_t end_sample_index = span.start_sample_index + span.num_samples;
+					for (uint32_t sample_index = span.start_sample_index; sample_index < end_sample_index; ++sample_index)
+					{
+						const track& src_track = is_raw_bit_rate(span.bit_rate) ? ref_track : mut_track;
+
+						const uint32_t* sample_u32 = safe_ptr_cast<const uint32_t>(src_track[sample_index]);
+						const float* sample_f32 = safe_ptr_cast<const float>(src_track[sample_index]);
+						for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+						{
+							if (sparse_track_data != nullptr)
+							{
+								uint32_t value;
+								if (is_raw_bit_rate(span.bit_rate))
+									value = byte_swap(sample_u32[component_index]);
+								else
+								{
+									value = safe_static_cast<uint32_t>(sample_f32[component_index]);
+									value = value << (32 - num_bits_per_component);
+									value = byte_swap(value);
+								}
+
+								memcpy_bits(output_buffer, output_bit_offset, &value, 0, num_bits_per_component);
+							}
+
+							output_bit_offset += num_bits_per_component;
+						}
+					}
+
+					span_data_offset += align_to(safe_static_cast<uint32_t>((output_bit_offset + 7) / 8), 4);	// Round up to nearest byte and keep our floats aligned
+				}
+
+				sparse_track_index++;
+			}
+
+			return span_data_offset;
+		}
+
+		// Writes our spline keys in place of the animated values, see spline_key_utils.h for the layout
+		inline uint32_t write_spline_key_blocks(const track_list_context& context, bool has_track_offsets, uint8_t* animated_values)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			const uint32_t num_components = get_track_num_sample_elements(context.reference_list->get_track_type());
+			ACL_ASSERT(num_components <= 4, "Unexpected number of elements");
+
+			const uint32_t num_blocks = context.num_spline_key_blocks;
+			const uint32_t num_groups = calculate_num_spline_key_groups(context.num_output_tracks, has_track_offsets);
+
+			uint32_t num_animated_tracks = 0;
+			for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+			{
+				if (context.is_animated(context.track_output_indices[output_index]))
+					num_animated_tracks++;
+			}
+
+			if (animated_values != nullptr)
+			{
+				safe_ptr_cast<uint32_t>(animated_values)[0] = context.num_samples_per_spline_key_block;
+				safe_ptr_cast<uint32_t>(animated_values)[1] = num_animated_tracks;
+			}
+
+			uint32_t block_offset = sizeof(uint32_t) * 2 + num_blocks * sizeof(uint32_t);
+			for (uint32_t block_index = 0; block_index < num_blocks; ++block_index)
+			{
+				uint8_t* block_data = animated_values != nullptr ? (animated_values + block_offset) : nullptr;
+				if (animated_values != nullptr)
+					safe_ptr_cast<uint32_t>(animated_values)[2 + block_index] = block_offset;
+
+				uint32_t num_block_keys = 0;
+				for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+				{
+					const uint32_t track_index = context.track_output_indices[output_index];
+					if (context.is_animated(track_index))
+						num_block_keys += context.spline_key_blocks[block_index * context.num_tracks + track_index].num_keys;
+				}
+
+				const uint32_t group_offsets_offset = sizeof(uint32_t);
+				uint32_t num_keys_offset = group_offsets_offset + num_groups * sizeof(spline_key_group_offsets);
+				uint32_t sample_offsets_offset = num_keys_offset + num_animated_tracks;
+				const uint32_t values_start_offset = align_to(sample_offsets_offset + num_block_keys, 4);
+				uint32_t values_offset = values_start_offset;
+
+				if (block_data != nullptr)
+					*safe_ptr_cast<uint32_t>(block_data) = values_start_offset;
+
+				const uint32_t keys_start_offset = sample_offsets_offset;
+
+				for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+				{
+					if (num_groups != 0 && (output_index % k_scalar_track_offsets_stride) == 0 && block_data != nullptr)
+					{
+						// Start of a new group, write where the keys of its first animated track start
+						spline_key_group_offsets& group_offsets = safe_ptr_cast<spline_key_group_offsets>(block_data + group_offsets_offset)[output_index / k_scalar_track_offsets_stride];
+						group_offsets.key_offset = sample_offsets_offset - keys_start_offset;
+						group_offsets.key_value_offset = values_offset - values_start_offset;
+					}
+
+					const uint32_t track_index = context.track_output_indices[output_index];
+					if (!context.is_animated(track_index))
+						continue;
+
+					const spline_key_block& block = context.spline_key_blocks[block_index * context.num_tracks + track_index];
+					const bool is_raw = is_raw_bit_rate(context.bit_rate_list[track_index].scalar.value);
+					const uint32_t key_size = num_components * (is_raw ? sizeof(float) : sizeof(uint16_t));
+
+					if (block_data != nullptr)
+					{
+						block_data[num_keys_offset] = block.num_keys;
+						std::memcpy(block_data + sample_offsets_offset, &block.sample_offsets[0], block.num_keys);
+
+						for (uint32_t key_index = 0; key_index < block.num_keys; ++key_index)
+						{
+							uint8_t* key_value = block_data + values_offset + key_index * key_size;
+							if (is_raw)
+								std::memcpy(key_value, &block.values[key_index], key_size);
+							else
+								std::memcpy(key_value, &block.quantized_values[key_index][0], key_size);
+						}
+					}
+
+					num_keys_offset++;
+					sample_offsets_offset += block.num_keys;
+					values_offset += align_to(block.num_keys * key_size, 4);	// Keep our floats aligned
+				}
+
+				block_offset += values_offset;
+			}
+
+			return block_offset;
+		}
+
+		inline uint32_t write_track_animated_values(const track_list_context& context, uint8_t* animated_values)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			uint8_t* output_buffer = animated_values;
+			uint64_t output_bit_offset = 0;
+
+			const uint32_t num_components = get_track_num_sample_elements(context.reference_list->get_track_type());
+			ACL_ASSERT(num_components <= 4, "Unexpected number of elements");
+
+			const float max_range_value_flt = float((1 << k_segment_range_reduction_num_bits_per_component) - 1);
+
+			for (uint32_t segment_index = 0; segment_index < context.num_segments; ++segment_index)
+			{
+				// Every segment starts on a byte boundary
+				output_bit_offset = ((output_bit_offset + 7) / 8) * 8;
+
+				if (context.has_segments)
+				{
+					// Our segment range data comes first, it mirrors our range values
+					for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+					{
+						const uint32_t track_index = context.track_output_indices[output_index];
+
+						if (!context.is_animated(track_index))
+							continue;
+
+						const uint8_t bit_rate = context.bit_rate_list[track_index].scalar.value;
+						if (is_raw_bit_rate(bit_rate))
+							continue;
+
+						const scalar_segment_range& segment_range = context.segment_ranges[segment_index * context.num_tracks + track_index];
+
+						if (animated_values != nullptr)
+						{
+							float range_min[4];
+							float range_extent[4];
+							rtm::vector_store(segment_range.min, &range_min[0]);
+							rtm::vector_store(segment_range.extent, &range_extent[0]);
+
+							uint8_t* segment_range_data = output_buffer + (output_bit_offset / 8);
+							for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+							{
+								segment_range_data[component_index] = safe_static_cast<uint8_t>(rtm::scalar_round_symmetric(range_min[component_index] * max_range_value_flt));
+								segment_range_data[num_components + component_index] = safe_static_cast<uint8_t>(rtm::scalar_round_symmetric(range_extent[component_index] * max_range_value_flt));
+							}
+						}
+
+						output_bit_offset += uint64_t(num_components) * 2 * 8;	// Min and extent
+					}
+				}
+
+				const uint32_t start_sample_index = context.segment_start_sample_indices[segment_index];
+				const uint32_t end_sample_index = start_sample_index + context.get_segment_num_samples(segment_index);
+
+				for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; ++sample_index)
+				{
+					for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+					{
+						const uint32_t track_index = context.track_output_indices[output_index];
+
+						if (!context.is_animated(track_index))
+							continue;
+
+						const track& ref_track = (*context.reference_list)[track_index];
+						const track& mut_track = context.track_list[track_index];
+
+						// Only support scalarf for now
+						ACL_ASSERT(ref_track.get_category() == track_category8::scalarf, "Unsupported category");
+
+						const scalar_bit_rate bit_rate = context.bit_rate_list[track_index].scalar;
+						const uint64_t num_bits_per_component = get_num_bits_at_bit_rate(bit_rate.value);
+
+						const track& src_track = is_raw_bit_rate(bit_rate.value) ? ref_track : mut_track;
+
+						const uint32_t* sample_u32 = safe_ptr_cast<const uint32_t>(src_track[sample_index]);
+						const float* sample_f32 = safe_ptr_cast<const float>(src_track[sample_index]);
+						for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+						{
+							if (animated_values != nullptr)
+							{
+								uint32_t value;
+								if (is_raw_bit_rate(bit_rate.value))
+									value = byte_swap(sample_u32[component_index]);
+								else
+								{
+									// TODO: Hacked, our values are still as floats, cast to int, shift, and byte swap
+									// Ideally should be done in the cache/mutable track with SIMD
+									value = safe_static_cast<uint32_t>(sample_f32[component_index]);
+									value = value << (32 - num_bits_per_component);
+									value = byte_swap(value);
+								}
+
+								memcpy_bits(output_buffer, output_bit_offset, &value, 0, num_bits_per_component);
+							}
+
+							output_bit_offset += num_bits_per_component;
+						}
+					}
+				}
 			}
 
 			return safe_static_cast<uint32_t>(output_bit_offset);
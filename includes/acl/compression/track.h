@@ -369,6 +369,12 @@ namespace acl
 	using track_float3f			= track_typed<track_type8::float3f>;
 	using track_float4f			= track_typed<track_type8::float4f>;
 	using track_vector4f		= track_typed<track_type8::vector4f>;
+	using track_float1d			= track_typed<track_type8::float1d>;
+	using track_float2d			= track_typed<track_type8::float2d>;
+	using track_float3d			= track_typed<track_type8::float3d>;
+	using track_float4d			= track_typed<track_type8::float4d>;
+	using track_vector4d		= track_typed<track_type8::vector4d>;
+	using track_quatf			= track_typed<track_type8::quatf>;
 	using track_qvvf			= track_typed<track_type8::qvvf>;
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -302,6 +302,12 @@ namespace acl
 	using track_array_float3f	= track_array_typed<track_type8::float3f>;
 	using track_array_float4f	= track_array_typed<track_type8::float4f>;
 	using track_array_vector4f	= track_array_typed<track_type8::vector4f>;
+	using track_array_float1d	= track_array_typed<track_type8::float1d>;
+	using track_array_float2d	= track_array_typed<track_type8::float2d>;
+	using track_array_float3d	= track_array_typed<track_type8::float3d>;
+	using track_array_float4d	= track_array_typed<track_type8::float4d>;
+	using track_array_vector4d	= track_array_typed<track_type8::vector4d>;
+	using track_array_quatf		= track_array_typed<track_type8::quatf>;
 	using track_array_qvvf		= track_array_typed<track_type8::qvvf>;
 
 	ACL_IMPL_VERSION_NAMESPACE_END
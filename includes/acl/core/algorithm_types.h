@@ -47,7 +47,7 @@ namespace acl
 	{
 		uniformly_sampled				= 0,
 		//LinearKeyReduction			= 1,
-		//SplineKeyReduction			= 2,
+		spline_key_reduction			= 2,	// Scalar tracks only
 	};
 
 	//////////////////////////////////////////////////////////////////////////
@@ -62,7 +62,7 @@ namespace acl
 		{
 			case algorithm_type8::uniformly_sampled:
 			//case algorithm_type8::LinearKeyReduction:
-			//case algorithm_type8::SplineKeyReduction:
+			case algorithm_type8::spline_key_reduction:
 				return true;
 			default:
 				return false;
@@ -78,7 +78,7 @@ namespace acl
 		{
 			case algorithm_type8::uniformly_sampled:	return "uniformly_sampled";
 			//case algorithm_type8::LinearKeyReduction:	return "LinearKeyReduction";
-			//case algorithm_type8::SplineKeyReduction:	return "SplineKeyReduction";
+			case algorithm_type8::spline_key_reduction:	return "spline_key_reduction";
 			default:									return "<Invalid>";
 		}
 	}
@@ -103,6 +103,13 @@ namespace acl
 			return true;
 		}
 
+		const char* spline_key_reduction_name = "spline_key_reduction";
+		if (std::strncmp(type, spline_key_reduction_name, std::strlen(spline_key_reduction_name)) == 0)
+		{
+			out_type = algorithm_type8::spline_key_reduction;
+			return true;
+		}
+
 		return false;
 	}
 
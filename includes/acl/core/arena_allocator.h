@@ -0,0 +1,249 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/bit_cast.impl.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/error.h"
+#include "acl/core/memory_utils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// A linear (arena) allocator implementation. Memory is carved out of large blocks
+	// obtained from a backing allocator and individual deallocations are free.
+	//
+	// Only the most recent allocation can be reclaimed when it is deallocated, every
+	// other deallocation is a no-op and its memory remains used until the arena is reset.
+	// Resetting the arena makes every block available again without returning them to
+	// the backing allocator. This makes it a good fit for short lived scratch memory
+	// where lots of temporary allocations are made and released together.
+	//
+	// When compressing many clips in a batch, each worker thread can own an arena:
+	// compress a clip with it, copy the compressed tracks somewhere persistent, and
+	// reset it before moving on to the next clip. The high water mark reports the
+	// largest amount of memory the arena ever needed at once which can be used to
+	// size the blocks.
+	//
+	// An arena is not thread safe.
+	////////////////////////////////////////////////////////////////////////////////
+	class arena_allocator : public iallocator
+	{
+	public:
+		static constexpr size_t k_default_block_size = 1024 * 1024;
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Creates an empty arena. Blocks are allocated on demand from the backing allocator.
+		//
+		// backing_allocator: The allocator used to allocate and free our blocks.
+		// block_size: The size in bytes of each block. Larger allocations get a dedicated block.
+		explicit arena_allocator(iallocator& backing_allocator, size_t block_size = k_default_block_size)
+			: iallocator()
+			, m_backing_allocator(backing_allocator)
+			, m_block_size(block_size > k_block_header_size ? block_size : k_block_header_size)
+			, m_first_block(nullptr)
+			, m_current_block(nullptr)
+			, m_current_offset(k_block_header_size)
+			, m_previous_blocks_size(0)
+			, m_reserved_size(0)
+			, m_high_water_mark(0)
+		{}
+
+		virtual ~arena_allocator() override
+		{
+			release();
+		}
+
+		arena_allocator(const arena_allocator&) = delete;
+		arena_allocator& operator=(const arena_allocator&) = delete;
+
+		virtual void* allocate(size_t size, size_t alignment = k_default_alignment) override
+		{
+			ACL_ASSERT(is_power_of_two(alignment), "The alignment must be power of two.");
+
+			if (m_current_block != nullptr)
+			{
+				void* ptr = try_allocate_from_current_block(size, alignment);
+				if (ptr != nullptr)
+					return ptr;
+
+				// We don't fit in our current block, the remaining space is lost until we reset
+				m_previous_blocks_size += m_current_block->size;
+			}
+
+			// Re-use the next block we retained if it is large enough, otherwise allocate a new one
+			block_header* next_block = m_current_block != nullptr ? m_current_block->next : m_first_block;
+			if (next_block == nullptr || !can_fit(next_block, size, alignment))
+			{
+				const size_t required_size = align_to(k_block_header_size + size + alignment, k_block_alignment);
+				const size_t new_block_size = std::max<size_t>(m_block_size, required_size);
+
+				block_header* new_block = acl_impl::bit_cast<block_header*>(m_backing_allocator.allocate(new_block_size, k_block_alignment));
+				if (new_block == nullptr)
+				{
+					if (m_current_block != nullptr)
+						m_previous_blocks_size -= m_current_block->size;	// Nothing changed
+					return nullptr;
+				}
+
+				new_block->next = next_block;
+				new_block->size = new_block_size;
+
+				if (m_current_block != nullptr)
+					m_current_block->next = new_block;
+				else
+					m_first_block = new_block;
+
+				m_reserved_size += new_block_size;
+				next_block = new_block;
+			}
+
+			m_current_block = next_block;
+			m_current_offset = k_block_header_size;
+
+			void* ptr = try_allocate_from_current_block(size, alignment);
+			ACL_ASSERT(ptr != nullptr, "Failed to allocate from a fresh block");
+			return ptr;
+		}
+
+		virtual void deallocate(void* ptr, size_t size) override
+		{
+			if (ptr == nullptr || m_current_block == nullptr)
+				return;
+
+			// If this is our most recent allocation, we can reclaim its memory
+			const uintptr_t block_start = acl_impl::bit_cast<uintptr_t>(m_current_block);
+			const uintptr_t allocation_start = acl_impl::bit_cast<uintptr_t>(ptr);
+			if (allocation_start + size == block_start + m_current_offset)
+				m_current_offset = static_cast<size_t>(allocation_start - block_start);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Releases every allocation at once. Blocks are retained to be re-used.
+		// Every pointer previously allocated becomes invalid.
+		void reset()
+		{
+			m_current_block = m_first_block;
+			m_current_offset = k_block_header_size;
+			m_previous_blocks_size = 0;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Releases every allocation and returns every block to the backing allocator.
+		// Every pointer previously allocated becomes invalid.
+		void release()
+		{
+			block_header* block = m_first_block;
+			while (block != nullptr)
+			{
+				block_header* next_block = block->next;
+				m_backing_allocator.deallocate(block, block->size);
+				block = next_block;
+			}
+
+			m_first_block = nullptr;
+			m_current_block = nullptr;
+			m_current_offset = k_block_header_size;
+			m_previous_blocks_size = 0;
+			m_reserved_size = 0;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the number of bytes currently used, including alignment padding and the space lost at the end of full blocks.
+		size_t get_used_size() const
+		{
+			return m_current_block != nullptr ? (m_previous_blocks_size + m_current_offset - k_block_header_size) : 0;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the number of bytes allocated from the backing allocator.
+		size_t get_reserved_size() const { return m_reserved_size; }
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the largest number of bytes used at once since the arena was created or
+		// since the high water mark was last reset.
+		size_t get_high_water_mark() const { return m_high_water_mark; }
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Resets the high water mark to the number of bytes currently used.
+		void reset_high_water_mark() { m_high_water_mark = get_used_size(); }
+
+	private:
+		struct block_header
+		{
+			block_header*	next;
+			size_t			size;
+		};
+
+		static constexpr size_t k_block_alignment = 64;
+		static constexpr size_t k_block_header_size = (sizeof(block_header) + k_block_alignment - 1) & ~(k_block_alignment - 1);
+
+		static bool can_fit(const block_header* block, size_t size, size_t alignment)
+		{
+			const uintptr_t block_start = acl_impl::bit_cast<uintptr_t>(block);
+			const uintptr_t allocation_start = align_to(block_start + k_block_header_size, alignment);
+			return (allocation_start - block_start) + size <= block->size;
+		}
+
+		void* try_allocate_from_current_block(size_t size, size_t alignment)
+		{
+			const uintptr_t block_start = acl_impl::bit_cast<uintptr_t>(m_current_block);
+			const uintptr_t allocation_start = align_to(block_start + m_current_offset, alignment);
+			const size_t allocation_offset = static_cast<size_t>(allocation_start - block_start);
+
+			if (allocation_offset + size > m_current_block->size)
+				return nullptr;
+
+			m_current_offset = allocation_offset + size;
+			m_high_water_mark = std::max<size_t>(m_high_water_mark, get_used_size());
+
+			return acl_impl::bit_cast<void*>(allocation_start);
+		}
+
+		iallocator&		m_backing_allocator;
+		size_t			m_block_size;
+
+		block_header*	m_first_block;
+		block_header*	m_current_block;
+		size_t			m_current_offset;			// Offset in bytes from the start of the current block
+		size_t			m_previous_blocks_size;		// Size in bytes of every block before the current one, they are fully used
+		size_t			m_reserved_size;
+		size_t			m_high_water_mark;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -67,6 +67,13 @@
 	#include <immintrin.h>		// Intel documentation says _andn_u32 and others are here
 #endif
 
+// BMI2 intrinsic support
+// Note: BMI2 is opt-in since AVX does not imply it and PDEP/PEXT are very slow on AMD CPUs before Zen 3
+// It is never detected from __BMI2__, ACL_BMI2_INTRINSICS must be defined explicitly to enable it
+#if defined(ACL_BMI2_INTRINSICS)
+	#include <immintrin.h>		// _pdep_u64, _bzhi_u32
+#endif
+
 ACL_IMPL_FILE_PRAGMA_PUSH
 
 #if defined(RTM_COMPILER_MSVC)
@@ -201,6 +208,42 @@ namespace acl
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Clears every bit at and above the specified bit index
+	// The index must be lower than 32
+	inline uint32_t zero_high_bits(uint32_t value, uint32_t index)
+	{
+		ACL_ASSERT(index < 32, "Invalid bit index");
+
+#if defined(ACL_BMI2_INTRINSICS)
+		return _bzhi_u32(value, index);
+#else
+		return value & ((1U << index) - 1);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Scatters the low bits of the value into the positions of the set bits of the mask, starting with the LSB
+	// Every other bit is cleared (aka: parallel bit deposit)
+	inline uint64_t deposit_bits(uint64_t value, uint64_t mask)
+	{
+#if defined(ACL_BMI2_INTRINSICS) && defined(RTM_ARCH_X64)
+		return _pdep_u64(value, mask);
+#else
+		uint64_t result = 0;
+		for (uint64_t bit = 1; mask != 0; bit <<= 1)
+		{
+			const uint64_t lowest_mask_bit = mask & (~mask + 1);
+			if ((value & bit) != 0)
+				result |= lowest_mask_bit;
+
+			mask &= mask - 1;
+		}
+
+		return result;
+#endif
+	}
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
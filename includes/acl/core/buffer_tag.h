@@ -51,6 +51,10 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		// Identifies a 'compressed_database' buffer.
 		compressed_database = 0xac11db01,
+
+		//////////////////////////////////////////////////////////////////////////
+		// Identifies a packed 'compressed_tracks' buffer, see packed_tracks.h
+		packed_compressed_tracks = 0xac11ac1c,
 	};
 
 	ACL_IMPL_VERSION_NAMESPACE_END
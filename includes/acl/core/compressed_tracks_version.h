@@ -73,6 +73,7 @@ namespace acl
 		v02_01_99_1	= 9,			// ACL v2.1.0-wip (removed constant thresholds in track desc, increased bit rates, remapped raw num bits to 31 in compressed tracks)
 		v02_01_99_2 = 10,			// ACL v2.1.0-wip (converted error contribution metadata)
 		v02_01_00	= 10,			// ACL v2.1.0
+		v02_02_99	= 11,			// ACL v2.2.0-wip (scalar track offsets, segments, sparse and decimated tracks, spline key reduction, byte aligned segment samples)
 
 		//////////////////////////////////////////////////////////////////////////
 		// First version marker, this is equal to the first version supported: ACL 2.0.0
@@ -82,7 +83,7 @@ namespace acl
 
 		//////////////////////////////////////////////////////////////////////////
 		// Always assigned to the latest version supported.
-		latest		= v02_01_00,
+		latest		= v02_02_99,
 	};
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -56,6 +56,8 @@ namespace acl
 
 	class iallocator;
 	class ansi_allocator;
+	class arena_allocator;
+	class tracking_allocator;
 
 	class bitset_description;
 	struct bitset_index_ref;
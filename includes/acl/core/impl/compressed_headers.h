@@ -88,7 +88,12 @@ namespace acl
 			// Accessors for 'misc_packed'
 
 			// Scalar tracks use it like this (listed from LSB):
-			// Bits [0, 31): unused (31 bits)
+			// Bits [0, 4) require compressed_tracks_version16::v02_02_99 or later and are zero with older versions
+			// Bit 0: has track offsets?
+			// Bit 1: has segments?
+			// Bit 2: has sparse tracks?
+			// Bit 3: has decimated tracks?
+			// Bits [4, 30): unused (26 bits)
 			// Bit 30: is wrap optimized? See sample_looping_policy for details.
 			// Bit 31: has metadata?
 
@@ -123,6 +128,16 @@ namespace acl
 			bool get_has_stripped_keyframes() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return (misc_packed & (1 << 10)) != 0; }
 			void set_has_stripped_keyframes(bool has_stripped_keyframes) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 10)) | (static_cast<uint32_t>(has_stripped_keyframes) << 10); }
 
+			// Scalar only
+			bool get_has_track_offsets() const { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); return (misc_packed & 1) != 0; }
+			void set_has_track_offsets(bool has_track_offsets) { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); misc_packed = (misc_packed & ~1) | static_cast<uint32_t>(has_track_offsets); }
+			bool get_has_segments() const { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); return (misc_packed & (1 << 1)) != 0; }
+			void set_has_segments(bool has_segments) { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); misc_packed = (misc_packed & ~(1 << 1)) | (static_cast<uint32_t>(has_segments) << 1); }
+			bool get_has_sparse_tracks() const { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); return (misc_packed & (1 << 2)) != 0; }
+			void set_has_sparse_tracks(bool has_sparse_tracks) { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); misc_packed = (misc_packed & ~(1 << 2)) | (static_cast<uint32_t>(has_sparse_tracks) << 2); }
+			bool get_has_decimated_tracks() const { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); return (misc_packed & (1 << 3)) != 0; }
+			void set_has_decimated_tracks(bool has_decimated_tracks) { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); misc_packed = (misc_packed & ~(1 << 3)) | (static_cast<uint32_t>(has_decimated_tracks) << 3); }
+
 			// Common
 			bool get_is_wrap_optimized() const { return (misc_packed & (1 << 30)) != 0; }
 			void set_is_wrap_optimized(bool is_wrap_optimized) { misc_packed = (misc_packed & ~(1 << 30)) | (static_cast<uint32_t>(is_wrap_optimized) << 30); }
@@ -136,11 +151,118 @@ namespace acl
 			uint8_t			bit_rate;
 		};
 
+		// Sparse scalar tracks use this bit rate value in their metadata
+		// Their inactive value lives with the constant values and their active spans live in the sparse track data
+		constexpr uint8_t k_scalar_sparse_track_bit_rate = 0xFF;
+
+		// Decimated scalar tracks use this bit rate value in their metadata
+		// Their samples retained at a lower sample rate live in the decimated track data
+		constexpr uint8_t k_scalar_decimated_track_bit_rate = 0xFE;
+
+		// Returns the number of components stored per scalar track sample
+		// quatf tracks drop their W component, it is reconstructed during decompression
+		inline uint32_t get_scalar_track_num_packed_elements(track_type8 track_type)
+		{
+			return track_type == track_type8::quatf ? 3 : get_track_num_sample_elements(track_type);
+		}
+
+		// We store track offsets for every Nth scalar track
+		// To find a track, we look up the offsets of the preceding entry and we scan at most N - 1 tracks from there
+		constexpr uint32_t k_scalar_track_offsets_stride = 16;
+
+		// Scalar track offsets used to seek to a track in constant time
+		// All offsets are those of the first track of the group the entry represents
+		struct scalar_track_offsets
+		{
+			// Offset in bits of the track within a frame of animated values
+			// With spline key reduction, the number of animated tracks that precede the track instead
+			uint32_t		animated_bit_offset;
+
+			// Offset in floats of the track within the constant values
+			uint32_t		constant_value_offset;
+
+			// Offset in floats of the track within the range values
+			uint32_t		range_value_offset;
+
+			// Number of sparse tracks that precede the track
+			uint32_t		sparse_track_offset;
+
+			// Number of decimated tracks that precede the track
+			uint32_t		decimated_track_offset;
+		};
+
+		// Scalar segment header, present only when the tracks header has segments
+		// Segment data is partitioned as follows:
+		//    - range data per animated track that isn't raw (min then extent per component, 8 bits each, no alignment)
+		//    - animated values sorted per sample then per track (byte alignment)
+		struct scalar_segment_header
+		{
+			// Index of the first sample contained in this segment
+			uint32_t		start_sample_index;
+
+			// Offset in bytes to the segment data, relative to the start of the animated values
+			uint32_t		segment_data_offset;
+		};
+
+		// Sparse scalar track header, present only when the tracks header has sparse tracks
+		// Sparse track data is partitioned as follows:
+		//    - the number of sparse tracks (4 bytes)
+		//    - the header of every sparse track in output order
+		//    - the spans of every sparse track sorted by their first sample
+		//    - span data: range min and extent per component as floats followed by the packed samples (4 byte alignment)
+		struct scalar_sparse_track_header
+		{
+			// Number of active spans, outside of them the track retains its inactive value
+			uint32_t		num_spans;
+
+			// Offset in bytes to the first span, relative to the start of the sparse track data
+			uint32_t		spans_offset;
+		};
+
+		// Decimated scalar track header, present only when the tracks header has decimated tracks
+		// Decimated track data is partitioned as follows:
+		//    - the size in bytes of the decimated track data (4 bytes)
+		//    - the number of decimated tracks (4 bytes)
+		//    - the header of every decimated track in output order
+		//    - track data: range min and extent per component as floats followed by the packed samples (4 byte alignment)
+		// See decimated_track_utils.h for how samples are retained
+		struct scalar_decimated_track_header
+		{
+			// Offset in bytes to the track data, relative to the start of the decimated track data
+			uint32_t		data_offset;
+
+			// We retain one sample every 2^N samples
+			uint8_t			decimation_shift;
+
+			// The bit rate used by the retained samples
+			uint8_t			bit_rate;
+
+			uint8_t			padding[2];
+		};
+
+		// A span of contiguous samples where a sparse scalar track is active
+		struct scalar_sparse_span
+		{
+			// Index of the first sample contained in this span
+			uint32_t		start_sample_index;
+
+			// Number of samples contained in this span
+			uint32_t		num_samples;
+
+			// Offset in bytes to the span data, relative to the start of the sparse track data
+			uint32_t		data_offset;
+
+			// The bit rate used by the samples of this span
+			uint32_t		bit_rate;
+		};
+
 		// Header for scalar 'compressed_tracks'
+		// With spline key reduction, the animated values contain key blocks instead, see spline_key_utils.h
 		struct scalar_tracks_header
 		{
 			// The number of bits used for a whole frame of data.
 			// The sum of one sample per track with all bit rates taken into account.
+			// Unused with spline key reduction.
 			uint32_t						num_bits_per_frame;
 
 			// Various data offsets relative to the start of this header.
@@ -162,6 +284,58 @@ namespace acl
 
 			uint8_t*						get_track_animated_values() { return track_animated_values.add_to(this); }
 			const uint8_t*					get_track_animated_values() const { return track_animated_values.add_to(this); }
+
+			// Optional, present only if the tracks header has track offsets, they follow the per track metadata
+			scalar_track_offsets*			get_track_offsets(uint32_t num_tracks) { return add_offset_to_ptr<scalar_track_offsets>(this, align_to(uint32_t(metadata_per_track) + num_tracks * sizeof(track_metadata), 4)); }
+			const scalar_track_offsets*		get_track_offsets(uint32_t num_tracks) const { return add_offset_to_ptr<const scalar_track_offsets>(this, align_to(uint32_t(metadata_per_track) + num_tracks * sizeof(track_metadata), 4)); }
+
+			// Optional, present only if the tracks header has segments, they follow the track offsets (if present)
+			// The number of segments comes first followed by the segment headers
+			uint32_t						get_segment_table_offset(uint32_t num_tracks, bool has_track_offsets) const
+			{
+				uint32_t offset = align_to(uint32_t(metadata_per_track) + num_tracks * sizeof(track_metadata), 4);
+				if (has_track_offsets)
+					offset += ((num_tracks + k_scalar_track_offsets_stride - 1) / k_scalar_track_offsets_stride) * sizeof(scalar_track_offsets);
+				return offset;
+			}
+
+			uint32_t*						get_segment_table(uint32_t num_tracks, bool has_track_offsets) { return add_offset_to_ptr<uint32_t>(this, get_segment_table_offset(num_tracks, has_track_offsets)); }
+			const uint32_t*					get_segment_table(uint32_t num_tracks, bool has_track_offsets) const { return add_offset_to_ptr<const uint32_t>(this, get_segment_table_offset(num_tracks, has_track_offsets)); }
+
+			// Optional, present only if the tracks header has decimated tracks, they follow the segment table (if present)
+			uint32_t						get_decimated_track_data_offset(uint32_t num_tracks, bool has_track_offsets, bool has_segments) const
+			{
+				uint32_t offset = get_segment_table_offset(num_tracks, has_track_offsets);
+				if (has_segments)
+				{
+					const uint32_t num_segments = *add_offset_to_ptr<const uint32_t>(this, offset);
+					offset += sizeof(uint32_t) + num_segments * sizeof(scalar_segment_header);
+				}
+				return offset;
+			}
+
+			uint8_t*						get_decimated_track_data(uint32_t num_tracks, bool has_track_offsets, bool has_segments) { return add_offset_to_ptr<uint8_t>(this, get_decimated_track_data_offset(num_tracks, has_track_offsets, has_segments)); }
+			const uint8_t*					get_decimated_track_data(uint32_t num_tracks, bool has_track_offsets, bool has_segments) const { return add_offset_to_ptr<const uint8_t>(this, get_decimated_track_data_offset(num_tracks, has_track_offsets, has_segments)); }
+
+			// Optional, present only if the tracks header has sparse tracks, they follow the decimated track data (if present)
+			uint32_t						get_sparse_track_data_offset(uint32_t num_tracks, bool has_track_offsets, bool has_segments, bool has_decimated_tracks) const
+			{
+				uint32_t offset = get_decimated_track_data_offset(num_tracks, has_track_offsets, has_segments);
+				if (has_decimated_tracks)
+					offset += *add_offset_to_ptr<const uint32_t>(this, offset);	// The decimated track data starts with its size
+				return offset;
+			}
+
+			uint8_t*						get_sparse_track_data(uint32_t num_tracks, bool has_track_offsets, bool has_segments, bool has_decimated_tracks) { return add_offset_to_ptr<uint8_t>(this, get_sparse_track_data_offset(num_tracks, has_track_offsets, has_segments, has_decimated_tracks)); }
+			const uint8_t*					get_sparse_track_data(uint32_t num_tracks, bool has_track_offsets, bool has_segments, bool has_decimated_tracks) const { return add_offset_to_ptr<const uint8_t>(this, get_sparse_track_data_offset(num_tracks, has_track_offsets, has_segments, has_decimated_tracks)); }
+
+			// Optional, present only with double precision tracks, they immediately precede the constant values
+			// Every track stores a base value per component, the decompressed values are relative to it
+			double*							get_track_base_values(uint32_t num_tracks, uint32_t num_components) { return add_offset_to_ptr<double>(this, uint32_t(track_constant_values) - num_tracks * num_components * uint32_t(sizeof(double))); }
+			const double*					get_track_base_values(uint32_t num_tracks, uint32_t num_components) const { return add_offset_to_ptr<const double>(this, uint32_t(track_constant_values) - num_tracks * num_components * uint32_t(sizeof(double))); }
+
+			// Each segment stores a reduced range per animated track that isn't raw, it has the same number of values as our track range values
+			uint32_t						get_segment_range_data_size() const { return (uint32_t(track_animated_values) - uint32_t(track_range_values)) / sizeof(float); }
 		};
 
 		////////////////////////////////////////////////////////////////////////////////
@@ -170,8 +344,12 @@ namespace acl
 		////////////////////////////////////////////////////////////////////////////////
 		struct segment_header
 		{
-			// Number of bits used by a fully animated pose (excludes default/constant tracks).
-			uint32_t						animated_pose_bit_size;
+			// Prior to compressed_tracks_version16::v02_02_99, all 32 bits are the number of bits used by a fully animated pose.
+			// Since compressed_tracks_version16::v02_02_99, it is used like this (listed from LSB):
+			// Bits [0, 31): number of bits used by a fully animated pose (excludes default/constant tracks).
+			// Bit 31: are animated samples byte aligned? When set, every animated sub-track uses 8 or 16 bits
+			// per component or full precision (or a fixed format) and every sample starts on a byte boundary.
+			uint32_t						animated_pose_packed;
 
 			// Number of bits used by a fully animated pose per sub-track type (excludes default/constant tracks).
 			uint32_t						animated_rotation_bit_size;
@@ -183,6 +361,26 @@ namespace acl
 			//    - range data per variable track (only when more than one segment) (2 byte alignment)
 			//    - track data sorted per sample then per track (4 byte alignment)
 			ptr_offset32<uint8_t>			segment_data;
+
+			//////////////////////////////////////////////////////////////////////////
+			// Accessors for 'animated_pose_packed'
+
+			uint32_t get_animated_pose_bit_size(compressed_tracks_version16 version) const { return version >= compressed_tracks_version16::v02_02_99 ? (animated_pose_packed & 0x7FFFFFFFU) : animated_pose_packed; }
+			bool get_is_byte_aligned(compressed_tracks_version16 version) const { return version >= compressed_tracks_version16::v02_02_99 && (animated_pose_packed & 0x80000000U) != 0; }
+
+			void set_animated_pose(compressed_tracks_version16 version, uint32_t animated_pose_bit_size, bool is_byte_aligned)
+			{
+				if (version >= compressed_tracks_version16::v02_02_99)
+				{
+					ACL_ASSERT(animated_pose_bit_size <= 0x7FFFFFFFU, "Animated pose bit size is too large");
+					animated_pose_packed = animated_pose_bit_size | (static_cast<uint32_t>(is_byte_aligned) << 31);
+				}
+				else
+				{
+					ACL_ASSERT(!is_byte_aligned, "Byte aligned samples require compressed_tracks_version16::v02_02_99 or later");
+					animated_pose_packed = animated_pose_bit_size;
+				}
+			}
 		};
 
 		////////////////////////////////////////////////////////////////////////////////
@@ -287,9 +287,22 @@ namespace acl
 		if (!is_valid_algorithm_type(header.algorithm_type))
 			return error_result("Invalid algorithm type");
 
+		if (header.algorithm_type != algorithm_type8::uniformly_sampled && header.track_type == track_type8::qvvf)
+			return error_result("Transform tracks only support uniform sampling");
+
 		if (header.version < compressed_tracks_version16::first || header.version > compressed_tracks_version16::latest)
 			return error_result("Invalid algorithm version");
 
+		// Scalar track offsets, segments, sparse and decimated tracks change the scalar layout and require a newer version
+		if (header.track_type != track_type8::qvvf && header.version < compressed_tracks_version16::v02_02_99)
+		{
+			if (header.get_has_track_offsets() || header.get_has_segments() || header.get_has_sparse_tracks() || header.get_has_decimated_tracks())
+				return error_result("Scalar track layout not supported by this version");
+
+			if (header.algorithm_type == algorithm_type8::spline_key_reduction)
+				return error_result("Spline key reduction not supported by this version");
+		}
+
 		if (check_hash)
 		{
 			const uint32_t hash = hash32(safe_ptr_cast<const uint8_t>(&m_padding[0]), m_buffer_header.size - sizeof(acl_impl::raw_buffer_header));
@@ -33,6 +33,7 @@
 
 #include <rtm/qvvf.h>
 #include <rtm/scalarf.h>
+#include <rtm/vector4d.h>
 #include <rtm/vector4f.h>
 
 #include <cstdint>
@@ -167,6 +168,90 @@ namespace acl
 				return tracks_typed.vector4f[track_index];
 			}
 
+			//////////////////////////////////////////////////////////////////////////
+			// Called by the decoder to write out a value for a specified track index.
+			void RTM_SIMD_CALL write_quat(uint32_t track_index, rtm::quatf_arg0 value)
+			{
+				ACL_ASSERT(type == track_type8::quatf, "Unexpected track type access");
+				tracks_typed.quatf[track_index] = value;
+			}
+
+			rtm::quatf RTM_SIMD_CALL read_quat(uint32_t track_index) const
+			{
+				ACL_ASSERT(type == track_type8::quatf, "Unexpected track type access");
+				return tracks_typed.quatf[track_index];
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Called by the decoder to write out a value for a specified track index.
+			void write_float1d(uint32_t track_index, double value)
+			{
+				ACL_ASSERT(type == track_type8::float1d, "Unexpected track type access");
+				tracks_typed.float1d[track_index] = value;
+			}
+
+			double read_float1d(uint32_t track_index) const
+			{
+				ACL_ASSERT(type == track_type8::float1d, "Unexpected track type access");
+				return tracks_typed.float1d[track_index];
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Called by the decoder to write out a value for a specified track index.
+			void RTM_SIMD_CALL write_float2d(uint32_t track_index, rtm::vector4d_arg0 value)
+			{
+				ACL_ASSERT(type == track_type8::float2d, "Unexpected track type access");
+				rtm::vector_store2(value, &tracks_typed.float2d[track_index]);
+			}
+
+			rtm::vector4d RTM_SIMD_CALL read_float2d(uint32_t track_index) const
+			{
+				ACL_ASSERT(type == track_type8::float2d, "Unexpected track type access");
+				return rtm::vector_load2(&tracks_typed.float2d[track_index]);
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Called by the decoder to write out a value for a specified track index.
+			void RTM_SIMD_CALL write_float3d(uint32_t track_index, rtm::vector4d_arg0 value)
+			{
+				ACL_ASSERT(type == track_type8::float3d, "Unexpected track type access");
+				rtm::vector_store3(value, &tracks_typed.float3d[track_index]);
+			}
+
+			rtm::vector4d RTM_SIMD_CALL read_float3d(uint32_t track_index) const
+			{
+				ACL_ASSERT(type == track_type8::float3d, "Unexpected track type access");
+				return rtm::vector_load3(&tracks_typed.float3d[track_index]);
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Called by the decoder to write out a value for a specified track index.
+			void RTM_SIMD_CALL write_float4d(uint32_t track_index, rtm::vector4d_arg0 value)
+			{
+				ACL_ASSERT(type == track_type8::float4d, "Unexpected track type access");
+				rtm::vector_store(value, &tracks_typed.float4d[track_index]);
+			}
+
+			rtm::vector4d RTM_SIMD_CALL read_float4d(uint32_t track_index) const
+			{
+				ACL_ASSERT(type == track_type8::float4d, "Unexpected track type access");
+				return rtm::vector_load(&tracks_typed.float4d[track_index]);
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Called by the decoder to write out a value for a specified track index.
+			void RTM_SIMD_CALL write_vector4d(uint32_t track_index, rtm::vector4d_arg0 value)
+			{
+				ACL_ASSERT(type == track_type8::vector4d, "Unexpected track type access");
+				tracks_typed.vector4d[track_index] = value;
+			}
+
+			rtm::vector4d RTM_SIMD_CALL read_vector4d(uint32_t track_index) const
+			{
+				ACL_ASSERT(type == track_type8::vector4d, "Unexpected track type access");
+				return tracks_typed.vector4d[track_index];
+			}
+
 			//////////////////////////////////////////////////////////////////////////
 			// Called by the decoder to write out a quaternion rotation value for a specified bone index.
 			void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation)
@@ -205,6 +290,12 @@ namespace acl
 				rtm::float3f*	float3f;
 				rtm::float4f*	float4f;
 				rtm::vector4f*	vector4f;
+				rtm::quatf*		quatf;
+				double*			float1d;
+				rtm::float2d*	float2d;
+				rtm::float3d*	float3d;
+				rtm::float4d*	float4d;
+				rtm::vector4d*	vector4d;
 				rtm::qvvf*		qvvf;
 			};
 
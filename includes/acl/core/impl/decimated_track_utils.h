@@ -0,0 +1,82 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Decimated scalar tracks retain one sample every 2^N samples (their decimation shift)
+		// along with the last sample of the clip. When the last sample doesn't fall on our
+		// decimation interval, the last interval is shorter than the others.
+		// Samples in between are reconstructed by linear interpolation.
+		//////////////////////////////////////////////////////////////////////////
+
+		// The largest decimation shift supported, one sample every 4 samples
+		constexpr uint32_t k_max_decimation_shift = 2;
+
+		// Returns the number of samples retained by a decimated track
+		constexpr uint32_t calculate_num_decimated_samples(uint32_t num_samples, uint32_t decimation_shift)
+		{
+			return num_samples <= 1 ? num_samples : ((num_samples - 1 + (1U << decimation_shift) - 1) >> decimation_shift) + 1;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Finds the two retained samples that surround a point in time expressed as a sample index
+		// and an interpolation alpha towards the next sample. The second retained sample is always
+		// the one that follows the first.
+		// Requires at least two samples.
+		//////////////////////////////////////////////////////////////////////////
+		inline void find_decimated_samples(uint32_t num_samples, uint32_t decimation_shift, uint32_t sample_index, float sample_alpha, uint32_t& out_decimated_index, float& out_decimated_alpha)
+		{
+			const uint32_t last_sample_index = num_samples - 1;
+			const uint32_t last_decimated_index = calculate_num_decimated_samples(num_samples, decimation_shift) - 1;
+
+			const uint32_t decimated_index = std::min<uint32_t>(sample_index >> decimation_shift, last_decimated_index - 1);
+			const uint32_t start_sample_index = decimated_index << decimation_shift;
+			const uint32_t end_sample_index = std::min<uint32_t>(start_sample_index + (1U << decimation_shift), last_sample_index);
+
+			const float decimated_alpha = (float(sample_index - start_sample_index) + sample_alpha) / float(end_sample_index - start_sample_index);
+
+			out_decimated_index = decimated_index;
+			out_decimated_alpha = std::min<float>(decimated_alpha, 1.0F);
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,712 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from packed_tracks.h
+
+#include "acl/version.h"
+#include "acl/core/buffer_tag.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Packed buffer layout:
+		//    - packed header
+		//    - region descriptors, regions are contiguous and cover the whole compressed tracks buffer
+		//    - coded data
+		//
+		// Each region is filtered before being entropy coded:
+		//    - bytes: as-is
+		//    - floats: split into 4 byte planes (one per byte of every float), each delta coded with the previous value
+		//    - frames: delta coded with the byte one frame earlier, frames are 'stride' bytes apart (0 if unknown)
+		//    - segment tables: delta coded with the previous segment tables region when it has the same size
+		//
+		// Transform tracks have one segment tables region (format per track and segment range data)
+		// and one frames region per segment. A segment's frames are only byte aligned when its animated
+		// pose bit size is a multiple of 8 bits (e.g. with byte aligned bit rates), otherwise its stride is 0.
+		//
+		// Filtered bytes are coded with an adaptive binary range coder, one order-0 model per
+		// region type and float plane.
+		//////////////////////////////////////////////////////////////////////////
+
+		enum class packed_region_type8 : uint8_t
+		{
+			bytes,
+			floats,
+			frames,
+			segment_tables,
+		};
+
+		inline bool is_valid_packed_region_type(packed_region_type8 type)
+		{
+			switch (type)
+			{
+			case packed_region_type8::bytes:
+			case packed_region_type8::floats:
+			case packed_region_type8::frames:
+			case packed_region_type8::segment_tables:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		struct packed_tracks_header
+		{
+			uint32_t		tag;
+
+			// Total size in bytes of the packed buffer, including this header
+			uint32_t		packed_size;
+
+			// Size in bytes and hash of the compressed tracks we unpack into
+			uint32_t		unpacked_size;
+			uint32_t		unpacked_hash;
+
+			uint32_t		num_regions;
+
+			// Whether or not our regions are stored as-is, when coding them isn't smaller
+			uint32_t		is_stored;
+		};
+
+		struct packed_region
+		{
+			uint32_t				size;
+			uint16_t				stride;
+			packed_region_type8		type;
+			uint8_t					padding;
+		};
+
+		// Our models: bytes, 4 float planes, frames, segment tables
+		constexpr uint32_t k_packed_num_models = 7;
+		constexpr uint32_t k_packed_float_plane_model_offset = 1;
+		constexpr uint32_t k_packed_frames_model_index = 5;
+		constexpr uint32_t k_packed_segment_tables_model_index = 6;
+
+		// Segment tables are delta coded with the previous ones
+		struct packed_region_history
+		{
+			const uint8_t*	prev_segment_tables = nullptr;
+			uint32_t		prev_segment_tables_size = 0;
+		};
+
+		// Range coder constants, probabilities are stored on 11 bits
+		constexpr uint32_t k_range_coder_num_probability_bits = 11;
+		constexpr uint32_t k_range_coder_probability_one = 1U << k_range_coder_num_probability_bits;
+		constexpr uint32_t k_range_coder_num_adaptation_bits = 5;
+		constexpr uint32_t k_range_coder_top_value = 1U << 24;
+
+		// Every byte is coded MSB first along a binary tree of 255 probabilities
+		struct packed_byte_models
+		{
+			uint16_t probabilities[k_packed_num_models][256];
+
+			packed_byte_models()
+			{
+				for (uint32_t model_index = 0; model_index < k_packed_num_models; ++model_index)
+				{
+					for (uint32_t node_index = 0; node_index < 256; ++node_index)
+						probabilities[model_index][node_index] = k_range_coder_probability_one / 2;
+				}
+			}
+		};
+
+		class range_encoder
+		{
+		public:
+			range_encoder(uint8_t* buffer, uint32_t buffer_size)
+				: m_buffer(buffer)
+				, m_buffer_size(buffer_size)
+			{}
+
+			void encode_byte(uint16_t* probabilities, uint8_t value)
+			{
+				uint32_t node_index = 1;
+				for (int32_t bit_index = 7; bit_index >= 0; --bit_index)
+				{
+					const uint32_t bit = (value >> bit_index) & 1;
+					encode_bit(probabilities[node_index], bit);
+					node_index = (node_index << 1) | bit;
+				}
+			}
+
+			void flush()
+			{
+				for (uint32_t byte_index = 0; byte_index < 5; ++byte_index)
+					shift_low();
+			}
+
+			uint32_t get_size() const { return m_offset; }
+			bool has_overflowed() const { return m_has_overflowed; }
+
+		private:
+			void encode_bit(uint16_t& probability, uint32_t bit)
+			{
+				const uint32_t bound = (m_range >> k_range_coder_num_probability_bits) * probability;
+				if (bit == 0)
+				{
+					m_range = bound;
+					probability = static_cast<uint16_t>(probability + ((k_range_coder_probability_one - probability) >> k_range_coder_num_adaptation_bits));
+				}
+				else
+				{
+					m_low += bound;
+					m_range -= bound;
+					probability = static_cast<uint16_t>(probability - (probability >> k_range_coder_num_adaptation_bits));
+				}
+
+				while (m_range < k_range_coder_top_value)
+				{
+					m_range <<= 8;
+					shift_low();
+				}
+			}
+
+			void shift_low()
+			{
+				// Carries are propagated through the pending 0xFF bytes
+				if (static_cast<uint32_t>(m_low) < 0xFF000000U || (m_low >> 32) != 0)
+				{
+					uint8_t pending_byte = m_cache;
+					do
+					{
+						write_byte(static_cast<uint8_t>(pending_byte + static_cast<uint8_t>(m_low >> 32)));
+						pending_byte = 0xFF;
+					} while (--m_cache_size != 0);
+
+					m_cache = static_cast<uint8_t>(static_cast<uint32_t>(m_low) >> 24);
+				}
+
+				m_cache_size++;
+				m_low = static_cast<uint32_t>(static_cast<uint32_t>(m_low) << 8);
+			}
+
+			void write_byte(uint8_t value)
+			{
+				if (m_offset < m_buffer_size)
+					m_buffer[m_offset++] = value;
+				else
+					m_has_overflowed = true;
+			}
+
+			uint8_t*	m_buffer;
+			uint32_t	m_buffer_size;
+			uint32_t	m_offset = 0;
+			uint64_t	m_low = 0;
+			uint32_t	m_range = 0xFFFFFFFFU;
+			uint32_t	m_cache_size = 1;
+			uint8_t		m_cache = 0;
+			bool		m_has_overflowed = false;
+		};
+
+		class range_decoder
+		{
+		public:
+			range_decoder(const uint8_t* buffer, uint32_t buffer_size)
+				: m_buffer(buffer)
+				, m_buffer_size(buffer_size)
+			{
+				for (uint32_t byte_index = 0; byte_index < 5; ++byte_index)
+					m_code = (m_code << 8) | read_byte();
+			}
+
+			uint8_t decode_byte(uint16_t* probabilities)
+			{
+				uint32_t node_index = 1;
+				while (node_index < 256)
+					node_index = (node_index << 1) | decode_bit(probabilities[node_index]);
+
+				return static_cast<uint8_t>(node_index - 256);
+			}
+
+			// Reading past the end of our buffer means it is corrupted
+			bool has_overflowed() const { return m_has_overflowed; }
+
+		private:
+			uint32_t decode_bit(uint16_t& probability)
+			{
+				const uint32_t bound = (m_range >> k_range_coder_num_probability_bits) * probability;
+
+				uint32_t bit;
+				if (m_code < bound)
+				{
+					m_range = bound;
+					probability = static_cast<uint16_t>(probability + ((k_range_coder_probability_one - probability) >> k_range_coder_num_adaptation_bits));
+					bit = 0;
+				}
+				else
+				{
+					m_code -= bound;
+					m_range -= bound;
+					probability = static_cast<uint16_t>(probability - (probability >> k_range_coder_num_adaptation_bits));
+					bit = 1;
+				}
+
+				if (m_range < k_range_coder_top_value)
+				{
+					m_range <<= 8;
+					m_code = (m_code << 8) | read_byte();
+				}
+
+				return bit;
+			}
+
+			uint32_t read_byte()
+			{
+				if (m_offset < m_buffer_size)
+					return m_buffer[m_offset++];
+
+				m_has_overflowed = true;
+				return 0;
+			}
+
+			const uint8_t*	m_buffer;
+			uint32_t		m_buffer_size;
+			uint32_t		m_offset = 0;
+			uint32_t		m_code = 0;
+			uint32_t		m_range = 0xFFFFFFFFU;
+			bool			m_has_overflowed = false;
+		};
+
+		// Returns the maximum number of regions find_packed_regions can split compressed tracks into
+		inline uint32_t get_max_num_packed_regions(const compressed_tracks& tracks)
+		{
+			const tracks_header& header = get_tracks_header(tracks);
+			if (header.track_type != track_type8::qvvf)
+				return 3;
+
+			// Headers, floats, then segment tables and frames for every segment
+			return 2 + get_transform_tracks_header(tracks).num_segments * 2;
+		}
+
+		// Splits compressed tracks into regions: headers and metadata, floating point data, and animated data
+		inline uint32_t find_packed_regions(const compressed_tracks& tracks, packed_region* out_regions)
+		{
+			const uint32_t buffer_size = tracks.get_size();
+			const uint8_t* buffer = safe_ptr_cast<const uint8_t>(&tracks);
+			const tracks_header& header = get_tracks_header(tracks);
+
+			uint32_t float_data_offset = 0;
+			uint32_t animated_data_offset = 0;
+			uint32_t frame_size = 0;
+
+			if (header.track_type == track_type8::qvvf)
+			{
+				// Constant samples and clip ranges are followed by the segment data
+				const transform_tracks_header& transforms_header = get_transform_tracks_header(tracks);
+
+				float_data_offset = uint32_t(transforms_header.get_constant_track_data() - buffer);
+				animated_data_offset = buffer_size;
+
+				const uint32_t num_segments = transforms_header.num_segments;
+				const bool has_stripped_keyframes = header.get_has_stripped_keyframes();
+
+				uint32_t num_regions = 2;
+				uint32_t prev_segment_end_offset = 0;
+				bool is_layout_valid = float_data_offset <= buffer_size;
+
+				for (uint32_t segment_index = 0; segment_index < num_segments && is_layout_valid; ++segment_index)
+				{
+					const segment_header& segment = has_stripped_keyframes ? transforms_header.get_stripped_segment_headers()[segment_index] : transforms_header.get_segment_headers()[segment_index];
+
+					const uint8_t* format_per_track_data;
+					const uint8_t* range_data;
+					const uint8_t* segment_animated_data;
+					transforms_header.get_segment_data(segment, format_per_track_data, range_data, segment_animated_data);
+
+					const uint32_t segment_start_offset = uint32_t(format_per_track_data - buffer);
+					const uint32_t segment_animated_offset = uint32_t(segment_animated_data - buffer);
+
+					if (segment_index == 0)
+					{
+						animated_data_offset = segment_start_offset;
+						is_layout_valid = float_data_offset <= animated_data_offset;
+					}
+					else
+					{
+						// The frames of the previous segment end where this segment starts
+						is_layout_valid = prev_segment_end_offset <= segment_start_offset;
+						out_regions[num_regions - 1].size = segment_start_offset - prev_segment_end_offset;
+					}
+
+					is_layout_valid = is_layout_valid && segment_start_offset <= segment_animated_offset && segment_animated_offset <= buffer_size;
+
+					const uint32_t animated_pose_bit_size = segment.get_animated_pose_bit_size(header.version);
+					const uint32_t segment_frame_size = (animated_pose_bit_size % 8) == 0 && (animated_pose_bit_size / 8) <= 0xFFFF ? (animated_pose_bit_size / 8) : 0;
+
+					out_regions[num_regions++] = packed_region{ segment_animated_offset - segment_start_offset, 0, packed_region_type8::segment_tables, 0 };
+					out_regions[num_regions++] = packed_region{ buffer_size - segment_animated_offset, static_cast<uint16_t>(segment_frame_size), packed_region_type8::frames, 0 };
+					prev_segment_end_offset = segment_animated_offset;
+				}
+
+				if (is_layout_valid)
+				{
+					out_regions[0] = packed_region{ float_data_offset, 0, packed_region_type8::bytes, 0 };
+					out_regions[1] = packed_region{ animated_data_offset - float_data_offset, 0, packed_region_type8::floats, 0 };
+
+					return num_regions;
+				}
+			}
+			else
+			{
+				// Constant values are followed by the range values and the animated values
+				const scalar_tracks_header& scalars_header = get_scalar_tracks_header(tracks);
+
+				float_data_offset = uint32_t(safe_ptr_cast<const uint8_t>(scalars_header.get_track_constant_values()) - buffer);
+				animated_data_offset = uint32_t(scalars_header.get_track_animated_values() - buffer);
+
+				// Uniformly sampled frames are contiguous without segments
+				const bool has_contiguous_frames = header.algorithm_type == algorithm_type8::uniformly_sampled && !header.get_has_segments();
+				if (has_contiguous_frames && (scalars_header.num_bits_per_frame % 8) == 0 && (scalars_header.num_bits_per_frame / 8) <= 0xFFFF)
+					frame_size = scalars_header.num_bits_per_frame / 8;
+
+				if (float_data_offset <= animated_data_offset && animated_data_offset <= buffer_size)
+				{
+					out_regions[0] = packed_region{ float_data_offset, 0, packed_region_type8::bytes, 0 };
+					out_regions[1] = packed_region{ animated_data_offset - float_data_offset, 0, packed_region_type8::floats, 0 };
+					out_regions[2] = packed_region{ buffer_size - animated_data_offset, static_cast<uint16_t>(frame_size), packed_region_type8::frames, 0 };
+					return 3;
+				}
+			}
+
+			// Unexpected layout, everything is treated as bytes
+			out_regions[0] = packed_region{ buffer_size, 0, packed_region_type8::bytes, 0 };
+			return 1;
+		}
+
+		// Filters and codes a region, the encoder tracks whether or not we ran out of space
+		inline void encode_packed_region(range_encoder& encoder, packed_byte_models& models, packed_region_history& history, const packed_region& region, const uint8_t* data)
+		{
+			switch (region.type)
+			{
+			case packed_region_type8::floats:
+			{
+				const uint32_t num_floats = region.size / 4;
+				for (uint32_t plane_index = 0; plane_index < 4; ++plane_index)
+				{
+					uint16_t* probabilities = models.probabilities[k_packed_float_plane_model_offset + plane_index];
+
+					uint8_t prev_value = 0;
+					for (uint32_t float_index = 0; float_index < num_floats; ++float_index)
+					{
+						const uint8_t value = data[float_index * 4 + plane_index];
+						encoder.encode_byte(probabilities, static_cast<uint8_t>(value - prev_value));
+						prev_value = value;
+					}
+				}
+
+				// Trailing bytes that aren't part of a float
+				for (uint32_t byte_index = num_floats * 4; byte_index < region.size; ++byte_index)
+					encoder.encode_byte(models.probabilities[0], data[byte_index]);
+				break;
+			}
+			case packed_region_type8::frames:
+			{
+				uint16_t* probabilities = models.probabilities[k_packed_frames_model_index];
+				const uint32_t stride = region.stride;
+
+				for (uint32_t byte_index = 0; byte_index < region.size; ++byte_index)
+				{
+					const uint8_t prev_value = (stride != 0 && byte_index >= stride) ? data[byte_index - stride] : 0;
+					encoder.encode_byte(probabilities, static_cast<uint8_t>(data[byte_index] - prev_value));
+				}
+				break;
+			}
+			case packed_region_type8::segment_tables:
+			{
+				uint16_t* probabilities = models.probabilities[k_packed_segment_tables_model_index];
+				const uint8_t* prev_data = history.prev_segment_tables_size == region.size ? history.prev_segment_tables : nullptr;
+
+				for (uint32_t byte_index = 0; byte_index < region.size; ++byte_index)
+				{
+					const uint8_t prev_value = prev_data != nullptr ? prev_data[byte_index] : 0;
+					encoder.encode_byte(probabilities, static_cast<uint8_t>(data[byte_index] - prev_value));
+				}
+
+				history.prev_segment_tables = data;
+				history.prev_segment_tables_size = region.size;
+				break;
+			}
+			case packed_region_type8::bytes:
+			default:
+				for (uint32_t byte_index = 0; byte_index < region.size; ++byte_index)
+					encoder.encode_byte(models.probabilities[0], data[byte_index]);
+				break;
+			}
+		}
+
+		inline void decode_packed_region(range_decoder& decoder, packed_byte_models& models, packed_region_history& history, const packed_region& region, uint8_t* data)
+		{
+			switch (region.type)
+			{
+			case packed_region_type8::floats:
+			{
+				const uint32_t num_floats = region.size / 4;
+				for (uint32_t plane_index = 0; plane_index < 4; ++plane_index)
+				{
+					uint16_t* probabilities = models.probabilities[k_packed_float_plane_model_offset + plane_index];
+
+					uint8_t prev_value = 0;
+					for (uint32_t float_index = 0; float_index < num_floats; ++float_index)
+					{
+						const uint8_t value = static_cast<uint8_t>(decoder.decode_byte(probabilities) + prev_value);
+						data[float_index * 4 + plane_index] = value;
+						prev_value = value;
+					}
+				}
+
+				for (uint32_t byte_index = num_floats * 4; byte_index < region.size; ++byte_index)
+					data[byte_index] = decoder.decode_byte(models.probabilities[0]);
+				break;
+			}
+			case packed_region_type8::frames:
+			{
+				uint16_t* probabilities = models.probabilities[k_packed_frames_model_index];
+				const uint32_t stride = region.stride;
+
+				for (uint32_t byte_index = 0; byte_index < region.size; ++byte_index)
+				{
+					const uint8_t prev_value = (stride != 0 && byte_index >= stride) ? data[byte_index - stride] : 0;
+					data[byte_index] = static_cast<uint8_t>(decoder.decode_byte(probabilities) + prev_value);
+				}
+				break;
+			}
+			case packed_region_type8::segment_tables:
+			{
+				uint16_t* probabilities = models.probabilities[k_packed_segment_tables_model_index];
+				const uint8_t* prev_data = history.prev_segment_tables_size == region.size ? history.prev_segment_tables : nullptr;
+
+				for (uint32_t byte_index = 0; byte_index < region.size; ++byte_index)
+				{
+					const uint8_t prev_value = prev_data != nullptr ? prev_data[byte_index] : 0;
+					data[byte_index] = static_cast<uint8_t>(decoder.decode_byte(probabilities) + prev_value);
+				}
+
+				history.prev_segment_tables = data;
+				history.prev_segment_tables_size = region.size;
+				break;
+			}
+			case packed_region_type8::bytes:
+			default:
+				for (uint32_t byte_index = 0; byte_index < region.size; ++byte_index)
+					data[byte_index] = decoder.decode_byte(models.probabilities[0]);
+				break;
+			}
+		}
+
+		// Returns our packed header if the buffer is valid, nullptr otherwise
+		inline const packed_tracks_header* get_packed_tracks_header(const uint8_t* packed_buffer, uint32_t packed_size)
+		{
+			if (packed_buffer == nullptr || packed_size < sizeof(packed_tracks_header))
+				return nullptr;
+
+			const packed_tracks_header* header = bit_cast<const packed_tracks_header*>(packed_buffer);
+			if (header->tag != static_cast<uint32_t>(buffer_tag32::packed_compressed_tracks))
+				return nullptr;
+
+			if (header->packed_size != packed_size || header->num_regions == 0)
+				return nullptr;
+
+			if (uint64_t(packed_size) < uint64_t(sizeof(packed_tracks_header)) + uint64_t(header->num_regions) * sizeof(packed_region))
+				return nullptr;
+
+			return header;
+		}
+	}
+
+	inline error_result pack_compressed_tracks(iallocator& allocator, const compressed_tracks& tracks, uint8_t*& out_packed_buffer, uint32_t& out_packed_size)
+	{
+		out_packed_buffer = nullptr;
+		out_packed_size = 0;
+
+		const error_result is_valid_result = tracks.is_valid(false);
+		if (is_valid_result.any())
+			return is_valid_result;
+
+		const uint32_t unpacked_size = tracks.get_size();
+		const uint8_t* unpacked_buffer = safe_ptr_cast<const uint8_t>(&tracks);
+
+		const uint32_t max_num_regions = acl_impl::get_max_num_packed_regions(tracks);
+		acl_impl::packed_region* regions = allocate_type_array<acl_impl::packed_region>(allocator, max_num_regions);
+		const uint32_t num_regions = acl_impl::find_packed_regions(tracks, regions);
+		const uint32_t header_size = sizeof(acl_impl::packed_tracks_header) + num_regions * sizeof(acl_impl::packed_region);
+
+		// Code everything in scratch memory, if coding doesn't help we store our regions as-is instead
+		uint8_t* coded_buffer = allocate_type_array<uint8_t>(allocator, unpacked_size);
+
+		acl_impl::range_encoder encoder(coded_buffer, unpacked_size);
+		acl_impl::packed_byte_models* models = allocate_type<acl_impl::packed_byte_models>(allocator);
+		acl_impl::packed_region_history history;
+
+		const uint8_t* region_data = unpacked_buffer;
+		for (uint32_t region_index = 0; region_index < num_regions; ++region_index)
+		{
+			acl_impl::encode_packed_region(encoder, *models, history, regions[region_index], region_data);
+			region_data += regions[region_index].size;
+		}
+
+		encoder.flush();
+		deallocate_type(allocator, models);
+
+		const bool is_stored = encoder.has_overflowed() || encoder.get_size() >= unpacked_size;
+		const uint32_t data_size = is_stored ? unpacked_size : encoder.get_size();
+		const uint32_t packed_size = header_size + data_size;
+
+		uint8_t* packed_buffer = allocate_type_array<uint8_t>(allocator, packed_size);
+
+		acl_impl::packed_tracks_header* header = bit_cast<acl_impl::packed_tracks_header*>(packed_buffer);
+		header->tag = static_cast<uint32_t>(buffer_tag32::packed_compressed_tracks);
+		header->packed_size = packed_size;
+		header->unpacked_size = unpacked_size;
+		header->unpacked_hash = tracks.get_hash();
+		header->num_regions = num_regions;
+		header->is_stored = is_stored ? 1 : 0;
+
+		std::memcpy(packed_buffer + sizeof(acl_impl::packed_tracks_header), &regions[0], num_regions * sizeof(acl_impl::packed_region));
+		std::memcpy(packed_buffer + header_size, is_stored ? unpacked_buffer : coded_buffer, data_size);
+
+		deallocate_type_array(allocator, coded_buffer, unpacked_size);
+		deallocate_type_array(allocator, regions, max_num_regions);
+
+		out_packed_buffer = packed_buffer;
+		out_packed_size = packed_size;
+		return error_result();
+	}
+
+	inline uint32_t get_unpacked_compressed_tracks_size(const uint8_t* packed_buffer, uint32_t packed_size)
+	{
+		const acl_impl::packed_tracks_header* header = acl_impl::get_packed_tracks_header(packed_buffer, packed_size);
+		return header != nullptr ? header->unpacked_size : 0;
+	}
+
+	inline error_result unpack_compressed_tracks(const uint8_t* packed_buffer, uint32_t packed_size, void* out_buffer, uint32_t out_buffer_size)
+	{
+		const acl_impl::packed_tracks_header* header = acl_impl::get_packed_tracks_header(packed_buffer, packed_size);
+		if (header == nullptr)
+			return error_result("Invalid packed buffer");
+
+		if (out_buffer == nullptr || out_buffer_size < header->unpacked_size)
+			return error_result("Output buffer is too small");
+
+		if (!is_aligned_to(out_buffer, alignof(compressed_tracks)))
+			return error_result("Invalid output buffer alignment");
+
+		const acl_impl::packed_region* regions = bit_cast<const acl_impl::packed_region*>(packed_buffer + sizeof(acl_impl::packed_tracks_header));
+		const uint32_t header_size = sizeof(acl_impl::packed_tracks_header) + header->num_regions * sizeof(acl_impl::packed_region);
+
+		if (header->unpacked_size < sizeof(acl_impl::raw_buffer_header) + sizeof(acl_impl::tracks_header))
+			return error_result("Invalid unpacked size");
+
+		// Regions come from untrusted data, make sure they cannot write past our output buffer
+		uint32_t total_region_size = 0;
+		for (uint32_t region_index = 0; region_index < header->num_regions; ++region_index)
+		{
+			const acl_impl::packed_region& region = regions[region_index];
+			if (region.size > header->unpacked_size - total_region_size)
+				return error_result("Invalid packed regions");
+
+			if (!acl_impl::is_valid_packed_region_type(region.type))
+				return error_result("Invalid packed region type");
+
+			total_region_size += region.size;
+		}
+
+		if (total_region_size != header->unpacked_size)
+			return error_result("Invalid packed regions");
+
+		const uint8_t* data = packed_buffer + header_size;
+		const uint32_t data_size = packed_size - header_size;
+		uint8_t* unpacked_buffer = static_cast<uint8_t*>(out_buffer);
+
+		if (header->is_stored != 0)
+		{
+			if (data_size != header->unpacked_size)
+				return error_result("Invalid packed buffer size");
+
+			std::memcpy(unpacked_buffer, data, data_size);
+		}
+		else
+		{
+			acl_impl::range_decoder decoder(data, data_size);
+			acl_impl::packed_byte_models models;
+			acl_impl::packed_region_history history;
+
+			uint8_t* region_data = unpacked_buffer;
+			for (uint32_t region_index = 0; region_index < header->num_regions; ++region_index)
+			{
+				acl_impl::decode_packed_region(decoder, models, history, regions[region_index], region_data);
+				region_data += regions[region_index].size;
+			}
+
+			if (decoder.has_overflowed())
+				return error_result("Packed data is corrupted");
+		}
+
+		const compressed_tracks* tracks = bit_cast<const compressed_tracks*>(unpacked_buffer);
+		if (tracks->get_size() != header->unpacked_size || tracks->get_hash() != header->unpacked_hash)
+			return error_result("Packed data is corrupted");
+
+		return tracks->is_valid(true);
+	}
+
+	inline error_result unpack_compressed_tracks(iallocator& allocator, const uint8_t* packed_buffer, uint32_t packed_size, compressed_tracks*& out_compressed_tracks)
+	{
+		out_compressed_tracks = nullptr;
+
+		const uint32_t unpacked_size = get_unpacked_compressed_tracks_size(packed_buffer, packed_size);
+		if (unpacked_size == 0)
+			return error_result("Invalid packed buffer");
+
+		uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, unpacked_size, alignof(compressed_tracks));
+
+		const error_result result = unpack_compressed_tracks(packed_buffer, packed_size, buffer, unpacked_size);
+		if (result.any())
+		{
+			deallocate_type_array(allocator, buffer, unpacked_size);
+			return result;
+		}
+
+		out_compressed_tracks = bit_cast<compressed_tracks*>(buffer);
+		return error_result();
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
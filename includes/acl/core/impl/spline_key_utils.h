@@ -0,0 +1,165 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Spline key reduction retains a variable number of keys per track that are
+		// interpolated with a cubic Hermite curve. Samples are split into blocks and
+		// every block stores the keys of every animated track that fall within it.
+		// A block covers the samples [first, first + num samples per block] inclusive
+		// which means that the last sample of a block is also the first of the next block.
+		// Every track always has a key on both edges of a block.
+		//
+		// Animated values layout:
+		//    - number of samples per block (uint32_t)
+		//    - number of animated tracks (uint32_t)
+		//    - offset of each block relative to the animated values (uint32_t)
+		//    - blocks (4 byte alignment)
+		//
+		// Block layout:
+		//    - offset of the key values relative to the block (uint32_t)
+		//    - offsets of every group of 'k_scalar_track_offsets_stride' tracks, only with track offsets (spline_key_group_offsets)
+		//    - number of keys per animated track (uint8_t)
+		//    - sample offset of each key within the block, per animated track (uint8_t)
+		//    - key values per animated track, each track padded to 4 bytes
+		//
+		// Key values are either raw or quantized on 16 bits per component within the track range.
+		//////////////////////////////////////////////////////////////////////////
+
+		// The number of bits used by each component of a quantized key
+		constexpr uint32_t k_spline_key_num_bits = 16;
+
+		// With track offsets, every block stores where the keys of each group of tracks start.
+		// Along with the scalar track offsets, this allows us to seek to a single track in constant time.
+		struct spline_key_group_offsets
+		{
+			// Number of keys within the block of the animated tracks that precede the group
+			uint32_t		key_offset;
+
+			// Offset in bytes of the key values of the group relative to the key values of the block
+			uint32_t		key_value_offset;
+		};
+
+		// Returns the number of groups of tracks that have offsets, see 'k_scalar_track_offsets_stride'
+		constexpr uint32_t calculate_num_spline_key_groups(uint32_t num_tracks, bool has_track_offsets)
+		{
+			return has_track_offsets ? ((num_tracks + k_scalar_track_offsets_stride - 1) / k_scalar_track_offsets_stride) : 0;
+		}
+
+		// Returns the number of blocks required to hold the specified number of samples
+		constexpr uint32_t calculate_num_spline_key_blocks(uint32_t num_samples, uint32_t num_samples_per_block)
+		{
+			// The last sample of each block is shared with the next one
+			return num_samples <= 1 ? num_samples : ((num_samples - 1 + num_samples_per_block - 1) / num_samples_per_block);
+		}
+
+		// Returns the block that contains the specified sample
+		inline uint32_t find_spline_key_block(uint32_t sample_index, uint32_t num_samples_per_block, uint32_t num_blocks)
+		{
+			const uint32_t block_index = sample_index / num_samples_per_block;
+
+			// The last sample of the last block starts a block that doesn't exist
+			return block_index < num_blocks ? block_index : (num_blocks - 1);
+		}
+
+		// Finds the two keys that surround the sample offset along with their neighbors, used for the tangents.
+		// At the edges of a block, the missing neighbor is the key itself.
+		inline void find_spline_keys(const uint8_t* key_sample_offsets, uint32_t num_keys, float sample_offset, uint32_t out_key_indices[4])
+		{
+			uint32_t key_index = 0;
+			while ((key_index + 2) < num_keys && float(key_sample_offsets[key_index + 1]) <= sample_offset)
+				key_index++;
+
+			const uint32_t last_key_index = num_keys - 1;
+			out_key_indices[0] = key_index != 0 ? (key_index - 1) : 0;
+			out_key_indices[1] = key_index;
+			out_key_indices[2] = (key_index + 1) < last_key_index ? (key_index + 1) : last_key_index;
+			out_key_indices[3] = (key_index + 2) < last_key_index ? (key_index + 2) : last_key_index;
+		}
+
+		// Unpacks a key quantized on 16 bits per component and restores it within the track range
+		inline rtm::vector4f RTM_SIMD_CALL unpack_spline_key_u16(const uint16_t* key_value, uint32_t num_components, rtm::vector4f_arg0 range_min, rtm::vector4f_arg1 range_extent)
+		{
+			const float inv_max_value = 1.0F / float((1 << k_spline_key_num_bits) - 1);
+
+			float normalized_value[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+			for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+				normalized_value[component_index] = float(key_value[component_index]) * inv_max_value;
+
+			return rtm::vector_mul_add(rtm::vector_load(&normalized_value[0]), range_extent, range_min);
+		}
+
+		// Interpolates between the keys 1 and 2 with a cubic Hermite curve. Keys 0 and 3 are their neighbors and
+		// they are used to calculate the tangents with finite differences, see 'find_spline_keys'.
+		// When a neighbor is the key itself, the tangent is one sided.
+		// Interpolating at a key returns its value exactly.
+		inline rtm::vector4f RTM_SIMD_CALL interpolate_spline_keys(rtm::vector4f_arg0 value0, rtm::vector4f_arg1 value1, rtm::vector4f_arg2 value2, rtm::vector4f_arg3 value3, const float key_sample_offsets[4], float sample_offset)
+		{
+			const float interval_duration = key_sample_offsets[2] - key_sample_offsets[1];
+			if (interval_duration <= 0.0F)
+				return value1;	// A single key
+
+			const float alpha = (sample_offset - key_sample_offsets[1]) / interval_duration;
+			const float alpha_sq = alpha * alpha;
+			const float alpha_cubed = alpha_sq * alpha;
+
+			// Hermite basis functions
+			const float weight_value1 = 2.0F * alpha_cubed - 3.0F * alpha_sq + 1.0F;
+			const float weight_tangent1 = alpha_cubed - 2.0F * alpha_sq + alpha;
+			const float weight_value2 = -2.0F * alpha_cubed + 3.0F * alpha_sq;
+			const float weight_tangent2 = alpha_cubed - alpha_sq;
+
+			// Our tangents are scaled by the interval duration
+			const float tangent1_scale = weight_tangent1 * interval_duration / (key_sample_offsets[2] - key_sample_offsets[0]);
+			const float tangent2_scale = weight_tangent2 * interval_duration / (key_sample_offsets[3] - key_sample_offsets[1]);
+
+			rtm::vector4f result = rtm::vector_mul(value1, weight_value1);
+			result = rtm::vector_add(result, rtm::vector_mul(rtm::vector_sub(value2, value0), tangent1_scale));
+			result = rtm::vector_add(result, rtm::vector_mul(value2, weight_value2));
+			result = rtm::vector_add(result, rtm::vector_mul(rtm::vector_sub(value3, value1), tangent2_scale));
+			return result;
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -62,6 +62,25 @@ namespace acl
 		constexpr bool is_constant_bit_rate(uint32_t bit_rate) { return bit_rate == 0; }
 		constexpr bool is_raw_bit_rate(uint32_t bit_rate) { return bit_rate == k_highest_bit_rate; }
 
+		// Samples at these bit rates use a whole number of bytes and can be unpacked with aligned loads
+		// Constant tracks have no samples and raw tracks use 32 bits per component
+		constexpr bool is_byte_aligned_bit_rate(uint32_t bit_rate) { return bit_rate == 0 || bit_rate == 8 || bit_rate == 16 || bit_rate == k_highest_bit_rate; }
+
+		static_assert(k_bit_rate_num_bits[8] == 8 && k_bit_rate_num_bits[16] == 16, "Byte aligned bit rates must use 8 and 16 bits");
+
+		// Returns the lowest byte aligned bit rate that is at least as accurate as the provided bit rate
+		inline uint8_t get_byte_aligned_bit_rate(uint8_t bit_rate)
+		{
+			if (bit_rate == k_invalid_bit_rate || is_byte_aligned_bit_rate(bit_rate))
+				return bit_rate;
+			else if (bit_rate < 8)
+				return 8;
+			else if (bit_rate < 16)
+				return 16;
+			else
+				return k_highest_bit_rate;
+		}
+
 		struct transform_bit_rates
 		{
 			uint8_t rotation;
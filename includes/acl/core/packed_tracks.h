@@ -0,0 +1,81 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packed compressed tracks are an at-rest container meant for storage and distribution.
+	// The 'compressed_tracks' format is designed to be used directly in memory and it is
+	// not entropy coded. Packing delta codes and entropy codes its constant data, range
+	// data, and animated data to further reduce its size. A packed buffer must be unpacked
+	// into a standard 'compressed_tracks' instance before it can be decompressed, runtime
+	// decompression performance is unaffected.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs compressed tracks into a newly allocated buffer.
+	// The packed buffer must be freed with: allocator.deallocate(out_packed_buffer, out_packed_size)
+	//////////////////////////////////////////////////////////////////////////
+	error_result pack_compressed_tracks(iallocator& allocator, const compressed_tracks& tracks, uint8_t*& out_packed_buffer, uint32_t& out_packed_size);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the size in bytes of the compressed tracks contained in a packed buffer
+	// or 0 if the buffer isn't a valid packed buffer.
+	//////////////////////////////////////////////////////////////////////////
+	uint32_t get_unpacked_compressed_tracks_size(const uint8_t* packed_buffer, uint32_t packed_size);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks compressed tracks in place into a caller provided buffer.
+	// The buffer must be at least 'get_unpacked_compressed_tracks_size()' bytes large
+	// and aligned to 'alignof(compressed_tracks)'.
+	// The unpacked compressed tracks are validated, including their hash.
+	//////////////////////////////////////////////////////////////////////////
+	error_result unpack_compressed_tracks(const uint8_t* packed_buffer, uint32_t packed_size, void* out_buffer, uint32_t out_buffer_size);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks compressed tracks into a newly allocated instance.
+	// The instance must be freed with: allocator.deallocate(out_compressed_tracks, out_compressed_tracks->get_size())
+	//////////////////////////////////////////////////////////////////////////
+	error_result unpack_compressed_tracks(iallocator& allocator, const uint8_t* packed_buffer, uint32_t packed_size, compressed_tracks*& out_compressed_tracks);
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/core/impl/packed_tracks.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,51 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+//////////////////////////////////////////////////////////////////////////
+// Profiling hooks are placed around each compression stage and around the decompression
+// entry points (seek, and the unpacking and writing of tracks). By default they compile
+// to nothing. To route them to your own profiler, define the macro ACL_PROFILE_SCOPE
+// before including ACL:
+//    #define ACL_PROFILE_SCOPE(name) ZoneScopedN(name)
+//
+// The name is a string literal such as "acl::quantize_streams" that lives forever.
+// The macro is used as a statement that must last until the end of the enclosing scope,
+// and at most one is used per scope: it can safely declare a local variable with a fixed name.
+//
+// Note that like asserts, every C++ file within your static or dynamic library that
+// references ACL must use the same definition.
+//////////////////////////////////////////////////////////////////////////
+
+#if !defined(ACL_PROFILE_SCOPE)
+	#define ACL_PROFILE_SCOPE(name) (void)(name)
+#endif
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -42,7 +42,7 @@ namespace acl
 
 	//////////////////////////////////////////////////////////////////////////
 	// This structure describes the various settings for floating point scalar tracks.
-	// Used by: float1f, float2f, float3f, float4f, vector4f
+	// Used by: float1f, float2f, float3f, float4f, vector4f, quatf
 	struct track_desc_scalarf
 	{
 		//////////////////////////////////////////////////////////////////////////
@@ -61,6 +61,7 @@ namespace acl
 		// If the error is below the precision threshold, we will remove bits until we reach it without
 		// exceeding it. If the error is above the precision threshold, we will add more bits until
 		// we lower it underneath.
+		// For quatf tracks, the precision is the maximum angle in radians between the raw and lossy rotations.
 		// Defaults to '0.00001'
 		float precision = 0.00001F;
 
@@ -82,7 +83,7 @@ namespace acl
 
 	//////////////////////////////////////////////////////////////////////////
 	// This structure describes the various settings for transform tracks.
-	// Used by: quatf, qvvf
+	// Used by: qvvf
 	struct track_desc_transformf
 	{
 		//////////////////////////////////////////////////////////////////////////
@@ -30,7 +30,10 @@
 #include "acl/core/track_types.h"
 
 #include <rtm/types.h>
+#include <rtm/quatf.h>
+#include <rtm/scalard.h>
 #include <rtm/scalarf.h>
+#include <rtm/vector4d.h>
 #include <rtm/vector4f.h>
 
 #include <cstdint>
@@ -109,6 +112,74 @@ namespace acl
 		static rtm::vector4f RTM_SIMD_CALL load_as_vector(const sample_type* ptr) { return *ptr; }
 	};
 
+	// Double precision tracks load their samples as rtm::vector4d
+
+	template<>
+	struct track_traits<track_type8::float1d>
+	{
+		static constexpr track_category8 category = track_category8::scalarf;
+
+		using sample_type = double;
+		using desc_type = track_desc_scalarf;
+
+		static rtm::vector4d RTM_SIMD_CALL load_as_vector(const sample_type* ptr) { return rtm::vector_set(*ptr, 0.0, 0.0, 0.0); }
+	};
+
+	template<>
+	struct track_traits<track_type8::float2d>
+	{
+		static constexpr track_category8 category = track_category8::scalarf;
+
+		using sample_type = rtm::float2d;
+		using desc_type = track_desc_scalarf;
+
+		static rtm::vector4d RTM_SIMD_CALL load_as_vector(const sample_type* ptr) { return rtm::vector_load2(ptr); }
+	};
+
+	template<>
+	struct track_traits<track_type8::float3d>
+	{
+		static constexpr track_category8 category = track_category8::scalarf;
+
+		using sample_type = rtm::float3d;
+		using desc_type = track_desc_scalarf;
+
+		static rtm::vector4d RTM_SIMD_CALL load_as_vector(const sample_type* ptr) { return rtm::vector_load3(ptr); }
+	};
+
+	template<>
+	struct track_traits<track_type8::float4d>
+	{
+		static constexpr track_category8 category = track_category8::scalarf;
+
+		using sample_type = rtm::float4d;
+		using desc_type = track_desc_scalarf;
+
+		static rtm::vector4d RTM_SIMD_CALL load_as_vector(const sample_type* ptr) { return rtm::vector_load(ptr); }
+	};
+
+	template<>
+	struct track_traits<track_type8::vector4d>
+	{
+		static constexpr track_category8 category = track_category8::scalarf;
+
+		using sample_type = rtm::vector4d;
+		using desc_type = track_desc_scalarf;
+
+		static rtm::vector4d RTM_SIMD_CALL load_as_vector(const sample_type* ptr) { return *ptr; }
+	};
+
+	template<>
+	struct track_traits<track_type8::quatf>
+	{
+		static constexpr track_category8 category = track_category8::scalarf;
+
+		using sample_type = rtm::quatf;
+		using desc_type = track_desc_scalarf;
+
+		static rtm::vector4f RTM_SIMD_CALL load_as_vector(const sample_type* ptr) { return rtm::quat_to_vector(*ptr); }
+	};
+
 	template<>
 	struct track_traits<track_type8::qvvf>
 	{
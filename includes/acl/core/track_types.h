@@ -56,17 +56,17 @@ namespace acl
 		float4f		= 3,
 		vector4f	= 4,
 
-		//float1d	= 5,
-		//float2d	= 6,
-		//float3d	= 7,
-		//float4d	= 8,
-		//vector4d	= 9,
+		float1d		= 5,
+		float2d		= 6,
+		float3d		= 7,
+		float4d		= 8,
+		vector4d	= 9,
 
-		//quatf		= 10,
+		quatf		= 10,
 		//quatd		= 11,
 
 		qvvf		= 12,
-		//qvvd		= 13,
+		//qvvd		= 13,		// Reserved, double precision transforms are not implemented
 
 		//int1i		= 14,
 		//int2i		= 15,
@@ -86,11 +86,11 @@ namespace acl
 	enum class track_category8 : uint8_t
 	{
 		scalarf		= 0,
-		scalard		= 1,
+		scalard		= 1,		// Reserved, double precision scalar tracks use the scalarf category
 		//scalari	= 2,
 		//scalarq	= 3,
 		transformf	= 4,
-		transformd	= 5,
+		transformd	= 5,		// Reserved, double precision transforms are not implemented
 	};
 
 	//////////////////////////////////////////////////////////////////////////
@@ -107,6 +107,12 @@ namespace acl
 		case track_type8::float3f:			return "float3f";
 		case track_type8::float4f:			return "float4f";
 		case track_type8::vector4f:			return "vector4f";
+		case track_type8::float1d:			return "float1d";
+		case track_type8::float2d:			return "float2d";
+		case track_type8::float3d:			return "float3d";
+		case track_type8::float4d:			return "float4d";
+		case track_type8::vector4d:			return "vector4d";
+		case track_type8::quatf:			return "quatf";
 		case track_type8::qvvf:				return "qvvf";
 		default:							return "<Invalid>";
 		}
@@ -170,13 +176,14 @@ namespace acl
 			track_category8::scalarf,		// float4f
 			track_category8::scalarf,		// vector4f
 
-			track_category8::scalard,		// float1d
-			track_category8::scalard,		// float2d
-			track_category8::scalard,		// float3d
-			track_category8::scalard,		// float4d
-			track_category8::scalard,		// vector4d
+			// Double precision scalar tracks are compressed as float deltas from a double precision base value
+			track_category8::scalarf,		// float1d
+			track_category8::scalarf,		// float2d
+			track_category8::scalarf,		// float3d
+			track_category8::scalarf,		// float4d
+			track_category8::scalarf,		// vector4d
 
-			track_category8::transformf,	// quatf
+			track_category8::scalarf,		// quatf
 			track_category8::transformd,	// quatd
 
 			track_category8::transformf,	// qvvf
@@ -188,6 +195,13 @@ namespace acl
 		return type <= track_type8::qvvf ? k_track_type_to_category[static_cast<uint32_t>(type)] : track_category8::scalarf;
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns whether the provided track type holds double precision samples.
+	inline bool is_track_type_double_precision(track_type8 type)
+	{
+		return type >= track_type8::float1d && type <= track_type8::vector4d;
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the num of elements within a sample for the provided track type.
 	inline uint32_t get_track_num_sample_elements(track_type8 type)
@@ -30,6 +30,7 @@
 
 #include <rtm/types.h>
 #include <rtm/quatf.h>
+#include <rtm/vector4d.h>
 #include <rtm/vector4f.h>
 
 #include <cstdint>
@@ -108,6 +109,12 @@ namespace acl
 		constexpr bool skip_track_float3(uint32_t /*track_index*/) const { return false; }
 		constexpr bool skip_track_float4(uint32_t /*track_index*/) const { return false; }
 		constexpr bool skip_track_vector4(uint32_t /*track_index*/) const { return false; }
+		constexpr bool skip_track_quat(uint32_t /*track_index*/) const { return false; }
+		constexpr bool skip_track_float1d(uint32_t /*track_index*/) const { return false; }
+		constexpr bool skip_track_float2d(uint32_t /*track_index*/) const { return false; }
+		constexpr bool skip_track_float3d(uint32_t /*track_index*/) const { return false; }
+		constexpr bool skip_track_float4d(uint32_t /*track_index*/) const { return false; }
+		constexpr bool skip_track_vector4d(uint32_t /*track_index*/) const { return false; }
 
 		//////////////////////////////////////////////////////////////////////////
 		// Called by the decoder to write out a value for a specified track index.
@@ -149,6 +156,55 @@ namespace acl
 			(void)value;
 		}
 
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the decoder to write out a value for a specified track index.
+		// Quaternion tracks are always normalized.
+		void RTM_SIMD_CALL write_quat(uint32_t track_index, rtm::quatf_arg0 value)
+		{
+			(void)track_index;
+			(void)value;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the decoder to write out a value for a specified track index.
+		void RTM_SIMD_CALL write_float1d(uint32_t track_index, double value)
+		{
+			(void)track_index;
+			(void)value;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the decoder to write out a value for a specified track index.
+		void RTM_SIMD_CALL write_float2d(uint32_t track_index, rtm::vector4d_arg0 value)
+		{
+			(void)track_index;
+			(void)value;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the decoder to write out a value for a specified track index.
+		void RTM_SIMD_CALL write_float3d(uint32_t track_index, rtm::vector4d_arg0 value)
+		{
+			(void)track_index;
+			(void)value;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the decoder to write out a value for a specified track index.
+		void RTM_SIMD_CALL write_float4d(uint32_t track_index, rtm::vector4d_arg0 value)
+		{
+			(void)track_index;
+			(void)value;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the decoder to write out a value for a specified track index.
+		void RTM_SIMD_CALL write_vector4d(uint32_t track_index, rtm::vector4d_arg0 value)
+		{
+			(void)track_index;
+			(void)value;
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// Transform track writing
 
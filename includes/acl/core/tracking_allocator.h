@@ -0,0 +1,144 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/error.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// An allocator wrapper that forwards every allocation to a backing allocator
+	// while tracking how much memory is live, its peak, and how many allocations
+	// and deallocations were performed.
+	//
+	// Stats can also be tracked for a scope (e.g. a compression stage) with
+	// 'begin_scope()': the scope peak starts at the live size and the scope counters
+	// start at zero. The overall stats are unaffected.
+	//
+	// Memory allocated through this wrapper can be freed by the backing allocator
+	// directly but it will not be tracked. The wrapper is not thread safe.
+	////////////////////////////////////////////////////////////////////////////////
+	class tracking_allocator : public iallocator
+	{
+	public:
+		explicit tracking_allocator(iallocator& backing_allocator)
+			: iallocator()
+			, m_backing_allocator(backing_allocator)
+			, m_live_size(0)
+			, m_peak_size(0)
+			, m_num_allocations(0)
+			, m_num_deallocations(0)
+			, m_scope_peak_size(0)
+			, m_scope_num_allocations(0)
+			, m_scope_num_deallocations(0)
+		{}
+
+		tracking_allocator(const tracking_allocator&) = delete;
+		tracking_allocator& operator=(const tracking_allocator&) = delete;
+
+		virtual void* allocate(size_t size, size_t alignment = k_default_alignment) override
+		{
+			void* ptr = m_backing_allocator.allocate(size, alignment);
+			if (ptr == nullptr)
+				return nullptr;
+
+			m_live_size += size;
+			m_peak_size = std::max<size_t>(m_peak_size, m_live_size);
+			m_scope_peak_size = std::max<size_t>(m_scope_peak_size, m_live_size);
+			m_num_allocations++;
+			m_scope_num_allocations++;
+
+			return ptr;
+		}
+
+		virtual void deallocate(void* ptr, size_t size) override
+		{
+			if (ptr == nullptr)
+				return;
+
+			ACL_ASSERT(size <= m_live_size, "Deallocating more memory than is live");
+			m_live_size -= size;
+			m_num_deallocations++;
+			m_scope_num_deallocations++;
+
+			m_backing_allocator.deallocate(ptr, size);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the number of bytes currently allocated.
+		size_t get_live_size() const { return m_live_size; }
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the largest number of bytes allocated at once.
+		size_t get_peak_size() const { return m_peak_size; }
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the number of allocations and deallocations performed.
+		uint32_t get_num_allocations() const { return m_num_allocations; }
+		uint32_t get_num_deallocations() const { return m_num_deallocations; }
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Starts tracking a new scope. Its peak starts with the live size.
+		void begin_scope()
+		{
+			m_scope_peak_size = m_live_size;
+			m_scope_num_allocations = 0;
+			m_scope_num_deallocations = 0;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the stats of the current scope.
+		size_t get_scope_peak_size() const { return m_scope_peak_size; }
+		uint32_t get_scope_num_allocations() const { return m_scope_num_allocations; }
+		uint32_t get_scope_num_deallocations() const { return m_scope_num_deallocations; }
+
+	private:
+		iallocator&		m_backing_allocator;
+
+		size_t			m_live_size;
+		size_t			m_peak_size;
+		uint32_t		m_num_allocations;
+		uint32_t		m_num_deallocations;
+
+		size_t			m_scope_peak_size;
+		uint32_t		m_scope_num_allocations;
+		uint32_t		m_scope_num_deallocations;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
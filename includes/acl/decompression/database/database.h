@@ -158,19 +158,43 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		// Issues a stream in request and returns the current status for the specified tier (medium or low).
 		// By default, every chunk will be streamed in but they can be streamed progressively
-		// by providing a number of chunks.
+		// by providing a number of chunks. The first chunks that aren't streamed in are requested.
 		database_stream_request_result stream_in(quality_tier tier, uint32_t num_chunks_to_stream = ~0U);
 
 		//////////////////////////////////////////////////////////////////////////
 		// Issues a stream out request and returns the current status for the specified tier (medium or low).
 		// By default, every chunk will be streamed out but they can be streamed progressively
-		// by providing a number of chunks.
+		// by providing a number of chunks. The first chunks that are streamed in are requested.
 		database_stream_request_result stream_out(quality_tier tier, uint32_t num_chunks_to_stream = ~0U);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not the specified chunk has been streamed in for the specified tier (medium or low).
+		bool is_chunk_streamed_in(quality_tier tier, uint32_t chunk_index) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Issues a stream in request for a specific range of chunks and returns the current status for the specified tier (medium or low).
+		// Chunks within the range that are already streamed in are skipped. Since a request must be contiguous,
+		// only the first contiguous run of chunks that need to stream in is requested. Call this function again
+		// once the request completes to stream in the remaining chunks of the range, if any.
+		// This allows runtime residency policies to manage the database at the chunk granularity.
+		database_stream_request_result stream_in_chunks(quality_tier tier, uint32_t first_chunk_index, uint32_t num_chunks = 1);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Issues a stream out request for a specific range of chunks and returns the current status for the specified tier (medium or low).
+		// Chunks within the range that are already streamed out are skipped. Since a request must be contiguous,
+		// only the first contiguous run of chunks that need to stream out is requested. Call this function again
+		// once the request completes to stream out the remaining chunks of the range, if any.
+		// Other chunks remain resident and only the segments contained in the evicted chunks lose their data.
+		database_stream_request_result stream_out_chunks(quality_tier tier, uint32_t first_chunk_index, uint32_t num_chunks = 1);
+
 	private:
 		database_context(const database_context& other) = delete;
 		database_context& operator=(const database_context& other) = delete;
 
+		// Streams the first contiguous run of chunks within the search range, up to the maximum number of chunks provided
+		database_stream_request_result stream_in_impl(quality_tier tier, uint32_t search_first_chunk_index, uint32_t search_num_chunks, uint32_t max_num_chunks_to_stream);
+		database_stream_request_result stream_out_impl(quality_tier tier, uint32_t search_first_chunk_index, uint32_t search_num_chunks, uint32_t max_num_chunks_to_stream);
+
 		// Internal context data
 		acl_impl::database_context_v0 m_context;
 
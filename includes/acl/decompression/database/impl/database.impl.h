@@ -440,8 +440,97 @@ namespace acl
 		return num_streaming_chunks != 0;
 	}
 
+	template<class database_settings_type>
+	inline bool database_context<database_settings_type>::is_chunk_streamed_in(quality_tier tier, uint32_t chunk_index) const
+	{
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized() || tier == quality_tier::highest_importance)
+			return false;
+
+		const uint32_t num_chunks = m_context.db->get_num_chunks(tier);
+		ACL_ASSERT(chunk_index < num_chunks, "Invalid chunk index");
+		if (chunk_index >= num_chunks)
+			return false;
+
+		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+		const uint32_t tier_index = uint32_t(tier) - 1;
+
+		return bitset_test(m_context.loaded_chunks[tier_index], desc, chunk_index);
+	}
+
 	template<class database_settings_type>
 	inline database_stream_request_result database_context<database_settings_type>::stream_in(quality_tier tier, uint32_t num_chunks_to_stream)
+	{
+		return stream_in_impl(tier, 0, ~0U, num_chunks_to_stream);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_out(quality_tier tier, uint32_t num_chunks_to_stream)
+	{
+		return stream_out_impl(tier, 0, ~0U, num_chunks_to_stream);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_in_chunks(quality_tier tier, uint32_t first_chunk_index, uint32_t num_chunks)
+	{
+		return stream_in_impl(tier, first_chunk_index, num_chunks, num_chunks);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_out_chunks(quality_tier tier, uint32_t first_chunk_index, uint32_t num_chunks)
+	{
+		return stream_out_impl(tier, first_chunk_index, num_chunks, num_chunks);
+	}
+
+	namespace acl_impl
+	{
+		// Finds the first contiguous run of chunks within the search range whose loaded state differs from the one desired.
+		// The run is clamped to the maximum number of chunks to stream.
+		// Returns the first chunk index of the run or ~0 if every chunk in the range is already in the desired state.
+		inline uint32_t find_chunks_to_stream(const uint32_t* loaded_chunks, uint32_t num_chunks, uint32_t search_first_chunk_index, uint32_t search_num_chunks, uint32_t max_num_chunks_to_stream, bool stream_in, uint32_t& out_num_chunks_to_stream)
+		{
+			out_num_chunks_to_stream = 0;
+
+			if (search_first_chunk_index >= num_chunks || max_num_chunks_to_stream == 0)
+				return ~0U;	// Nothing to stream
+
+			// Calculate and clamp our search range (and handle wrapping for safety)
+			const uint64_t search_end_chunk_index64 = uint64_t(search_first_chunk_index) + uint64_t(search_num_chunks);
+			const uint32_t search_end_chunk_index = search_end_chunk_index64 >= uint64_t(num_chunks) ? num_chunks : uint32_t(search_end_chunk_index64);
+
+			const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+
+			// A chunk needs to stream in if it isn't loaded and it needs to stream out if it is loaded
+			uint32_t first_chunk_index = ~0U;
+			for (uint32_t chunk_index = search_first_chunk_index; chunk_index < search_end_chunk_index; ++chunk_index)
+			{
+				if (bitset_test(loaded_chunks, desc, chunk_index) != stream_in)
+				{
+					first_chunk_index = chunk_index;
+					break;
+				}
+			}
+
+			if (first_chunk_index == ~0U)
+				return ~0U;	// Everything is streamed in/out, nothing to do
+
+			uint32_t num_chunks_to_stream = 0;
+			for (uint32_t chunk_index = first_chunk_index; chunk_index < search_end_chunk_index && num_chunks_to_stream < max_num_chunks_to_stream; ++chunk_index)
+			{
+				if (bitset_test(loaded_chunks, desc, chunk_index) == stream_in)
+					break;	// End of our run
+
+				num_chunks_to_stream++;
+			}
+
+			out_num_chunks_to_stream = num_chunks_to_stream;
+			return first_chunk_index;
+		}
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_in_impl(quality_tier tier, uint32_t search_first_chunk_index, uint32_t search_num_chunks, uint32_t max_num_chunks_to_stream)
 	{
 		ACL_ASSERT(is_initialized(), "Database isn't initialized");
 		if (!is_initialized())
@@ -461,39 +550,15 @@ namespace acl
 
 		const uint32_t num_chunks = header.num_chunks[tier_index];
 		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
-		const uint32_t max_chunk_size = header.max_chunk_size;
-
-		uint32_t first_chunk_index = ~0U;
 
-		// Clamp the total number of chunks we can stream
-		num_chunks_to_stream = std::min<uint32_t>(num_chunks_to_stream, num_chunks);
+		// Look for chunks that aren't loaded yet, nothing is streaming
+		uint32_t num_streaming_chunks;
+		const uint32_t first_chunk_index = acl_impl::find_chunks_to_stream(m_context.loaded_chunks[tier_index], num_chunks, search_first_chunk_index, search_num_chunks, max_num_chunks_to_stream, true, num_streaming_chunks);
 
-		// Look for chunks that aren't loaded yet and aren't streaming yet
-		const uint32_t num_entries = desc.get_size();
-		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
-		for (uint32_t entry_index = 0; entry_index < num_entries; ++entry_index)
-		{
-			const uint32_t maybe_loaded = loaded_chunks[entry_index];
-			const uint32_t num_pending_chunks = count_trailing_zeros(maybe_loaded);
-			if (num_pending_chunks != 0)
-			{
-				first_chunk_index = (entry_index * 32) + (32 - num_pending_chunks);
-				break;
-			}
-		}
+		if (first_chunk_index == ~0U || num_streaming_chunks == 0)
+			return database_stream_request_result::done;	// Everything is streamed in, nothing to do
 
-		if (first_chunk_index == ~0U)
-			return database_stream_request_result::done;	// Everything is streamed in or streaming, nothing to do
-
-		// Calculate and clamp our last chunk index (and handle wrapping for safety)
-		const uint64_t last_chunk_index64 = uint64_t(first_chunk_index) + uint64_t(num_chunks_to_stream) - 1;
-		const uint32_t last_chunk_index = last_chunk_index64 >= uint64_t(num_chunks) ? (num_chunks - 1) : uint32_t(last_chunk_index64);
-
-		// Calculate our stream size and account for the fact that the last chunk doesn't have the same size
-		const uint32_t num_streaming_chunks = last_chunk_index - first_chunk_index + 1;
-
-		if (num_streaming_chunks == 0)
-			return database_stream_request_result::done;	// Nothing more to stream
+		const uint32_t last_chunk_index = first_chunk_index + num_streaming_chunks - 1;
 
 		database_streamer* streamer = m_context.streamers[tier_index];
 
@@ -505,8 +570,9 @@ namespace acl
 		const acl_impl::database_chunk_description& first_chunk_description = chunk_descriptions[first_chunk_index];
 		const uint32_t stream_start_offset = first_chunk_description.offset;
 
+		// Chunks are contiguous but they do not all have the same size when databases are merged
 		const acl_impl::database_chunk_description& last_chunk_description = chunk_descriptions[last_chunk_index];
-		const uint32_t stream_size = ((num_streaming_chunks - 1) * max_chunk_size) + last_chunk_description.size;
+		const uint32_t stream_size = (uint32_t(last_chunk_description.offset) - stream_start_offset) + last_chunk_description.size;
 
 		// We can allocate our bulk data if we haven't already
 		const uint8_t* bulk_data = m_context.bulk_data[tier_index];
@@ -523,7 +589,7 @@ namespace acl
 	}
 
 	template<class database_settings_type>
-	inline database_stream_request_result database_context<database_settings_type>::stream_out(quality_tier tier, uint32_t num_chunks_to_stream)
+	inline database_stream_request_result database_context<database_settings_type>::stream_out_impl(quality_tier tier, uint32_t search_first_chunk_index, uint32_t search_num_chunks, uint32_t max_num_chunks_to_stream)
 	{
 		ACL_ASSERT(is_initialized(), "Database isn't initialized");
 		if (!is_initialized())
@@ -543,39 +609,16 @@ namespace acl
 
 		const uint32_t num_chunks = header.num_chunks[tier_index];
 		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
-		const uint32_t max_chunk_size = header.max_chunk_size;
 
-		// Clamp the total number of chunks we can stream
-		num_chunks_to_stream = std::min<uint32_t>(num_chunks_to_stream, num_chunks);
-
-		uint32_t first_chunk_index = ~0U;
-
-		// Look for chunks that aren't unloaded yet and aren't streaming yet
-		const uint32_t num_entries = desc.get_size();
+		// Look for chunks that are loaded, nothing is streaming
 		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
-		for (uint32_t entry_index = 0; entry_index < num_entries; ++entry_index)
-		{
-			const uint32_t maybe_loaded = loaded_chunks[entry_index];
-			const uint32_t num_pending_chunks = count_leading_zeros(maybe_loaded);
-			if (num_pending_chunks != 32)
-			{
-				first_chunk_index = (entry_index * 32) + num_pending_chunks;
-				break;
-			}
-		}
-
-		if (first_chunk_index == ~0U)
-			return database_stream_request_result::done;	// Everything is streamed out or streaming, nothing to do
-
-		// Calculate and clamp our last chunk index (and handle wrapping for safety)
-		const uint64_t last_chunk_index64 = uint64_t(first_chunk_index) + uint64_t(num_chunks_to_stream) - 1;
-		const uint32_t last_chunk_index = last_chunk_index64 >= uint64_t(num_chunks) ? (num_chunks - 1) : uint32_t(last_chunk_index64);
+		uint32_t num_streaming_chunks;
+		const uint32_t first_chunk_index = acl_impl::find_chunks_to_stream(loaded_chunks, num_chunks, search_first_chunk_index, search_num_chunks, max_num_chunks_to_stream, false, num_streaming_chunks);
 
-		// Calculate our stream size and account for the fact that the last chunk doesn't have the same size
-		const uint32_t num_streaming_chunks = last_chunk_index - first_chunk_index + 1;
+		if (first_chunk_index == ~0U || num_streaming_chunks == 0)
+			return database_stream_request_result::done;	// Everything is streamed out, nothing to do
 
-		if (num_streaming_chunks == 0)
-			return database_stream_request_result::done;	// Nothing more to stream
+		const uint32_t last_chunk_index = first_chunk_index + num_streaming_chunks - 1;
 
 		database_streamer* streamer = m_context.streamers[tier_index];
 
@@ -587,8 +630,9 @@ namespace acl
 		const acl_impl::database_chunk_description& first_chunk_description = chunk_descriptions[first_chunk_index];
 		const uint32_t stream_start_offset = first_chunk_description.offset;
 
+		// Chunks are contiguous but they do not all have the same size when databases are merged
 		const acl_impl::database_chunk_description& last_chunk_description = chunk_descriptions[last_chunk_index];
-		const uint32_t stream_size = ((num_streaming_chunks - 1) * max_chunk_size) + last_chunk_description.size;
+		const uint32_t stream_size = (uint32_t(last_chunk_description.offset) - stream_start_offset) + last_chunk_description.size;
 
 		// Mark chunks as in-streaming
 		uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
@@ -604,7 +648,7 @@ namespace acl
 		if (can_deallocate_bulk_data)
 			bulk_data_ref = nullptr;
 
-		// Unregister our chunks
+		// Unregister our chunks, only the segments they contain are affected
 		const uint32_t end_chunk_index = first_chunk_index + num_streaming_chunks;
 		for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
 		{
@@ -180,7 +180,13 @@ namespace acl
 			|| settings_type::is_track_type_supported(track_type8::float2f)
 			|| settings_type::is_track_type_supported(track_type8::float3f)
 			|| settings_type::is_track_type_supported(track_type8::float4f)
-			|| settings_type::is_track_type_supported(track_type8::vector4f);
+			|| settings_type::is_track_type_supported(track_type8::vector4f)
+			|| settings_type::is_track_type_supported(track_type8::quatf)
+			|| settings_type::is_track_type_supported(track_type8::float1d)
+			|| settings_type::is_track_type_supported(track_type8::float2d)
+			|| settings_type::is_track_type_supported(track_type8::float3d)
+			|| settings_type::is_track_type_supported(track_type8::float4d)
+			|| settings_type::is_track_type_supported(track_type8::vector4d);
 
 		// Whether the decompression context should support transform tracks
 		static constexpr bool k_supports_transform_tracks = settings_type::is_track_type_supported(track_type8::qvvf);
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/algorithm_types.h"
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/core/track_formats.h"
 #include "acl/core/track_types.h"
@@ -88,6 +89,13 @@ namespace acl
 		// Must be static constexpr!
 		static constexpr bool is_track_type_supported(track_type8 /*type*/) { return true; }
 
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not the specified algorithm type is supported. Defaults to true.
+		// If an algorithm is statically known not to be supported, the compiler can strip
+		// the associated code. Scalar tracks only, transform tracks always use 'uniformly_sampled'.
+		// Must be static constexpr!
+		static constexpr bool is_algorithm_supported(algorithm_type8 /*type*/) { return true; }
+
 		//////////////////////////////////////////////////////////////////////////
 		// Whether to explicitly disable floating point exceptions during decompression.
 		// This has a cost, exceptions are usually disabled globally and do not need to be
@@ -159,6 +167,16 @@ namespace acl
 		// Must be static constexpr!
 		static constexpr bool is_per_track_rounding_supported() { return true; }
 
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not the memory loaded from the compressed tracks is reported to the
+		// active 'memory_touch_recorder' when we seek and decompress transform tracks.
+		// This is meant to debug the memory layout and it is very slow.
+		// Loads are only reported when ACL_USE_MEMORY_TOUCH_RECORDER is defined.
+		// See 'memory_touch_recorder' for details.
+		// Disabled by default.
+		// Must be static constexpr!
+		static constexpr bool is_memory_touch_tracking_enabled() { return false; }
+
 		//////////////////////////////////////////////////////////////////////////
 		// The database settings to use when decompressing.
 		// By default, the database isn't supported.
@@ -187,6 +205,22 @@ namespace acl
 		static constexpr bool is_track_type_supported(track_type8 type) { return type == track_type8::qvvf; }
 	};
 
+#if defined(ACL_USE_MEMORY_TOUCH_RECORDER)
+	//////////////////////////////////////////////////////////////////////////
+	// These are debug settings, everything is enabled and nothing is stripped.
+	// Every load made from the compressed tracks is also reported to the active
+	// 'memory_touch_recorder'. It is very slow and only meant to measure the memory
+	// touched when we seek and decompress.
+	// Requires ACL_USE_MEMORY_TOUCH_RECORDER to be defined.
+	//////////////////////////////////////////////////////////////////////////
+	struct instrumented_transform_decompression_settings : public debug_transform_decompression_settings
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Report every load to the active memory touch recorder
+		static constexpr bool is_memory_touch_tracking_enabled() { return true; }
+	};
+#endif
+
 	//////////////////////////////////////////////////////////////////////////
 	// These are the default settings. Only the generally optimal settings
 	// are enabled and will offer the overall best performance.
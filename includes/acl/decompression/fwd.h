@@ -47,6 +47,11 @@ namespace acl
     struct default_scalar_decompression_settings;
     struct debug_transform_decompression_settings;
     struct default_transform_decompression_settings;
+    struct instrumented_transform_decompression_settings;
+
+    struct memory_touch_stats;
+    class memory_touch_recorder;
+    class scope_memory_touch_recorder;
 
     enum class streaming_action;
     struct streaming_request;
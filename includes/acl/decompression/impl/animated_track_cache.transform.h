@@ -27,6 +27,7 @@
 #include "acl/version.h"
 #include "acl/core/impl/bit_cast.impl.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/impl/memory_touch_hooks.h"
 #include "acl/decompression/impl/track_cache.h"
 #include "acl/decompression/impl/decompression_context.transform.h"
 #include "acl/math/quatf.h"
@@ -97,9 +98,9 @@ namespace acl
 	namespace acl_impl
 	{
 #if defined(ACL_IMPL_USE_ANIMATED_PREFETCH)
-#define ACL_IMPL_ANIMATED_PREFETCH(ptr) memory_prefetch(ptr)
+#define ACL_IMPL_ANIMATED_PREFETCH(settings_type, ptr) do { memory_prefetch(ptr); acl_impl::record_memory_prefetch<settings_type>(ptr); } while (false)
 #else
-#define ACL_IMPL_ANIMATED_PREFETCH(ptr) (void)(ptr)
+#define ACL_IMPL_ANIMATED_PREFETCH(settings_type, ptr) (void)(ptr)
 #endif
 
 		struct clip_animated_sampling_context_v0
@@ -129,6 +130,8 @@ namespace acl
 
 			const uint8_t* animated_track_data;			// Base of animated sample data, constant and doesn't change after init
 			uint32_t animated_track_data_bit_offset;	// Bit offset of the current animated sub-track
+
+			bool is_byte_aligned;						// Whether every animated sample of this segment starts on a byte boundary (8 or 16 bits per component)
 		};
 
 		struct alignas(32) segment_animated_scratch_v0
@@ -153,10 +156,22 @@ namespace acl
 		using range_reduction_masks_t = uint64_t;
 #endif
 
+		// Returns the number of bytes read by 'unpack_segment_range_data', the segment range data of a group is 24 bytes
+		constexpr uint32_t get_segment_range_data_load_size()
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			return 32;
+#else
+			return 24;
+#endif
+		}
+
 		// About 9 cycles with AVX on Skylake
+		template<class decompression_settings_type>
 		inline RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_segment_range_data(const uint8_t* segment_range_data, uint32_t scratch_offset, segment_animated_scratch_v0& output_scratch)
 		{
 			// Segment range is packed: min.xxxx, min.yyyy, min.zzzz, extent.xxxx, extent.yyyy, extent.zzzz
+			record_memory_touch<decompression_settings_type>(segment_range_data, get_segment_range_data_load_size());
 
 #if defined(RTM_SSE2_INTRINSICS)
 			const __m128i zero = _mm_setzero_si128();
@@ -261,7 +276,7 @@ namespace acl
 			// case we don't need to prefetch it and we can go to the next one. Any offset after the end
 			// of this cache line will fetch it. For safety, we prefetch 63 bytes ahead.
 			// Prefetch 4 samples ahead in all levels of the CPU cache
-			ACL_IMPL_ANIMATED_PREFETCH(segment_range_data + 64);
+			ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, segment_range_data + 64);
 #endif
 
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
@@ -545,6 +560,7 @@ namespace acl
 				if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
 				{
 					const uint32_t num_bits_at_bit_rate = format_per_track_data[unpack_index];
+					record_memory_touch<decompression_settings_type>(format_per_track_data + unpack_index, 1);
 
 					uint32_t sample_segment_range_ignore_mask;
 					uint32_t sample_clip_range_ignore_mask;
@@ -560,6 +576,7 @@ namespace acl
 						const uint32_t x = (uint32_t(shifted_segment_range_data[0]) << 8) | shifted_segment_range_data[4];
 						const uint32_t y = (uint32_t(shifted_segment_range_data[8]) << 8) | shifted_segment_range_data[12];
 						const uint32_t z = (uint32_t(shifted_segment_range_data[16]) << 8) | shifted_segment_range_data[20];
+						record_memory_touch<decompression_settings_type>(shifted_segment_range_data, 21);
 
 #if defined(RTM_SSE2_INTRINSICS)
 						// TODO: Use SIMD for this
@@ -589,13 +606,23 @@ namespace acl
 					else if (num_bits_at_bit_rate == num_raw_bit_rate_bits)	// Raw bit rate
 					{
 						rotation_as_vec = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
+						record_memory_touch<decompression_settings_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_96_load_size());
 						animated_track_data_bit_offset += 96;
 						sample_segment_range_ignore_mask = 0xFF;	// Ignore segment range
 						sample_clip_range_ignore_mask = 0xFF;		// Ignore clip range
 					}
 					else
 					{
-						rotation_as_vec = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
+						if (segment_sampling_context.is_byte_aligned)
+						{
+							rotation_as_vec = unpack_vector3_uXX_byte_aligned_unsafe(num_bits_at_bit_rate, animated_track_data + (animated_track_data_bit_offset / 8));
+							record_memory_touch<decompression_settings_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_uXX_byte_aligned_load_size(num_bits_at_bit_rate));
+						}
+						else
+						{
+							rotation_as_vec = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
+							record_memory_touch<decompression_settings_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_uXX_load_size(num_bits_at_bit_rate, animated_track_data_bit_offset));
+						}
 						animated_track_data_bit_offset += num_bits_at_bit_rate * 3;
 						sample_segment_range_ignore_mask = 0x00;
 						sample_clip_range_ignore_mask = 0x00;
@@ -610,11 +637,13 @@ namespace acl
 					if (rotation_format == rotation_format8::quatf_full && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full))
 					{
 						rotation_as_vec = unpack_vector4_128_unsafe(animated_track_data, animated_track_data_bit_offset);
+						record_memory_touch<decompression_settings_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector4_128_load_size());
 						animated_track_data_bit_offset += 128;
 					}
 					else // rotation_format8::quatf_drop_w_full
 					{
 						rotation_as_vec = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
+						record_memory_touch<decompression_settings_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_96_load_size());
 						animated_track_data_bit_offset += 96;
 					}
 				}
@@ -635,7 +664,7 @@ namespace acl
 			// of this cache line will fetch it. For safety, we prefetch 63 bytes ahead.
 			// Prefetch 4 samples ahead in all levels of the CPU cache
 #if defined(ACL_IMPL_PREFETCH_EARLY)
-			ACL_IMPL_ANIMATED_PREFETCH(animated_track_data + (animated_track_data_bit_offset / 8) + 63);
+			ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, animated_track_data + (animated_track_data_bit_offset / 8) + 63);
 #endif
 
 			// Update our pointers
@@ -643,7 +672,7 @@ namespace acl
 			{
 #if defined(ACL_IMPL_PREFETCH_EARLY)
 				// Prefetch the next cache line in all levels of the CPU cache
-				ACL_IMPL_ANIMATED_PREFETCH(format_per_track_data + 64);
+				ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, format_per_track_data + 64);
 #endif
 
 				// Skip our used metadata data, all groups are padded to 4 elements
@@ -742,6 +771,7 @@ namespace acl
 				animated_track_data_bit_offset += skip_size * 3;
 
 				const uint32_t num_bits_at_bit_rate = format_per_track_data[unpack_index];
+				record_memory_touch<decompression_settings_type>(format_per_track_data, unpack_index + 1);
 
 				if (num_bits_at_bit_rate == 0)	// Constant bit rate
 				{
@@ -754,6 +784,7 @@ namespace acl
 					const uint32_t x = (uint32_t(shifted_segment_range_data[0]) << 8) | shifted_segment_range_data[4];
 					const uint32_t y = (uint32_t(shifted_segment_range_data[8]) << 8) | shifted_segment_range_data[12];
 					const uint32_t z = (uint32_t(shifted_segment_range_data[16]) << 8) | shifted_segment_range_data[20];
+					record_memory_touch<decompression_settings_type>(shifted_segment_range_data, 21);
 
 #if defined(RTM_SSE2_INTRINSICS)
 					// TODO: Use SIMD for this
@@ -783,12 +814,22 @@ namespace acl
 				else if (num_bits_at_bit_rate == num_raw_bit_rate_bits)	// Raw bit rate
 				{
 					rotation_as_vec = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
+					record_memory_touch<decompression_settings_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_96_load_size());
 					segment_range_ignore_mask = 0xFF;	// Ignore segment range
 					clip_range_ignore_mask = 0xFF;		// Ignore clip range
 				}
 				else
 				{
-					rotation_as_vec = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
+					if (segment_sampling_context.is_byte_aligned)
+					{
+						rotation_as_vec = unpack_vector3_uXX_byte_aligned_unsafe(num_bits_at_bit_rate, animated_track_data + (animated_track_data_bit_offset / 8));
+						record_memory_touch<decompression_settings_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_uXX_byte_aligned_load_size(num_bits_at_bit_rate));
+					}
+					else
+					{
+						rotation_as_vec = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
+						record_memory_touch<decompression_settings_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_uXX_load_size(num_bits_at_bit_rate, animated_track_data_bit_offset));
+					}
 					segment_range_ignore_mask = 0x00;
 					clip_range_ignore_mask = 0x00;
 				}
@@ -799,11 +840,13 @@ namespace acl
 				{
 					animated_track_data_bit_offset += unpack_index * 128;
 					rotation_as_vec = unpack_vector4_128_unsafe(animated_track_data, animated_track_data_bit_offset);
+					record_memory_touch<decompression_settings_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector4_128_load_size());
 				}
 				else // rotation_format8::quatf_drop_w_full
 				{
 					animated_track_data_bit_offset += unpack_index * 96;
 					rotation_as_vec = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
+					record_memory_touch<decompression_settings_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_96_load_size());
 				}
 			}
 
@@ -822,6 +865,7 @@ namespace acl
 					const uint32_t extent_x = segment_range_data[12];
 					const uint32_t extent_y = segment_range_data[16];
 					const uint32_t extent_z = segment_range_data[20];
+					record_memory_touch<decompression_settings_type>(segment_range_data, 21);
 
 #if defined(RTM_SSE2_INTRINSICS)
 					__m128i min_u32 = _mm_setr_epi32(static_cast<int32_t>(min_x), static_cast<int32_t>(min_y), static_cast<int32_t>(min_z), 0);
@@ -851,6 +895,10 @@ namespace acl
 				{
 					const float* clip_range_data = bit_cast<const float*>(clip_sampling_context.clip_range_data) + unpack_index;	// Offset to our sample
 
+					// Each component lives in its own lane group
+					for (uint32_t component_index = 0; component_index < 6; ++component_index)
+						record_memory_touch<decompression_settings_type>(clip_range_data + group_size * component_index, sizeof(float));
+
 					const float min_x = clip_range_data[group_size * 0];
 					const float min_y = clip_range_data[group_size * 1];
 					const float min_z = clip_range_data[group_size * 2];
@@ -898,24 +946,36 @@ namespace acl
 				if (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
 				{
 					const uint32_t num_bits_at_bit_rate = *format_per_track_data;
+					record_memory_touch<decompression_settings_adapter_type>(format_per_track_data, 1);
 					format_per_track_data++;
 
 					if (num_bits_at_bit_rate == 0)	// Constant bit rate
 					{
 						sample = unpack_vector3_u48_unsafe(segment_range_data);
+						record_memory_touch<decompression_settings_adapter_type>(segment_range_data, get_unpack_vector3_u48_load_size());
 						segment_range_data += sizeof(uint16_t) * 3;
 						range_ignore_flags = 0x01;	// Skip segment only
 					}
 					else if (num_bits_at_bit_rate == num_raw_bit_rate_bits)	// Raw bit rate
 					{
 						sample = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
+						record_memory_touch<decompression_settings_adapter_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_96_load_size());
 						animated_track_data_bit_offset += 96;
 						segment_range_data += sizeof(uint16_t) * 3;	// Raw bit rates have unused range data, skip it
 						range_ignore_flags = 0x03;	// Skip clip and segment
 					}
 					else
 					{
-						sample = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
+						if (segment_sampling_context.is_byte_aligned)
+						{
+							sample = unpack_vector3_uXX_byte_aligned_unsafe(num_bits_at_bit_rate, animated_track_data + (animated_track_data_bit_offset / 8));
+							record_memory_touch<decompression_settings_adapter_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_uXX_byte_aligned_load_size(num_bits_at_bit_rate));
+						}
+						else
+						{
+							sample = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
+							record_memory_touch<decompression_settings_adapter_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_uXX_load_size(num_bits_at_bit_rate, animated_track_data_bit_offset));
+						}
 						animated_track_data_bit_offset += num_bits_at_bit_rate * 3;
 						range_ignore_flags = 0x00;	// Don't skip range reduction
 					}
@@ -923,6 +983,7 @@ namespace acl
 				else // vector_format8::vector3f_full
 				{
 					sample = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
+					record_memory_touch<decompression_settings_adapter_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_96_load_size());
 					animated_track_data_bit_offset += 96;
 					range_ignore_flags = 0x03;	// Skip clip and segment
 				}
@@ -940,6 +1001,8 @@ namespace acl
 
 						const rtm::vector4f segment_range_min = unpack_vector3_u24_unsafe(segment_range_min_ptr);
 						const rtm::vector4f segment_range_extent = unpack_vector3_u24_unsafe(segment_range_extent_ptr);
+						record_memory_touch<decompression_settings_adapter_type>(segment_range_min_ptr, get_unpack_vector3_u24_load_size());
+						record_memory_touch<decompression_settings_adapter_type>(segment_range_extent_ptr, get_unpack_vector3_u24_load_size());
 
 						sample = rtm::vector_mul_add(sample, segment_range_extent, segment_range_min);
 					}
@@ -954,6 +1017,8 @@ namespace acl
 
 						const rtm::vector4f clip_range_min = rtm::vector_load(clip_range_min_ptr);
 						const rtm::vector4f clip_range_extent = rtm::vector_load(clip_range_extent_ptr);
+						record_memory_touch<decompression_settings_adapter_type>(clip_range_min_ptr, sizeof(rtm::vector4f));
+						record_memory_touch<decompression_settings_adapter_type>(clip_range_extent_ptr, sizeof(rtm::vector4f));
 
 						sample = rtm::vector_mul_add(sample, clip_range_extent, clip_range_min);
 					}
@@ -984,9 +1049,9 @@ namespace acl
 			// case we don't need to prefetch it and we can go to the next one. Any offset after the end
 			// of this cache line will fetch it. For safety, we prefetch 63 bytes ahead.
 			// Prefetch 4 samples ahead in all levels of the CPU cache
-			ACL_IMPL_ANIMATED_PREFETCH(format_per_track_data + 60);
-			ACL_IMPL_ANIMATED_PREFETCH(animated_track_data + (animated_track_data_bit_offset / 8) + 63);
-			ACL_IMPL_ANIMATED_PREFETCH(segment_range_data + 48);
+			ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_adapter_type, format_per_track_data + 60);
+			ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_adapter_type, animated_track_data + (animated_track_data_bit_offset / 8) + 63);
+			ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_adapter_type, segment_range_data + 48);
 		}
 
 		template<class decompression_settings_adapter_type>
@@ -1051,20 +1116,32 @@ namespace acl
 				clip_range_data += sizeof(rtm::float3f) * 2 * unpack_index;
 
 				const uint32_t num_bits_at_bit_rate = format_per_track_data[unpack_index];
+				record_memory_touch<decompression_settings_adapter_type>(format_per_track_data, unpack_index + 1);
 
 				if (num_bits_at_bit_rate == 0)	// Constant bit rate
 				{
 					sample = unpack_vector3_u48_unsafe(segment_range_data);
+					record_memory_touch<decompression_settings_adapter_type>(segment_range_data, get_unpack_vector3_u48_load_size());
 					range_ignore_flags = 0x01;	// Skip segment only
 				}
 				else if (num_bits_at_bit_rate == num_raw_bit_rate_bits)	// Raw bit rate
 				{
 					sample = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
+					record_memory_touch<decompression_settings_adapter_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_96_load_size());
 					range_ignore_flags = 0x03;	// Skip clip and segment
 				}
 				else
 				{
-					sample = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
+					if (segment_sampling_context.is_byte_aligned)
+					{
+						sample = unpack_vector3_uXX_byte_aligned_unsafe(num_bits_at_bit_rate, animated_track_data + (animated_track_data_bit_offset / 8));
+						record_memory_touch<decompression_settings_adapter_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_uXX_byte_aligned_load_size(num_bits_at_bit_rate));
+					}
+					else
+					{
+						sample = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
+						record_memory_touch<decompression_settings_adapter_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_uXX_load_size(num_bits_at_bit_rate, animated_track_data_bit_offset));
+					}
 					range_ignore_flags = 0x00;	// Don't skip range reduction
 				}
 			}
@@ -1072,6 +1149,7 @@ namespace acl
 			{
 				animated_track_data_bit_offset += unpack_index * 96;
 				sample = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
+				record_memory_touch<decompression_settings_adapter_type>(animated_track_data + (animated_track_data_bit_offset / 8), get_unpack_vector3_96_load_size());
 				range_ignore_flags = 0x03;	// Skip clip and segment
 			}
 
@@ -1083,6 +1161,8 @@ namespace acl
 					// Apply segment range remapping
 					const rtm::vector4f segment_range_min = unpack_vector3_u24_unsafe(segment_range_data);
 					const rtm::vector4f segment_range_extent = unpack_vector3_u24_unsafe(segment_range_data + 3 * sizeof(uint8_t));
+					record_memory_touch<decompression_settings_adapter_type>(segment_range_data, get_unpack_vector3_u24_load_size());
+					record_memory_touch<decompression_settings_adapter_type>(segment_range_data + 3 * sizeof(uint8_t), get_unpack_vector3_u24_load_size());
 
 					sample = rtm::vector_mul_add(sample, segment_range_extent, segment_range_min);
 				}
@@ -1092,6 +1172,8 @@ namespace acl
 					// Apply clip range remapping
 					const rtm::vector4f clip_range_min = rtm::vector_load(clip_range_data);
 					const rtm::vector4f clip_range_extent = rtm::vector_load(clip_range_data + sizeof(rtm::float3f));
+					record_memory_touch<decompression_settings_adapter_type>(clip_range_data, sizeof(rtm::vector4f));
+					record_memory_touch<decompression_settings_adapter_type>(clip_range_data + sizeof(rtm::float3f), sizeof(rtm::vector4f));
 
 					sample = rtm::vector_mul_add(sample, clip_range_extent, clip_range_min);
 				}
@@ -1113,6 +1195,15 @@ namespace acl
 			// See write_format_per_track_data(..) for details
 			const uint32_t num_raw_bit_rate_bits = version >= compressed_tracks_version16::v02_01_99_1 ? 31U : 32U;
 
+			// We read the format of every sample we skip, the SIMD path loads 16 bytes per group
+#if defined(RTM_SSE3_INTRINSICS)
+			const uint32_t format_per_track_data_load_size = num_groups_to_skip != 0 ? (((num_groups_to_skip - 1) * 4) + 16) : 0;
+#else
+			const uint32_t format_per_track_data_load_size = num_groups_to_skip * 4;
+#endif
+			record_memory_touch<decompression_settings_adapter_type>(format_per_track_data0, format_per_track_data_load_size);
+			record_memory_touch<decompression_settings_adapter_type>(format_per_track_data1, format_per_track_data_load_size);
+
 			// TODO: Do the same with NEON
 #if defined(RTM_SSE3_INTRINSICS)
 			const __m128i zero = _mm_setzero_si128();
@@ -1225,9 +1316,13 @@ namespace acl
 			{
 				const compressed_tracks* tracks = decomp_context.tracks;
 				const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+				const compressed_tracks_version16 version = get_version<decompression_settings_type>(decomp_context.get_version());
 
 				const segment_header* segment0 = decomp_context.segment_offsets[0].add_to(tracks);
 				const segment_header* segment1 = decomp_context.segment_offsets[1].add_to(tracks);
+				record_memory_touch<decompression_settings_type>(&transform_header, sizeof(transform_tracks_header));
+				record_memory_touch<decompression_settings_type>(segment0, sizeof(segment_header));
+				record_memory_touch<decompression_settings_type>(segment1, sizeof(segment_header));
 
 				const uint8_t* animated_track_data0 = decomp_context.animated_track_data[0];
 				const uint8_t* animated_track_data1 = decomp_context.animated_track_data[1];
@@ -1242,6 +1337,7 @@ namespace acl
 				segment_sampling_context_rotations[0].segment_range_data = segment_range_data_rotations0;
 				segment_sampling_context_rotations[0].animated_track_data = animated_track_data0;
 				segment_sampling_context_rotations[0].animated_track_data_bit_offset = animated_track_data_bit_offset_rotations0;
+				segment_sampling_context_rotations[0].is_byte_aligned = segment0->get_is_byte_aligned(version);
 
 				const uint8_t* format_per_track_data_rotations1 = decomp_context.format_per_track_data[1];
 				const uint8_t* segment_range_data_rotations1 = decomp_context.segment_range_data[1];
@@ -1250,6 +1346,7 @@ namespace acl
 				segment_sampling_context_rotations[1].segment_range_data = segment_range_data_rotations1;
 				segment_sampling_context_rotations[1].animated_track_data = animated_track_data1;
 				segment_sampling_context_rotations[1].animated_track_data_bit_offset = animated_track_data_bit_offset_rotations1;
+				segment_sampling_context_rotations[1].is_byte_aligned = segment1->get_is_byte_aligned(version);
 
 				const rotation_format8 rotation_format = get_rotation_format<decompression_settings_type>(decomp_context.rotation_format);
 				const bool are_rotations_variable = rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable);
@@ -1284,6 +1381,9 @@ namespace acl
 				segment_sampling_context_translations[0].animated_track_data_bit_offset = animated_track_data_bit_offset_translations0;
 				segment_sampling_context_translations[1].animated_track_data_bit_offset = animated_track_data_bit_offset_translations1;
 
+				segment_sampling_context_translations[0].is_byte_aligned = segment_sampling_context_rotations[0].is_byte_aligned;
+				segment_sampling_context_translations[1].is_byte_aligned = segment_sampling_context_rotations[1].is_byte_aligned;
+
 				if (decomp_context.has_scale)
 				{
 					const vector_format8 translation_format = get_vector_format<decompression_settings_translation_adapter_type>(decompression_settings_translation_adapter_type::get_vector_format(decomp_context));
@@ -1306,6 +1406,9 @@ namespace acl
 
 					segment_sampling_context_scales[0].animated_track_data_bit_offset = animated_track_data_bit_offset_translations0 + segment0->animated_translation_bit_size;
 					segment_sampling_context_scales[1].animated_track_data_bit_offset = animated_track_data_bit_offset_translations1 + segment1->animated_translation_bit_size;
+
+					segment_sampling_context_scales[0].is_byte_aligned = segment_sampling_context_rotations[0].is_byte_aligned;
+					segment_sampling_context_scales[1].is_byte_aligned = segment_sampling_context_rotations[1].is_byte_aligned;
 				}
 
 				rotations.num_left_to_unpack = transform_header.num_animated_rotation_sub_tracks;
@@ -1344,16 +1447,18 @@ namespace acl
 				{
 					if (decomp_context.has_segments)
 					{
-						unpack_segment_range_data(segment_sampling_context_rotations[0].segment_range_data, 0, segment_scratch);
+						unpack_segment_range_data<decompression_settings_type>(segment_sampling_context_rotations[0].segment_range_data, 0, segment_scratch);
 
 						// We are interpolating between two segments (rare)
 						if (!decomp_context.uses_single_segment)
-							unpack_segment_range_data(segment_sampling_context_rotations[1].segment_range_data, 1, segment_scratch);
+						{
+							unpack_segment_range_data<decompression_settings_type>(segment_sampling_context_rotations[1].segment_range_data, 1, segment_scratch);
+						}
 
 #if !defined(ACL_IMPL_PREFETCH_EARLY)
 						// Our segment range data takes 24 bytes per group (4 samples, 6 bytes each), each cache line fits 2.67 groups
 						// Prefetch every time while alternating between both segments
-						ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[cache_write_index % 2].segment_range_data + 64);
+						ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, segment_sampling_context_rotations[cache_write_index % 2].segment_range_data + 64);
 #endif
 					}
 				}
@@ -1395,6 +1500,10 @@ namespace acl
 
 					const uint8_t* clip_range_data = clip_sampling_context_rotations.clip_range_data;
 
+					// Our min and extent are loaded one component at a time for the whole group, always 4 lanes wide
+					for (uint32_t component_index = 0; component_index < 6; ++component_index)
+						record_memory_touch<decompression_settings_type>(clip_range_data + num_to_unpack * sizeof(float) * component_index, sizeof(rtm::vector4f));
+
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
 					remap_clip_range_data_avx8(clip_range_data, num_to_unpack, range_reduction_masks0, range_reduction_masks1, scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
 #else
@@ -1407,8 +1516,8 @@ namespace acl
 
 #if defined(ACL_IMPL_PREFETCH_EARLY)
 					// Clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
-					ACL_IMPL_ANIMATED_PREFETCH(clip_range_data + 64);
-					ACL_IMPL_ANIMATED_PREFETCH(clip_range_data + 128);
+					ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, clip_range_data + 64);
+					ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, clip_range_data + 128);
 #endif
 				}
 
@@ -1439,9 +1548,9 @@ namespace acl
 						// This allows us to insert the prefetch basically for free in its shadow
 						// Branching is faster than prefetching every time and alternating between the two
 						if (cache_write_index == 0)
-							ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[0].format_per_track_data + 64);
+							ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, segment_sampling_context_rotations[0].format_per_track_data + 64);
 						else if (cache_write_index == 4)
-							ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[1].format_per_track_data + 64);
+							ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, segment_sampling_context_rotations[1].format_per_track_data + 64);
 					}
 #endif
 
@@ -1454,8 +1563,8 @@ namespace acl
 						// Each group is 96 bytes (4 samples, 24 bytes each), each cache line fits 0.67 groups
 						// We prefetch here because we have a square-root in quat_from_positive_w4(..) that we'll wait after
 						// This allows us to insert the prefetch basically for free in its shadow
-						ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_rotations.clip_range_data + 64);
-						ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_rotations.clip_range_data + 128);
+						ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, clip_sampling_context_rotations.clip_range_data + 64);
+						ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, clip_sampling_context_rotations.clip_range_data + 128);
 					}
 #endif
 #endif
@@ -1574,8 +1683,8 @@ namespace acl
 								const uint8_t* animated_track_data = segment_sampling_context_rotations[0].animated_track_data + 64;	// One cache line ahead
 								const uint32_t animated_bit_offset0 = segment_sampling_context_rotations[0].animated_track_data_bit_offset;
 								const uint32_t animated_bit_offset1 = segment_sampling_context_rotations[1].animated_track_data_bit_offset;
-								ACL_IMPL_ANIMATED_PREFETCH(animated_track_data + (animated_bit_offset0 / 8));
-								ACL_IMPL_ANIMATED_PREFETCH(animated_track_data + (animated_bit_offset1 / 8));
+								ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, animated_track_data + (animated_bit_offset0 / 8));
+								ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, animated_track_data + (animated_bit_offset1 / 8));
 							}
 #endif
 
@@ -1638,8 +1747,8 @@ namespace acl
 							const uint8_t* animated_track_data = segment_sampling_context_rotations[0].animated_track_data + 64;	// One cache line ahead
 							const uint32_t animated_bit_offset0 = segment_sampling_context_rotations[0].animated_track_data_bit_offset;
 							const uint32_t animated_bit_offset1 = segment_sampling_context_rotations[1].animated_track_data_bit_offset;
-							ACL_IMPL_ANIMATED_PREFETCH(animated_track_data + (animated_bit_offset0 / 8));
-							ACL_IMPL_ANIMATED_PREFETCH(animated_track_data + (animated_bit_offset1 / 8));
+							ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, animated_track_data + (animated_bit_offset0 / 8));
+							ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_type, animated_track_data + (animated_bit_offset1 / 8));
 						}
 #endif
 
@@ -1830,8 +1939,8 @@ namespace acl
 					clip_sampling_context_translations.clip_range_data += num_to_unpack * sizeof(rtm::float3f) * 2;
 
 					// Clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
-					ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_translations.clip_range_data + 64);
-					ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_translations.clip_range_data + 128);
+					ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_adapter_type, clip_sampling_context_translations.clip_range_data + 64);
+					ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_adapter_type, clip_sampling_context_translations.clip_range_data + 128);
 				}
 			}
 
@@ -1952,8 +2061,8 @@ namespace acl
 					clip_sampling_context_scales.clip_range_data += num_to_unpack * sizeof(rtm::float3f) * 2;
 
 					// Clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
-					ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_scales.clip_range_data + 64);
-					ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_scales.clip_range_data + 128);
+					ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_adapter_type, clip_sampling_context_scales.clip_range_data + 64);
+					ACL_IMPL_ANIMATED_PREFETCH(decompression_settings_adapter_type, clip_sampling_context_scales.clip_range_data + 128);
 				}
 			}
 
@@ -30,6 +30,7 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/decompression/impl/track_cache.h"
 #include "acl/decompression/impl/decompression_context.transform.h"
+#include "acl/decompression/impl/memory_touch_hooks.h"
 #include "acl/math/quat_packing.h"
 #include "acl/math/quatf.h"
 
@@ -68,9 +69,9 @@ namespace acl
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
 #if defined(ACL_IMPL_USE_CONSTANT_PREFETCH)
-#define ACL_IMPL_CONSTANT_PREFETCH(ptr) memory_prefetch(ptr)
+#define ACL_IMPL_CONSTANT_PREFETCH(settings_type, ptr) do { memory_prefetch(ptr); acl_impl::record_memory_prefetch<settings_type>(ptr); } while (false)
 #else
-#define ACL_IMPL_CONSTANT_PREFETCH(ptr) (void)(ptr)
+#define ACL_IMPL_CONSTANT_PREFETCH(settings_type, ptr) (void)(ptr)
 #endif
 
 	namespace acl_impl
@@ -138,6 +139,7 @@ namespace acl
 					for (uint32_t unpack_index = num_to_unpack; unpack_index != 0; --unpack_index)
 					{
 						// Unpack
+						record_memory_touch<decompression_settings_type>(constant_track_data, sizeof(rtm::float4f));
 						const rtm::quatf sample = unpack_quat_128(constant_track_data);
 
 						// Cache
@@ -160,6 +162,10 @@ namespace acl
 						// The last group contains no padding so we have to make to align our reads properly
 						const uint32_t load_size = unpack_count * sizeof(float);
 
+						record_memory_touch<decompression_settings_type>(constant_track_data + load_size * 0, sizeof(rtm::vector4f));
+						record_memory_touch<decompression_settings_type>(constant_track_data + load_size * 1, sizeof(rtm::vector4f));
+						record_memory_touch<decompression_settings_type>(constant_track_data + load_size * 2, sizeof(rtm::vector4f));
+
 						rtm::vector4f xxxx = rtm::vector_load(bit_cast<const float*>(constant_track_data + load_size * 0));
 						rtm::vector4f yyyy = rtm::vector_load(bit_cast<const float*>(constant_track_data + load_size * 1));
 						rtm::vector4f zzzz = rtm::vector_load(bit_cast<const float*>(constant_track_data + load_size * 2));
@@ -225,7 +231,7 @@ namespace acl
 				constant_data_rotations = constant_track_data;
 
 				// Prefetch our group
-				ACL_IMPL_CONSTANT_PREFETCH(constant_track_data);
+				ACL_IMPL_CONSTANT_PREFETCH(decompression_settings_type, constant_track_data);
 			}
 
 			template<class decompression_settings_type>
@@ -239,6 +245,7 @@ namespace acl
 				if (rotation_format == rotation_format8::quatf_full && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full))
 				{
 					const uint8_t* constant_track_data = constant_data_rotations + (unpack_index * sizeof(rtm::float4f));
+					record_memory_touch<decompression_settings_type>(constant_track_data, sizeof(rtm::float4f));
 					sample = unpack_quat_128(constant_track_data);
 				}
 				else
@@ -246,6 +253,9 @@ namespace acl
 					// Data is in SOA form
 					const uint32_t group_size = std::min<uint32_t>(rotations.num_left_to_unpack, 4);
 					const float* constant_track_data = bit_cast<const float*>(constant_data_rotations) + unpack_index;
+					record_memory_touch<decompression_settings_type>(constant_track_data + group_size * 0, sizeof(float));
+					record_memory_touch<decompression_settings_type>(constant_track_data + group_size * 1, sizeof(float));
+					record_memory_touch<decompression_settings_type>(constant_track_data + group_size * 2, sizeof(float));
 					const float x = constant_track_data[group_size * 0];
 					const float y = constant_track_data[group_size * 1];
 					const float z = constant_track_data[group_size * 2];
@@ -270,6 +280,7 @@ namespace acl
 				return rotations.cached_samples[0][cache_read_index % 32];
 			}
 
+			template<class decompression_settings_type>
 			RTM_DISABLE_SECURITY_COOKIE_CHECK void skip_translation_groups(uint32_t num_groups_to_skip)
 			{
 				const uint8_t* constant_track_data = constant_data_translations;
@@ -281,14 +292,16 @@ namespace acl
 				constant_data_translations = constant_track_data;
 
 				// Prefetch our group
-				ACL_IMPL_CONSTANT_PREFETCH(constant_track_data);
+				ACL_IMPL_CONSTANT_PREFETCH(decompression_settings_type, constant_track_data);
 			}
 
+			template<class decompression_settings_type>
 			RTM_DISABLE_SECURITY_COOKIE_CHECK rtm::vector4f RTM_SIMD_CALL unpack_translation_within_group(uint32_t unpack_index) const
 			{
 				ACL_ASSERT(unpack_index < 4, "Cannot unpack sample that isn't present");
 
 				const uint8_t* constant_track_data = constant_data_translations + (unpack_index * sizeof(rtm::float3f));
+				record_memory_touch<decompression_settings_type>(constant_track_data, sizeof(rtm::vector4f));
 				const rtm::vector4f sample = rtm::vector_load(constant_track_data);
 				ACL_ASSERT(rtm::vector_is_finite3(sample), "Sample is not valid!");
 				return sample;
@@ -301,6 +314,7 @@ namespace acl
 				return sample_ptr;
 			}
 
+			template<class decompression_settings_type>
 			RTM_DISABLE_SECURITY_COOKIE_CHECK void skip_scale_groups(uint32_t num_groups_to_skip)
 			{
 				const uint8_t* constant_track_data = constant_data_scales;
@@ -312,14 +326,16 @@ namespace acl
 				constant_data_scales = constant_track_data;
 
 				// Prefetch our group
-				ACL_IMPL_CONSTANT_PREFETCH(constant_track_data);
+				ACL_IMPL_CONSTANT_PREFETCH(decompression_settings_type, constant_track_data);
 			}
 
+			template<class decompression_settings_type>
 			RTM_DISABLE_SECURITY_COOKIE_CHECK rtm::vector4f RTM_SIMD_CALL unpack_scale_within_group(uint32_t unpack_index) const
 			{
 				ACL_ASSERT(unpack_index < 4, "Cannot unpack sample that isn't present");
 
 				const uint8_t* constant_track_data = constant_data_scales + (unpack_index * sizeof(rtm::float3f));
+				record_memory_touch<decompression_settings_type>(constant_track_data, sizeof(rtm::vector4f));
 				const rtm::vector4f sample = rtm::vector_load(constant_track_data);
 				ACL_ASSERT(rtm::vector_is_finite3(sample), "Sample is not valid!");
 				return sample;
@@ -28,14 +28,21 @@
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/core/interpolation_utils.h"
+#include "acl/core/profiling.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/range_reduction_types.h"
 #include "acl/core/track_writer.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/decimated_track_utils.h"
+#include "acl/core/impl/spline_key_utils.h"
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/decompression/database/database.h"
 #include "acl/math/scalar_packing.h"
 #include "acl/math/vector4_packing.h"
 
+#include <rtm/quatf.h>
 #include <rtm/scalarf.h>
+#include <rtm/vector4d.h>
 #include <rtm/vector4f.h>
 
 #include <cstdint>
@@ -74,10 +81,17 @@ namespace acl
 
 			uint32_t key_frame_bit_offsets[2] = { 0 };						//  20 |  24	// Variable quantization
 
-			uint8_t looping_policy = 0;										//  28 |  32
-			uint8_t rounding_policy = 0;									//  29 |  33
+			// Offsets in bytes to the segment range data of each key frame, relative to the animated values
+			// Only used when our tracks have segments
+			uint32_t segment_range_data_offsets[2] = { 0 };					//  28 |  32
 
-			uint8_t padding_tail[sizeof(void*) == 4 ? 34 : 30] = { 0 };		//  30 |  34
+			// Only used by sparse tracks
+			uint32_t key_frames[2] = { 0 };									//  36 |  40
+
+			uint8_t looping_policy = 0;										//  44 |  48
+			uint8_t rounding_policy = 0;									//  45 |  49
+
+			uint8_t padding_tail[sizeof(void*) == 4 ? 18 : 14] = { 0 };		//  46 |  50
 
 			//////////////////////////////////////////////////////////////////////////
 
@@ -96,10 +110,442 @@ namespace acl
 		static_assert(sizeof(persistent_scalar_decompression_context_v0) == 64, "Unexpected size");
 		static_assert(offsetof(persistent_scalar_decompression_context_v0, tracks) == 0, "tracks pointer needs to be the first member");
 
+		// Segments are sorted by their first sample, find the last one that starts at or before our sample
+		inline uint32_t find_scalar_segment_index(const scalar_segment_header* segment_headers, uint32_t num_segments, uint32_t sample_index)
+		{
+			uint32_t first_segment_index = 0;
+			uint32_t num_candidates = num_segments;
+			while (num_candidates > 1)
+			{
+				const uint32_t half_num_candidates = num_candidates / 2;
+				const uint32_t middle_segment_index = first_segment_index + half_num_candidates;
+				if (segment_headers[middle_segment_index].start_sample_index <= sample_index)
+				{
+					first_segment_index = middle_segment_index;
+					num_candidates -= half_num_candidates;
+				}
+				else
+					num_candidates = half_num_candidates;
+			}
+
+			return first_segment_index;
+		}
+
+		// Segment range data is stored on 8 bits per component, the minimum followed by the extent
+		inline rtm::scalarf RTM_SIMD_CALL apply_segment_range_scalarf(rtm::scalarf_arg0 value, const uint8_t* segment_range_data)
+		{
+			const float inv_max_range_value = 1.0F / float((1 << k_segment_range_reduction_num_bits_per_component) - 1);
+			const rtm::scalarf range_min = rtm::scalar_set(float(segment_range_data[0]) * inv_max_range_value);
+			const rtm::scalarf range_extent = rtm::scalar_set(float(segment_range_data[1]) * inv_max_range_value);
+			return rtm::scalar_mul_add(value, range_extent, range_min);
+		}
+
+		inline rtm::vector4f RTM_SIMD_CALL apply_segment_range_vector4f(rtm::vector4f_arg0 value, const uint8_t* segment_range_data, uint32_t num_components)
+		{
+			const float inv_max_range_value = 1.0F / float((1 << k_segment_range_reduction_num_bits_per_component) - 1);
+
+			float range_min[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+			float range_extent[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+			for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+			{
+				range_min[component_index] = float(segment_range_data[component_index]) * inv_max_range_value;
+				range_extent[component_index] = float(segment_range_data[num_components + component_index]) * inv_max_range_value;
+			}
+
+			return rtm::vector_mul_add(value, rtm::vector_load(&range_extent[0]), rtm::vector_load(&range_min[0]));
+		}
+
+		// Segment range data of a group of 4 float1f tracks: min0, extent0, min1, extent1, ...
+		inline rtm::vector4f RTM_SIMD_CALL apply_segment_range_float1f_group(rtm::vector4f_arg0 value, const uint8_t* segment_range_data)
+		{
+			const float inv_max_range_value = 1.0F / float((1 << k_segment_range_reduction_num_bits_per_component) - 1);
+
+			float range_min[4];
+			float range_extent[4];
+			for (uint32_t group_track_offset = 0; group_track_offset < 4; ++group_track_offset)
+			{
+				range_min[group_track_offset] = float(segment_range_data[group_track_offset * 2 + 0]) * inv_max_range_value;
+				range_extent[group_track_offset] = float(segment_range_data[group_track_offset * 2 + 1]) * inv_max_range_value;
+			}
+
+			return rtm::vector_mul_add(value, rtm::vector_load(&range_extent[0]), rtm::vector_load(&range_min[0]));
+		}
+
+		// Unpacks a sample with up to 4 components, the components we don't use are undefined
+		inline rtm::vector4f RTM_SIMD_CALL unpack_sample(const uint8_t* samples, uint32_t bit_offset, uint32_t num_bits_per_component, uint32_t num_components)
+		{
+			if (num_bits_per_component == 32)	// Raw bit rate
+			{
+				if (num_components <= 2)
+					return unpack_vector2_64_unsafe(samples, bit_offset);
+				else if (num_components == 3)
+					return unpack_vector3_96_unsafe(samples, bit_offset);
+				else
+					return unpack_vector4_128_unsafe(samples, bit_offset);
+			}
+
+			if (num_components <= 2)
+				return unpack_vector2_uXX_unsafe(num_bits_per_component, samples, bit_offset);
+			else if (num_components == 3)
+				return unpack_vector3_uXX_unsafe(num_bits_per_component, samples, bit_offset);
+			else
+				return unpack_vector4_uXX_unsafe(num_bits_per_component, samples, bit_offset);
+		}
+
+		// Unpacks a sample from track data that starts with its range min and extent followed by its packed samples
+		inline rtm::vector4f RTM_SIMD_CALL unpack_ranged_sample(const uint8_t* track_data, uint32_t sample_index, uint32_t num_bits_per_component, uint32_t num_components)
+		{
+			const float* range_values = safe_ptr_cast<const float>(track_data);
+			const uint8_t* samples = track_data + num_components * 2 * sizeof(float);
+			const uint32_t bit_offset = sample_index * num_bits_per_component * num_components;
+
+			const rtm::vector4f value = unpack_sample(samples, bit_offset, num_bits_per_component, num_components);
+			if (num_bits_per_component == 32)	// Raw bit rate
+				return value;
+
+			const rtm::vector4f range_min = rtm::vector_load(range_values);
+			const rtm::vector4f range_extent = rtm::vector_load(range_values + num_components);
+			return rtm::vector_mul_add(value, range_extent, range_min);
+		}
+
+		// Returns the sample of a sparse track at the specified key frame or its inactive value if no span contains it
+		inline rtm::vector4f RTM_SIMD_CALL sample_sparse_track(const uint8_t* sparse_track_data, const scalar_sparse_track_header& sparse_header, uint32_t key_frame, uint32_t num_components, const float* inactive_value)
+		{
+			const scalar_sparse_span* spans = safe_ptr_cast<const scalar_sparse_span>(sparse_track_data + sparse_header.spans_offset);
+			for (uint32_t span_index = 0; span_index < sparse_header.num_spans; ++span_index)
+			{
+				const scalar_sparse_span& span = spans[span_index];
+				if (key_frame < span.start_sample_index)
+					break;	// Spans are sorted, we are in between two spans
+
+				const uint32_t span_sample_index = key_frame - span.start_sample_index;
+				if (span_sample_index >= span.num_samples)
+					continue;	// After this span
+
+				// Sparse tracks are only supported with the latest bit rates
+				return unpack_ranged_sample(sparse_track_data + span.data_offset, span_sample_index, k_bit_rate_num_bits[span.bit_rate], num_components);
+			}
+
+			return rtm::vector_load(inactive_value);
+		}
+
+		inline rtm::vector4f RTM_SIMD_CALL interpolate_sparse_track_v0(const persistent_scalar_decompression_context_v0& context, const uint8_t* sparse_track_data, uint32_t sparse_track_index, uint32_t num_components, const float* inactive_value, rtm::scalarf_arg0 alpha)
+		{
+			const scalar_sparse_track_header& sparse_header = safe_ptr_cast<const scalar_sparse_track_header>(sparse_track_data + sizeof(uint32_t))[sparse_track_index];
+
+			const rtm::vector4f value0 = sample_sparse_track(sparse_track_data, sparse_header, context.key_frames[0], num_components, inactive_value);
+			const rtm::vector4f value1 = sample_sparse_track(sparse_track_data, sparse_header, context.key_frames[1], num_components, inactive_value);
+			return rtm::vector_lerp(value0, value1, alpha);
+		}
+
+		// Decimated tracks retain fewer samples, we find the ones that surround our key frames at their own sample rate
+		inline rtm::vector4f RTM_SIMD_CALL interpolate_decimated_track_v0(const persistent_scalar_decompression_context_v0& context, uint32_t num_samples, const uint8_t* decimated_track_data, uint32_t decimated_track_index, uint32_t num_components, float alpha)
+		{
+			const scalar_decimated_track_header& decimated_header = safe_ptr_cast<const scalar_decimated_track_header>(decimated_track_data + sizeof(uint32_t) * 2)[decimated_track_index];
+			const uint32_t decimation_shift = decimated_header.decimation_shift;
+
+			uint32_t decimated_index0;
+			uint32_t decimated_index1;
+			float decimated_alpha;
+			if (context.key_frames[1] < context.key_frames[0])
+			{
+				// We wrap from the last sample to the first, both are always retained
+				decimated_index0 = calculate_num_decimated_samples(num_samples, decimation_shift) - 1;
+				decimated_index1 = 0;
+				decimated_alpha = alpha;
+			}
+			else
+			{
+				find_decimated_samples(num_samples, decimation_shift, context.key_frames[0], alpha, decimated_index0, decimated_alpha);
+				decimated_index1 = decimated_index0 + 1;
+			}
+
+			// Decimated tracks are only supported with the latest bit rates
+			const uint8_t* track_data = decimated_track_data + decimated_header.data_offset;
+			const uint32_t num_bits_per_component = k_bit_rate_num_bits[decimated_header.bit_rate];
+
+			const rtm::vector4f value0 = unpack_ranged_sample(track_data, decimated_index0, num_bits_per_component, num_components);
+			const rtm::vector4f value1 = unpack_ranged_sample(track_data, decimated_index1, num_bits_per_component, num_components);
+			return rtm::vector_lerp(value0, value1, decimated_alpha);
+		}
+
+		// Whether or not any of the double precision track types are supported
+		template<class decompression_settings_type>
+		constexpr bool is_any_double_track_type_supported()
+		{
+			return decompression_settings_type::is_track_type_supported(track_type8::float1d)
+				|| decompression_settings_type::is_track_type_supported(track_type8::float2d)
+				|| decompression_settings_type::is_track_type_supported(track_type8::float3d)
+				|| decompression_settings_type::is_track_type_supported(track_type8::float4d)
+				|| decompression_settings_type::is_track_type_supported(track_type8::vector4d);
+		}
+
+		// Double precision tracks store their values relative to a base value per track, returns nullptr for other track types
+		inline const double* get_track_base_values(const tracks_header& header, const scalar_tracks_header& scalars_header)
+		{
+			if (!is_track_type_double_precision(header.track_type))
+				return nullptr;
+
+			return scalars_header.get_track_base_values(header.num_tracks, get_track_num_sample_elements(header.track_type));
+		}
+
+		// Double precision tracks add their base value back to the interpolated float delta
+		template<class decompression_settings_type, class track_writer_type>
+		inline void write_double_track_v0(track_writer_type& writer, track_type8 track_type, uint32_t track_index, rtm::vector4f_arg0 value, const double* base_values, bool honor_skip)
+		{
+			if (track_type == track_type8::float1d && decompression_settings_type::is_track_type_supported(track_type8::float1d))
+			{
+				if (!honor_skip || !writer.skip_track_float1d(track_index))
+					writer.write_float1d(track_index, rtm::vector_get_x(rtm::vector_add(rtm::vector_cast(value), rtm::vector_load1(base_values + track_index))));
+			}
+			else if (track_type == track_type8::float2d && decompression_settings_type::is_track_type_supported(track_type8::float2d))
+			{
+				if (!honor_skip || !writer.skip_track_float2d(track_index))
+					writer.write_float2d(track_index, rtm::vector_add(rtm::vector_cast(value), rtm::vector_load2(base_values + track_index * 2)));
+			}
+			else if (track_type == track_type8::float3d && decompression_settings_type::is_track_type_supported(track_type8::float3d))
+			{
+				if (!honor_skip || !writer.skip_track_float3d(track_index))
+					writer.write_float3d(track_index, rtm::vector_add(rtm::vector_cast(value), rtm::vector_load3(base_values + track_index * 3)));
+			}
+			else if (track_type == track_type8::float4d && decompression_settings_type::is_track_type_supported(track_type8::float4d))
+			{
+				if (!honor_skip || !writer.skip_track_float4d(track_index))
+					writer.write_float4d(track_index, rtm::vector_add(rtm::vector_cast(value), rtm::vector_load(base_values + track_index * 4)));
+			}
+			else if (track_type == track_type8::vector4d && decompression_settings_type::is_track_type_supported(track_type8::vector4d))
+			{
+				if (!honor_skip || !writer.skip_track_vector4d(track_index))
+					writer.write_vector4d(track_index, rtm::vector_add(rtm::vector_cast(value), rtm::vector_load(base_values + track_index * 4)));
+			}
+		}
+
+		template<class decompression_settings_type, class track_writer_type>
+		inline void write_scalar_track_v0(track_writer_type& writer, track_type8 track_type, uint32_t track_index, rtm::vector4f_arg0 value, const double* base_values, bool honor_skip)
+		{
+			if (track_type == track_type8::float1f && decompression_settings_type::is_track_type_supported(track_type8::float1f))
+			{
+				if (!honor_skip || !writer.skip_track_float1(track_index))
+					writer.write_float1(track_index, rtm::vector_get_x_as_scalar(value));
+			}
+			else if (track_type == track_type8::float2f && decompression_settings_type::is_track_type_supported(track_type8::float2f))
+			{
+				if (!honor_skip || !writer.skip_track_float2(track_index))
+					writer.write_float2(track_index, value);
+			}
+			else if (track_type == track_type8::float3f && decompression_settings_type::is_track_type_supported(track_type8::float3f))
+			{
+				if (!honor_skip || !writer.skip_track_float3(track_index))
+					writer.write_float3(track_index, value);
+			}
+			else if (track_type == track_type8::float4f && decompression_settings_type::is_track_type_supported(track_type8::float4f))
+			{
+				if (!honor_skip || !writer.skip_track_float4(track_index))
+					writer.write_float4(track_index, value);
+			}
+			else if (track_type == track_type8::vector4f && decompression_settings_type::is_track_type_supported(track_type8::vector4f))
+			{
+				if (!honor_skip || !writer.skip_track_vector4(track_index))
+					writer.write_vector4(track_index, value);
+			}
+			else if (track_type == track_type8::quatf && decompression_settings_type::is_track_type_supported(track_type8::quatf))
+			{
+				if (!honor_skip || !writer.skip_track_quat(track_index))
+					writer.write_quat(track_index, rtm::quat_normalize(rtm::quat_from_positive_w(value)));
+			}
+			else if (is_any_double_track_type_supported<decompression_settings_type>() && is_track_type_double_precision(track_type))
+				write_double_track_v0<decompression_settings_type>(writer, track_type, track_index, value, base_values, honor_skip);
+		}
+
+		// Spline key blocks store the keys of every animated track one after the other, we walk them in track order
+		struct spline_key_block_cursor
+		{
+			const spline_key_group_offsets* group_offsets;
+			const uint8_t* num_keys;
+			const uint8_t* key_sample_offsets;
+			const uint8_t* key_values;
+
+			spline_key_block_cursor(const uint8_t* animated_values, uint32_t block_offset, uint32_t num_groups)
+			{
+				const uint32_t num_animated_tracks = safe_ptr_cast<const uint32_t>(animated_values)[1];
+				const uint8_t* block = animated_values + block_offset;
+
+				group_offsets = safe_ptr_cast<const spline_key_group_offsets>(block + sizeof(uint32_t));
+				num_keys = block + sizeof(uint32_t) + num_groups * sizeof(spline_key_group_offsets);
+				key_sample_offsets = num_keys + num_animated_tracks;
+				key_values = block + *safe_ptr_cast<const uint32_t>(block);
+			}
+
+			// Moves to the first track of a group, only valid with track offsets and before we advance
+			void seek_to_group(uint32_t group_index, uint32_t num_preceding_animated_tracks)
+			{
+				const spline_key_group_offsets& offsets = group_offsets[group_index];
+				num_keys += num_preceding_animated_tracks;
+				key_sample_offsets += offsets.key_offset;
+				key_values += offsets.key_value_offset;
+			}
+
+			void advance(uint32_t key_size)
+			{
+				const uint32_t num_track_keys = *num_keys;
+				num_keys++;
+				key_sample_offsets += num_track_keys;
+				key_values += align_to(num_track_keys * key_size, 4);
+			}
+		};
+
+		// Evaluates the curve of the current track of a block at a sample offset relative to the start of the block
+		inline rtm::vector4f RTM_SIMD_CALL sample_spline_key_block_v0(const spline_key_block_cursor& cursor, uint32_t num_bits_per_component, uint32_t num_components, const float* range_values, float sample_offset)
+		{
+			uint32_t key_indices[4];
+			find_spline_keys(cursor.key_sample_offsets, *cursor.num_keys, sample_offset, key_indices);
+
+			float key_sample_offsets[4];
+			rtm::vector4f key_values[4];
+
+			if (num_bits_per_component == 32)	// Raw keys
+			{
+				const float* raw_key_values = safe_ptr_cast<const float>(cursor.key_values);
+				for (uint32_t key_offset = 0; key_offset < 4; ++key_offset)
+				{
+					const float* raw_key_value = raw_key_values + key_indices[key_offset] * num_components;
+
+					// Load component wise, raw keys are tightly packed and we could read past the end of our block
+					float components[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+					for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+						components[component_index] = raw_key_value[component_index];
+
+					key_sample_offsets[key_offset] = float(cursor.key_sample_offsets[key_indices[key_offset]]);
+					key_values[key_offset] = rtm::vector_load(&components[0]);
+				}
+			}
+			else
+			{
+				const uint16_t* quantized_key_values = safe_ptr_cast<const uint16_t>(cursor.key_values);
+				const rtm::vector4f range_min = rtm::vector_load(range_values);
+				const rtm::vector4f range_extent = rtm::vector_load(range_values + num_components);
+				for (uint32_t key_offset = 0; key_offset < 4; ++key_offset)
+				{
+					key_sample_offsets[key_offset] = float(cursor.key_sample_offsets[key_indices[key_offset]]);
+					key_values[key_offset] = unpack_spline_key_u16(quantized_key_values + key_indices[key_offset] * num_components, num_components, range_min, range_extent);
+				}
+			}
+
+			return interpolate_spline_keys(key_values[0], key_values[1], key_values[2], key_values[3], key_sample_offsets, sample_offset);
+		}
+
+		// Decompresses every track or only a single one if a valid track index is provided
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_spline_tracks_v0(const persistent_scalar_decompression_context_v0& context, uint32_t single_track_index, track_writer_type& writer)
+		{
+			ACL_PROFILE_SCOPE("acl::unpack_spline_tracks");
+
+			const tracks_header& header = get_tracks_header(*context.tracks);
+			const scalar_tracks_header& scalars_header = get_scalar_tracks_header(*context.tracks);
+
+			const track_type8 track_type = header.track_type;
+			const uint32_t num_components = get_scalar_track_num_packed_elements(track_type);
+			const double* base_values = get_track_base_values(header, scalars_header);
+			const bool is_single_track = single_track_index != k_invalid_track_index;
+			const uint32_t end_track_index = is_single_track ? (single_track_index + 1) : header.num_tracks;
+
+			const track_metadata* per_track_metadata = scalars_header.get_track_metadata();
+			const float* constant_values = scalars_header.get_track_constant_values();
+			const float* range_values = scalars_header.get_track_range_values();
+			const uint8_t* animated_values = scalars_header.get_track_animated_values();
+
+			// Find the blocks that contain our key frames, they might differ when we straddle two blocks or when we wrap
+			const uint32_t* block_header = safe_ptr_cast<const uint32_t>(animated_values);
+			const uint32_t num_samples_per_block = block_header[0];
+			const uint32_t* block_offsets = block_header + 2;
+			const uint32_t num_blocks = calculate_num_spline_key_blocks(header.num_samples, num_samples_per_block);
+
+			const uint32_t block_index0 = find_spline_key_block(context.key_frames[0], num_samples_per_block, num_blocks);
+			const uint32_t block_index1 = find_spline_key_block(context.key_frames[1], num_samples_per_block, num_blocks);
+			const float sample_offset0 = float(context.key_frames[0] - (block_index0 * num_samples_per_block));
+			const float sample_offset1 = float(context.key_frames[1] - (block_index1 * num_samples_per_block));
+
+			const bool has_track_offsets = header.get_has_track_offsets();
+			const uint32_t num_groups = calculate_num_spline_key_groups(header.num_tracks, has_track_offsets);
+
+			spline_key_block_cursor cursor0(animated_values, block_offsets[block_index0], num_groups);
+			spline_key_block_cursor cursor1(animated_values, block_offsets[block_index1], num_groups);
+
+			uint32_t start_track_index = 0;
+			if (is_single_track && has_track_offsets)
+			{
+				// Start walking from the nearest group of tracks that precedes us, this is constant time
+				const uint32_t group_index = single_track_index / k_scalar_track_offsets_stride;
+				const scalar_track_offsets& offsets = scalars_header.get_track_offsets(header.num_tracks)[group_index];
+
+				start_track_index = group_index * k_scalar_track_offsets_stride;
+				constant_values += offsets.constant_value_offset;
+				range_values += offsets.range_value_offset;
+
+				// With spline keys, the animated offset is the number of animated tracks that precede the group
+				cursor0.seek_to_group(group_index, offsets.animated_bit_offset);
+				cursor1.seek_to_group(group_index, offsets.animated_bit_offset);
+			}
+
+			// Consecutive key frames always live in the same block since blocks share their edge samples,
+			// we can evaluate our curve directly. Otherwise we interpolate linearly between both key frames.
+			const bool is_along_curve = context.key_frames[1] == (context.key_frames[0] + 1);
+
+			const sample_rounding_policy rounding_policy = static_cast<sample_rounding_policy>(context.rounding_policy);
+
+			for (uint32_t track_index = start_track_index; track_index < end_track_index; ++track_index)
+			{
+				const uint32_t num_bits_per_component = k_bit_rate_num_bits[per_track_metadata[track_index].bit_rate];
+				const bool is_requested = !is_single_track || track_index == single_track_index;
+
+				if (num_bits_per_component == 0)	// Constant bit rate
+				{
+					if (is_requested)
+						write_scalar_track_v0<decompression_settings_type>(writer, track_type, track_index, rtm::vector_load(constant_values), base_values, !is_single_track);
+
+					constant_values += num_components;
+					continue;
+				}
+
+				if (is_requested)
+				{
+					float alpha = context.interpolation_alpha;
+					if (decompression_settings_type::is_per_track_rounding_supported())
+					{
+						const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+						ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+
+						alpha = apply_rounding_policy(context.interpolation_alpha, rounding_policy_);
+					}
+
+					rtm::vector4f value;
+					if (is_along_curve)
+						value = sample_spline_key_block_v0(cursor0, num_bits_per_component, num_components, range_values, sample_offset0 + alpha);
+					else
+					{
+						const rtm::vector4f value0 = sample_spline_key_block_v0(cursor0, num_bits_per_component, num_components, range_values, sample_offset0);
+						const rtm::vector4f value1 = sample_spline_key_block_v0(cursor1, num_bits_per_component, num_components, range_values, sample_offset1);
+						value = rtm::vector_lerp(value0, value1, alpha);
+					}
+
+					write_scalar_track_v0<decompression_settings_type>(writer, track_type, track_index, value, base_values, !is_single_track);
+				}
+
+				const uint32_t key_size = num_components * (num_bits_per_component / 8);
+				cursor0.advance(key_size);
+				cursor1.advance(key_size);
+
+				if (num_bits_per_component < 32)	// Not raw bit rate
+					range_values += num_components * 2;
+			}
+		}
+
 		template<class decompression_settings_type, class database_settings_type>
 		inline bool initialize_v0(persistent_scalar_decompression_context_v0& context, const compressed_tracks& tracks, const database_context<database_settings_type>* database)
 		{
-			ACL_ASSERT(tracks.get_algorithm_type() == algorithm_type8::uniformly_sampled, "Invalid algorithm type [" ACL_ASSERT_STRING_FORMAT_SPECIFIER "], expected [" ACL_ASSERT_STRING_FORMAT_SPECIFIER "]", get_algorithm_name(tracks.get_algorithm_type()), get_algorithm_name(algorithm_type8::uniformly_sampled));
+			ACL_ASSERT(decompression_settings_type::is_algorithm_supported(tracks.get_algorithm_type()), "Unsupported algorithm type [" ACL_ASSERT_STRING_FORMAT_SPECIFIER "]", get_algorithm_name(tracks.get_algorithm_type()));
+			if (!decompression_settings_type::is_algorithm_supported(tracks.get_algorithm_type()))
+				return false;	// Algorithm type isn't supported by our decompression settings
 
 			if (database != nullptr)
 				return false;	// Database decompression is not supported for scalar tracks
@@ -181,6 +627,8 @@ namespace acl
 		template<class decompression_settings_type>
 		inline void seek_v0(persistent_scalar_decompression_context_v0& context, float sample_time, sample_rounding_policy rounding_policy)
 		{
+			ACL_PROFILE_SCOPE("acl::seek");
+
 			const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*context.tracks);
 			if (header.num_samples == 0)
 				return;	// Empty track list
@@ -202,16 +650,39 @@ namespace acl
 			find_linear_interpolation_samples_with_sample_rate(header.num_samples, header.sample_rate, sample_time, rounding_policy, looping_policy_, key_frame0, key_frame1, context.interpolation_alpha);
 
 			context.rounding_policy = static_cast<uint8_t>(rounding_policy);
+			context.key_frames[0] = key_frame0;
+			context.key_frames[1] = key_frame1;
 
 			const acl_impl::scalar_tracks_header& scalars_header = acl_impl::get_scalar_tracks_header(*context.tracks);
 
-			context.key_frame_bit_offsets[0] = key_frame0 * scalars_header.num_bits_per_frame;
-			context.key_frame_bit_offsets[1] = key_frame1 * scalars_header.num_bits_per_frame;
+			if (header.get_has_segments())
+			{
+				// Our key frames might live in different segments, each starts with its range data
+				const uint32_t* segment_table = scalars_header.get_segment_table(header.num_tracks, header.get_has_track_offsets());
+				const uint32_t num_segments = segment_table[0];
+				const acl_impl::scalar_segment_header* segment_headers = safe_ptr_cast<const acl_impl::scalar_segment_header>(segment_table + 1);
+				const uint32_t segment_range_data_size = scalars_header.get_segment_range_data_size();
+
+				const acl_impl::scalar_segment_header& segment_header0 = segment_headers[find_scalar_segment_index(segment_headers, num_segments, key_frame0)];
+				const acl_impl::scalar_segment_header& segment_header1 = segment_headers[find_scalar_segment_index(segment_headers, num_segments, key_frame1)];
+
+				context.segment_range_data_offsets[0] = segment_header0.segment_data_offset;
+				context.segment_range_data_offsets[1] = segment_header1.segment_data_offset;
+				context.key_frame_bit_offsets[0] = (segment_header0.segment_data_offset + segment_range_data_size) * 8 + (key_frame0 - segment_header0.start_sample_index) * scalars_header.num_bits_per_frame;
+				context.key_frame_bit_offsets[1] = (segment_header1.segment_data_offset + segment_range_data_size) * 8 + (key_frame1 - segment_header1.start_sample_index) * scalars_header.num_bits_per_frame;
+			}
+			else
+			{
+				context.key_frame_bit_offsets[0] = key_frame0 * scalars_header.num_bits_per_frame;
+				context.key_frame_bit_offsets[1] = key_frame1 * scalars_header.num_bits_per_frame;
+			}
 		}
 
 		template<class decompression_settings_type, class track_writer_type>
 		inline void decompress_tracks_v0(const persistent_scalar_decompression_context_v0& context, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::decompress_tracks");
+
 			const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*context.tracks);
 			const uint32_t num_tracks = header.num_tracks;
 			if (num_tracks == 0)
@@ -227,6 +698,16 @@ namespace acl
 			if (decompression_settings_type::disable_fp_exeptions())
 				disable_fp_exceptions(fp_env);
 
+			if (decompression_settings_type::is_algorithm_supported(algorithm_type8::spline_key_reduction) && header.algorithm_type == algorithm_type8::spline_key_reduction)
+			{
+				decompress_spline_tracks_v0<decompression_settings_type>(context, k_invalid_track_index, writer);
+
+				if (decompression_settings_type::disable_fp_exeptions())
+					restore_fp_exceptions(fp_env);
+
+				return;
+			}
+
 			const acl_impl::scalar_tracks_header& scalars_header = acl_impl::get_scalar_tracks_header(*context.tracks);
 			const rtm::scalarf interpolation_alpha = rtm::scalar_set(context.interpolation_alpha);
 
@@ -254,7 +735,23 @@ namespace acl
 			uint32_t track_bit_offset0 = context.key_frame_bit_offsets[0];
 			uint32_t track_bit_offset1 = context.key_frame_bit_offsets[1];
 
+			// When we have segments, the segment range data mirrors our range values with one byte per value
+			const bool has_segments = header.get_has_segments();
+			const float* range_values_start = range_values;
+			const uint8_t* segment_range_data0 = animated_values + context.segment_range_data_offsets[0];
+			const uint8_t* segment_range_data1 = animated_values + context.segment_range_data_offsets[1];
+
+			// Sparse tracks store their inactive value with the constant values and their spans separately
+			const uint8_t* sparse_track_data = header.get_has_sparse_tracks() ? scalars_header.get_sparse_track_data(num_tracks, header.get_has_track_offsets(), has_segments, header.get_has_decimated_tracks()) : nullptr;
+			const uint32_t num_element_components = get_scalar_track_num_packed_elements(header.track_type);
+			uint32_t sparse_track_index = 0;
+
+			// Decimated tracks are stored at a lower sample rate on their own
+			const uint8_t* decimated_track_data = header.get_has_decimated_tracks() ? scalars_header.get_decimated_track_data(num_tracks, header.get_has_track_offsets(), has_segments) : nullptr;
+			uint32_t decimated_track_index = 0;
+
 			const track_type8 track_type = header.track_type;
+			const double* base_values = get_track_base_values(header, scalars_header);
 
 			const compressed_tracks_version16 version = context.get_version();
 			const uint8_t* num_bits_at_bit_rate = version == compressed_tracks_version16::v02_00_00 ? k_bit_rate_num_bits_v0 : k_bit_rate_num_bits;
@@ -267,9 +764,108 @@ namespace acl
 			{
 				const acl_impl::track_metadata& metadata = per_track_metadata[track_index];
 				const uint32_t bit_rate = metadata.bit_rate;
+
+				if (bit_rate == k_scalar_sparse_track_bit_rate)
+				{
+					rtm::scalarf alpha = interpolation_alpha;
+					if (decompression_settings_type::is_per_track_rounding_supported())
+					{
+						const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+						ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+
+						alpha = rtm::scalar_set(interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)]);
+					}
+
+					const rtm::vector4f value = interpolate_sparse_track_v0(context, sparse_track_data, sparse_track_index, num_element_components, constant_values, alpha);
+					write_scalar_track_v0<decompression_settings_type>(writer, track_type, track_index, value, base_values, true);
+
+					constant_values += num_element_components;
+					sparse_track_index++;
+					continue;
+				}
+
+				if (bit_rate == k_scalar_decimated_track_bit_rate)
+				{
+					float alpha = context.interpolation_alpha;
+					if (decompression_settings_type::is_per_track_rounding_supported())
+					{
+						const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
+						ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+
+						alpha = interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)];
+					}
+
+					const rtm::vector4f value = interpolate_decimated_track_v0(context, header.num_samples, decimated_track_data, decimated_track_index, num_element_components, alpha);
+					write_scalar_track_v0<decompression_settings_type>(writer, track_type, track_index, value, base_values, true);
+
+					decimated_track_index++;
+					continue;
+				}
+
 				ACL_ASSERT(bit_rate < max_bit_rate, "Invalid bit rate: %u", bit_rate);
 				const uint32_t num_bits_per_component = num_bits_at_bit_rate[bit_rate];
 
+				if (track_type == track_type8::float1f && decompression_settings_type::is_track_type_supported(track_type8::float1f))
+				{
+					// When 4 consecutive animated tracks share the same bit rate, their samples are contiguous
+					// and we can unpack and interpolate them together like the components of a vector
+					const bool is_variable_bit_rate = num_bits_per_component != 0 && num_bits_per_component != 32;
+					if (is_variable_bit_rate && (track_index + 4) <= num_tracks && unaligned_load<uint32_t>(per_track_metadata + track_index) == (bit_rate * 0x01010101U))
+					{
+						rtm::vector4f value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
+						rtm::vector4f value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
+
+						if (has_segments)
+						{
+							const uint32_t segment_range_offset = uint32_t(range_values - range_values_start);
+							value0 = apply_segment_range_float1f_group(value0, segment_range_data0 + segment_range_offset);
+							value1 = apply_segment_range_float1f_group(value1, segment_range_data1 + segment_range_offset);
+						}
+
+						// Range values are interleaved per track: min0, extent0, min1, extent1, ...
+						const rtm::vector4f range_values01 = rtm::vector_load(range_values);
+						const rtm::vector4f range_values23 = rtm::vector_load(range_values + 4);
+						const rtm::vector4f range_min = rtm::vector_mix<rtm::mix4::x, rtm::mix4::z, rtm::mix4::a, rtm::mix4::c>(range_values01, range_values23);
+						const rtm::vector4f range_extent = rtm::vector_mix<rtm::mix4::y, rtm::mix4::w, rtm::mix4::b, rtm::mix4::d>(range_values01, range_values23);
+						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
+						value1 = rtm::vector_mul_add(value1, range_extent, range_min);
+						range_values += 8;
+
+						rtm::vector4f group_alpha = rtm::vector_set(context.interpolation_alpha);
+						if (decompression_settings_type::is_per_track_rounding_supported())
+						{
+							float group_alphas[4];
+							for (uint32_t group_track_offset = 0; group_track_offset < 4; ++group_track_offset)
+							{
+								const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index + group_track_offset);
+								ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+
+								group_alphas[group_track_offset] = interpolation_alpha_per_policy[static_cast<int>(rounding_policy_)];
+							}
+
+							group_alpha = rtm::vector_load(&group_alphas[0]);
+						}
+
+						const rtm::vector4f value = rtm::vector_lerp(value0, value1, group_alpha);
+
+						const uint32_t num_sample_bits = num_bits_per_component * 4;
+						track_bit_offset0 += num_sample_bits;
+						track_bit_offset1 += num_sample_bits;
+
+						float values[4];
+						rtm::vector_store(value, &values[0]);
+
+						for (uint32_t group_track_offset = 0; group_track_offset < 4; ++group_track_offset)
+						{
+							if (!writer.skip_track_float1(track_index + group_track_offset))
+								writer.write_float1(track_index + group_track_offset, rtm::scalar_set(values[group_track_offset]));
+						}
+
+						track_index += 3;	// Skip the rest of our group
+						continue;
+					}
+				}
+
 				rtm::scalarf alpha = interpolation_alpha;
 				if (decompression_settings_type::is_per_track_rounding_supported())
 				{
@@ -301,6 +897,13 @@ namespace acl
 							value0 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
 							value1 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
 
+							if (has_segments)
+							{
+								const uint32_t segment_range_offset = uint32_t(range_values - range_values_start);
+								value0 = apply_segment_range_scalarf(value0, segment_range_data0 + segment_range_offset);
+								value1 = apply_segment_range_scalarf(value1, segment_range_data1 + segment_range_offset);
+							}
+
 							const rtm::scalarf range_min = rtm::scalar_load_as_scalar(range_values);
 							const rtm::scalarf range_extent = rtm::scalar_load_as_scalar(range_values + 1);
 							value0 = rtm::scalar_mul_add(value0, range_extent, range_min);
@@ -340,6 +943,13 @@ namespace acl
 							value0 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
 							value1 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
 
+							if (has_segments)
+							{
+								const uint32_t segment_range_offset = uint32_t(range_values - range_values_start);
+								value0 = apply_segment_range_vector4f(value0, segment_range_data0 + segment_range_offset, 2);
+								value1 = apply_segment_range_vector4f(value1, segment_range_data1 + segment_range_offset, 2);
+							}
+
 							const rtm::vector4f range_min = rtm::vector_load(range_values);
 							const rtm::vector4f range_extent = rtm::vector_load(range_values + 2);
 							value0 = rtm::vector_mul_add(value0, range_extent, range_min);
@@ -379,6 +989,13 @@ namespace acl
 							value0 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
 							value1 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
 
+							if (has_segments)
+							{
+								const uint32_t segment_range_offset = uint32_t(range_values - range_values_start);
+								value0 = apply_segment_range_vector4f(value0, segment_range_data0 + segment_range_offset, 3);
+								value1 = apply_segment_range_vector4f(value1, segment_range_data1 + segment_range_offset, 3);
+							}
+
 							const rtm::vector4f range_min = rtm::vector_load(range_values);
 							const rtm::vector4f range_extent = rtm::vector_load(range_values + 3);
 							value0 = rtm::vector_mul_add(value0, range_extent, range_min);
@@ -418,6 +1035,13 @@ namespace acl
 							value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
 							value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
 
+							if (has_segments)
+							{
+								const uint32_t segment_range_offset = uint32_t(range_values - range_values_start);
+								value0 = apply_segment_range_vector4f(value0, segment_range_data0 + segment_range_offset, 4);
+								value1 = apply_segment_range_vector4f(value1, segment_range_data1 + segment_range_offset, 4);
+							}
+
 							const rtm::vector4f range_min = rtm::vector_load(range_values);
 							const rtm::vector4f range_extent = rtm::vector_load(range_values + 4);
 							value0 = rtm::vector_mul_add(value0, range_extent, range_min);
@@ -457,6 +1081,13 @@ namespace acl
 							value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
 							value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
 
+							if (has_segments)
+							{
+								const uint32_t segment_range_offset = uint32_t(range_values - range_values_start);
+								value0 = apply_segment_range_vector4f(value0, segment_range_data0 + segment_range_offset, 4);
+								value1 = apply_segment_range_vector4f(value1, segment_range_data1 + segment_range_offset, 4);
+							}
+
 							const rtm::vector4f range_min = rtm::vector_load(range_values);
 							const rtm::vector4f range_extent = rtm::vector_load(range_values + 4);
 							value0 = rtm::vector_mul_add(value0, range_extent, range_min);
@@ -474,6 +1105,92 @@ namespace acl
 					if (!writer.skip_track_vector4(track_index))
 						writer.write_vector4(track_index, value);
 				}
+				else if (track_type == track_type8::quatf && decompression_settings_type::is_track_type_supported(track_type8::quatf))
+				{
+					// Rotations drop their W component, we reconstruct it before we interpolate
+					rtm::quatf value;
+					if (num_bits_per_component == 0)	// Constant bit rate
+					{
+						value = rtm::quat_normalize(rtm::quat_from_positive_w(rtm::vector_load(constant_values)));
+						constant_values += 3;
+					}
+					else
+					{
+						rtm::vector4f value0;
+						rtm::vector4f value1;
+						if (num_bits_per_component == 32)	// Raw bit rate
+						{
+							value0 = unpack_vector3_96_unsafe(animated_values, track_bit_offset0);
+							value1 = unpack_vector3_96_unsafe(animated_values, track_bit_offset1);
+						}
+						else
+						{
+							value0 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
+							value1 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
+
+							if (has_segments)
+							{
+								const uint32_t segment_range_offset = uint32_t(range_values - range_values_start);
+								value0 = apply_segment_range_vector4f(value0, segment_range_data0 + segment_range_offset, 3);
+								value1 = apply_segment_range_vector4f(value1, segment_range_data1 + segment_range_offset, 3);
+							}
+
+							const rtm::vector4f range_min = rtm::vector_load(range_values);
+							const rtm::vector4f range_extent = rtm::vector_load(range_values + 3);
+							value0 = rtm::vector_mul_add(value0, range_extent, range_min);
+							value1 = rtm::vector_mul_add(value1, range_extent, range_min);
+							range_values += 6;
+						}
+
+						value = rtm::quat_lerp(rtm::quat_from_positive_w(value0), rtm::quat_from_positive_w(value1), rtm::scalar_cast(alpha));
+
+						const uint32_t num_sample_bits = num_bits_per_component * 3;
+						track_bit_offset0 += num_sample_bits;
+						track_bit_offset1 += num_sample_bits;
+					}
+
+					if (!writer.skip_track_quat(track_index))
+						writer.write_quat(track_index, value);
+				}
+				else if (is_any_double_track_type_supported<decompression_settings_type>() && is_track_type_double_precision(track_type))
+				{
+					// Double precision tracks interpolate their float deltas, the base value is added back when we write
+					rtm::vector4f value;
+					if (num_bits_per_component == 0)	// Constant bit rate
+					{
+						value = rtm::vector_load(constant_values);
+						constant_values += num_element_components;
+					}
+					else
+					{
+						rtm::vector4f value0 = unpack_sample(animated_values, track_bit_offset0, num_bits_per_component, num_element_components);
+						rtm::vector4f value1 = unpack_sample(animated_values, track_bit_offset1, num_bits_per_component, num_element_components);
+
+						if (num_bits_per_component != 32)	// Not raw bit rate
+						{
+							if (has_segments)
+							{
+								const uint32_t segment_range_offset = uint32_t(range_values - range_values_start);
+								value0 = apply_segment_range_vector4f(value0, segment_range_data0 + segment_range_offset, num_element_components);
+								value1 = apply_segment_range_vector4f(value1, segment_range_data1 + segment_range_offset, num_element_components);
+							}
+
+							const rtm::vector4f range_min = rtm::vector_load(range_values);
+							const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
+							value0 = rtm::vector_mul_add(value0, range_extent, range_min);
+							value1 = rtm::vector_mul_add(value1, range_extent, range_min);
+							range_values += num_element_components * 2;
+						}
+
+						value = rtm::vector_lerp(value0, value1, alpha);
+
+						const uint32_t num_sample_bits = num_bits_per_component * num_element_components;
+						track_bit_offset0 += num_sample_bits;
+						track_bit_offset1 += num_sample_bits;
+					}
+
+					write_double_track_v0<decompression_settings_type>(writer, track_type, track_index, value, base_values, true);
+				}
 			}
 
 			if (decompression_settings_type::disable_fp_exeptions())
@@ -483,6 +1200,8 @@ namespace acl
 		template<class decompression_settings_type, class track_writer_type>
 		inline void decompress_track_v0(const persistent_scalar_decompression_context_v0& context, uint32_t track_index, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::decompress_track");
+
 			const tracks_header& header = get_tracks_header(*context.tracks);
 			if (header.num_tracks == 0)
 				return;	// Empty track list
@@ -501,6 +1220,16 @@ namespace acl
 			if (decompression_settings_type::disable_fp_exeptions())
 				disable_fp_exceptions(fp_env);
 
+			if (decompression_settings_type::is_algorithm_supported(algorithm_type8::spline_key_reduction) && header.algorithm_type == algorithm_type8::spline_key_reduction)
+			{
+				decompress_spline_tracks_v0<decompression_settings_type>(context, track_index, writer);
+
+				if (decompression_settings_type::disable_fp_exeptions())
+					restore_fp_exceptions(fp_env);
+
+				return;
+			}
+
 			const scalar_tracks_header& scalars_header = get_scalar_tracks_header(*context.tracks);
 
 			rtm::scalarf interpolation_alpha = rtm::scalar_set(context.interpolation_alpha);
@@ -524,14 +1253,48 @@ namespace acl
 			const float* range_values = scalars_header.get_track_range_values();
 
 			const track_type8 track_type = header.track_type;
-			const uint32_t num_element_components = get_track_num_sample_elements(track_type);
+			const uint32_t num_element_components = get_scalar_track_num_packed_elements(track_type);
+			const double* base_values = get_track_base_values(header, scalars_header);
 			uint32_t track_bit_offset = 0;
+			uint32_t scan_start_track_index = 0;
+			uint32_t sparse_track_index = 0;
+			uint32_t decimated_track_index = 0;
+
+			if (header.get_has_track_offsets())
+			{
+				// Start scanning from the nearest group of tracks that precedes us, this is constant time
+				const uint32_t group_index = track_index / k_scalar_track_offsets_stride;
+				const scalar_track_offsets& offsets = scalars_header.get_track_offsets(header.num_tracks)[group_index];
+
+				scan_start_track_index = group_index * k_scalar_track_offsets_stride;
+				track_bit_offset = offsets.animated_bit_offset;
+				constant_values += offsets.constant_value_offset;
+				range_values += offsets.range_value_offset;
+				sparse_track_index = offsets.sparse_track_offset;
+				decimated_track_index = offsets.decimated_track_offset;
+			}
 
 			const acl_impl::track_metadata* per_track_metadata = scalars_header.get_track_metadata();
-			for (uint32_t scan_track_index = 0; scan_track_index < track_index; ++scan_track_index)
+			for (uint32_t scan_track_index = scan_start_track_index; scan_track_index < track_index; ++scan_track_index)
 			{
 				const acl_impl::track_metadata& metadata = per_track_metadata[scan_track_index];
 				const uint32_t bit_rate = metadata.bit_rate;
+
+				if (bit_rate == k_scalar_sparse_track_bit_rate)
+				{
+					// Sparse tracks store their inactive value with the constant values
+					constant_values += num_element_components;
+					sparse_track_index++;
+					continue;
+				}
+
+				if (bit_rate == k_scalar_decimated_track_bit_rate)
+				{
+					// Decimated tracks live entirely in the decimated track data
+					decimated_track_index++;
+					continue;
+				}
+
 				ACL_ASSERT(bit_rate < max_bit_rate, "Invalid bit rate: %u", bit_rate);
 				const uint32_t num_bits_per_component = num_bits_at_bit_rate[bit_rate];
 				track_bit_offset += num_bits_per_component * num_element_components;
@@ -544,11 +1307,42 @@ namespace acl
 
 			const acl_impl::track_metadata& metadata = per_track_metadata[track_index];
 			const uint32_t bit_rate = metadata.bit_rate;
+
+			if (bit_rate == k_scalar_sparse_track_bit_rate)
+			{
+				const uint8_t* sparse_track_data = scalars_header.get_sparse_track_data(header.num_tracks, header.get_has_track_offsets(), header.get_has_segments(), header.get_has_decimated_tracks());
+				const rtm::vector4f value = interpolate_sparse_track_v0(context, sparse_track_data, sparse_track_index, num_element_components, constant_values, interpolation_alpha);
+				write_scalar_track_v0<decompression_settings_type>(writer, track_type, track_index, value, base_values, false);
+
+				if (decompression_settings_type::disable_fp_exeptions())
+					restore_fp_exceptions(fp_env);
+
+				return;
+			}
+
+			if (bit_rate == k_scalar_decimated_track_bit_rate)
+			{
+				const uint8_t* decimated_track_data = scalars_header.get_decimated_track_data(header.num_tracks, header.get_has_track_offsets(), header.get_has_segments());
+				const rtm::vector4f value = interpolate_decimated_track_v0(context, header.num_samples, decimated_track_data, decimated_track_index, num_element_components, rtm::scalar_cast(interpolation_alpha));
+				write_scalar_track_v0<decompression_settings_type>(writer, track_type, track_index, value, base_values, false);
+
+				if (decompression_settings_type::disable_fp_exeptions())
+					restore_fp_exceptions(fp_env);
+
+				return;
+			}
+
 			ACL_ASSERT(bit_rate < max_bit_rate, "Invalid bit rate: %u", bit_rate);
 			const uint32_t num_bits_per_component = num_bits_at_bit_rate[bit_rate];
 
 			const uint8_t* animated_values = scalars_header.get_track_animated_values();
 
+			// When we have segments, the segment range data mirrors our range values with one byte per value
+			const bool has_segments = header.get_has_segments();
+			const uint32_t segment_range_offset = uint32_t(range_values - scalars_header.get_track_range_values());
+			const uint8_t* segment_range_data0 = animated_values + context.segment_range_data_offsets[0] + segment_range_offset;
+			const uint8_t* segment_range_data1 = animated_values + context.segment_range_data_offsets[1] + segment_range_offset;
+
 			if (track_type == track_type8::float1f && decompression_settings_type::is_track_type_supported(track_type8::float1f))
 			{
 				rtm::scalarf value;
@@ -568,6 +1362,12 @@ namespace acl
 						value0 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
 						value1 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
 
+						if (has_segments)
+						{
+							value0 = apply_segment_range_scalarf(value0, segment_range_data0);
+							value1 = apply_segment_range_scalarf(value1, segment_range_data1);
+						}
+
 						const rtm::scalarf range_min = rtm::scalar_load_as_scalar(range_values);
 						const rtm::scalarf range_extent = rtm::scalar_load_as_scalar(range_values + num_element_components);
 						value0 = rtm::scalar_mul_add(value0, range_extent, range_min);
@@ -598,6 +1398,12 @@ namespace acl
 						value0 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
 						value1 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
 
+						if (has_segments)
+						{
+							value0 = apply_segment_range_vector4f(value0, segment_range_data0, num_element_components);
+							value1 = apply_segment_range_vector4f(value1, segment_range_data1, num_element_components);
+						}
+
 						const rtm::vector4f range_min = rtm::vector_load(range_values);
 						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
 						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
@@ -628,6 +1434,12 @@ namespace acl
 						value0 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
 						value1 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
 
+						if (has_segments)
+						{
+							value0 = apply_segment_range_vector4f(value0, segment_range_data0, num_element_components);
+							value1 = apply_segment_range_vector4f(value1, segment_range_data1, num_element_components);
+						}
+
 						const rtm::vector4f range_min = rtm::vector_load(range_values);
 						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
 						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
@@ -658,6 +1470,12 @@ namespace acl
 						value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
 						value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
 
+						if (has_segments)
+						{
+							value0 = apply_segment_range_vector4f(value0, segment_range_data0, num_element_components);
+							value1 = apply_segment_range_vector4f(value1, segment_range_data1, num_element_components);
+						}
+
 						const rtm::vector4f range_min = rtm::vector_load(range_values);
 						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
 						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
@@ -688,6 +1506,12 @@ namespace acl
 						value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
 						value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
 
+						if (has_segments)
+						{
+							value0 = apply_segment_range_vector4f(value0, segment_range_data0, num_element_components);
+							value1 = apply_segment_range_vector4f(value1, segment_range_data1, num_element_components);
+						}
+
 						const rtm::vector4f range_min = rtm::vector_load(range_values);
 						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
 						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
@@ -699,6 +1523,73 @@ namespace acl
 
 				writer.write_vector4(track_index, value);
 			}
+			else if (track_type == track_type8::quatf && decompression_settings_type::is_track_type_supported(track_type8::quatf))
+			{
+				// Rotations drop their W component, we reconstruct it before we interpolate
+				rtm::quatf value;
+				if (num_bits_per_component == 0)	// Constant bit rate
+					value = rtm::quat_normalize(rtm::quat_from_positive_w(rtm::vector_load(constant_values)));
+				else
+				{
+					rtm::vector4f value0;
+					rtm::vector4f value1;
+					if (num_bits_per_component == 32)	// Raw bit rate
+					{
+						value0 = unpack_vector3_96_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_vector3_96_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+					}
+					else
+					{
+						value0 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+
+						if (has_segments)
+						{
+							value0 = apply_segment_range_vector4f(value0, segment_range_data0, num_element_components);
+							value1 = apply_segment_range_vector4f(value1, segment_range_data1, num_element_components);
+						}
+
+						const rtm::vector4f range_min = rtm::vector_load(range_values);
+						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
+						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
+						value1 = rtm::vector_mul_add(value1, range_extent, range_min);
+					}
+
+					value = rtm::quat_lerp(rtm::quat_from_positive_w(value0), rtm::quat_from_positive_w(value1), rtm::scalar_cast(interpolation_alpha));
+				}
+
+				writer.write_quat(track_index, value);
+			}
+			else if (is_any_double_track_type_supported<decompression_settings_type>() && is_track_type_double_precision(track_type))
+			{
+				// Double precision tracks interpolate their float deltas, the base value is added back when we write
+				rtm::vector4f value;
+				if (num_bits_per_component == 0)	// Constant bit rate
+					value = rtm::vector_load(constant_values);
+				else
+				{
+					rtm::vector4f value0 = unpack_sample(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset, num_bits_per_component, num_element_components);
+					rtm::vector4f value1 = unpack_sample(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset, num_bits_per_component, num_element_components);
+
+					if (num_bits_per_component != 32)	// Not raw bit rate
+					{
+						if (has_segments)
+						{
+							value0 = apply_segment_range_vector4f(value0, segment_range_data0, num_element_components);
+							value1 = apply_segment_range_vector4f(value1, segment_range_data1, num_element_components);
+						}
+
+						const rtm::vector4f range_min = rtm::vector_load(range_values);
+						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
+						value0 = rtm::vector_mul_add(value0, range_extent, range_min);
+						value1 = rtm::vector_mul_add(value1, range_extent, range_min);
+					}
+
+					value = rtm::vector_lerp(value0, value1, interpolation_alpha);
+				}
+
+				write_double_track_v0<decompression_settings_type>(writer, track_type, track_index, value, base_values, false);
+			}
 
 			if (decompression_settings_type::disable_fp_exeptions())
 				restore_fp_exceptions(fp_env);
@@ -30,6 +30,7 @@
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/core/interpolation_utils.h"
+#include "acl/core/profiling.h"
 #include "acl/core/range_reduction_types.h"
 #include "acl/core/track_formats.h"
 #include "acl/core/track_writer.h"
@@ -38,6 +39,7 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/decompression/database/database.h"
+#include "acl/decompression/impl/memory_touch_hooks.h"
 #include "acl/decompression/impl/animated_track_cache.transform.h"
 #include "acl/decompression/impl/constant_track_cache.transform.h"
 #include "acl/decompression/impl/decompression_context.transform.h"
@@ -70,9 +72,9 @@ namespace acl
 	namespace acl_impl
 	{
 #if defined(ACL_IMPL_USE_SEEK_PREFETCH)
-#define ACL_IMPL_SEEK_PREFETCH(ptr) memory_prefetch(ptr)
+#define ACL_IMPL_SEEK_PREFETCH(settings_type, ptr) do { memory_prefetch(ptr); acl_impl::record_memory_prefetch<settings_type>(ptr); } while (false)
 #else
-#define ACL_IMPL_SEEK_PREFETCH(ptr) (void)(ptr)
+#define ACL_IMPL_SEEK_PREFETCH(settings_type, ptr) (void)(ptr)
 #endif
 
 		template<class decompression_settings_type>
@@ -206,8 +208,12 @@ namespace acl
 		template<class decompression_settings_type>
 		inline void seek_v0(persistent_transform_decompression_context_v0& context, float sample_time, sample_rounding_policy rounding_policy)
 		{
+			ACL_PROFILE_SCOPE("acl::seek");
+
 			const compressed_tracks* tracks = context.tracks;
 			const tracks_header& header = get_tracks_header(*tracks);
+			record_memory_touch<decompression_settings_type>(&header, sizeof(tracks_header));
+
 			if (header.num_tracks == 0)
 				return;	// Empty track list
 
@@ -219,6 +225,7 @@ namespace acl
 				return;
 
 			const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+			record_memory_touch<decompression_settings_type>(&transform_header, sizeof(transform_tracks_header));
 
 			// Prefetch our sub-track types, we'll need them soon when we start decompressing
 			// Most clips will have their sub-track types fit into 1 or 2 cache lines, we'll prefetch 2
@@ -226,8 +233,8 @@ namespace acl
 			{
 				const uint8_t* sub_track_types = bit_cast<const uint8_t*>(transform_header.get_sub_track_types());
 
-				ACL_IMPL_SEEK_PREFETCH(sub_track_types);
-				ACL_IMPL_SEEK_PREFETCH(sub_track_types + 64);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, sub_track_types);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, sub_track_types + 64);
 			}
 
 			context.sample_time = sample_time;
@@ -296,6 +303,11 @@ namespace acl
 
 						// Cache miss for the db segment headers
 						const database_runtime_segment_header* db_segment_header0 = db_segment_headers;
+
+						record_memory_touch<decompression_settings_type>(tracks_db_header, sizeof(tracks_database_header));
+						record_memory_touch<decompression_settings_type>(db_clip_header, sizeof(database_runtime_clip_header));
+						record_memory_touch<decompression_settings_type>(db_segment_header0, sizeof(database_runtime_segment_header));
+
 						medium_importance_tier_metadata0 = db_segment_header0->tier_metadata[0].load(k_memory_order_relaxed);
 						low_importance_tier_metadata0 = db_segment_header0->tier_metadata[1].load(k_memory_order_relaxed);
 
@@ -389,6 +401,8 @@ namespace acl
 
 				for (uint32_t segment_index = start_segment_index; segment_index < end_segment_index; ++segment_index)
 				{
+					record_memory_touch<decompression_settings_type>(segment_start_indices + segment_index, sizeof(uint32_t));
+
 					if (key_frame0 < segment_start_indices[segment_index])
 					{
 						// We went too far, use previous segment
@@ -405,6 +419,9 @@ namespace acl
 					}
 				}
 
+				record_memory_touch<decompression_settings_type>(segment_start_indices + segment_index0, sizeof(uint32_t));
+				record_memory_touch<decompression_settings_type>(segment_start_indices + segment_index1, sizeof(uint32_t));
+
 				segment_key_frame0 = key_frame0 - segment_start_indices[segment_index0];
 				segment_key_frame1 = key_frame1 - segment_start_indices[segment_index1];
 
@@ -439,6 +456,11 @@ namespace acl
 
 						// Cache miss for the db segment headers
 						const database_runtime_segment_header* db_segment_header0 = db_segment_headers + segment_index0;
+
+						record_memory_touch<decompression_settings_type>(tracks_db_header, sizeof(tracks_database_header));
+						record_memory_touch<decompression_settings_type>(db_clip_header, sizeof(database_runtime_clip_header));
+						record_memory_touch<decompression_settings_type>(db_segment_header0, sizeof(database_runtime_segment_header));
+
 						medium_importance_tier_metadata0 = db_segment_header0->tier_metadata[0].load(k_memory_order_relaxed);
 						low_importance_tier_metadata0 = db_segment_header0->tier_metadata[1].load(k_memory_order_relaxed);
 
@@ -446,6 +468,8 @@ namespace acl
 						sample_indices0 |= uint32_t(low_importance_tier_metadata0);
 
 						const database_runtime_segment_header* db_segment_header1 = db_segment_headers + segment_index1;
+						record_memory_touch<decompression_settings_type>(db_segment_header1, sizeof(database_runtime_segment_header));
+
 						medium_importance_tier_metadata1 = db_segment_header1->tier_metadata[0].load(k_memory_order_relaxed);
 						low_importance_tier_metadata1 = db_segment_header1->tier_metadata[1].load(k_memory_order_relaxed);
 
@@ -523,8 +547,8 @@ namespace acl
 			{
 				// Prefetch our constant rotation data, we'll need it soon when we start decompressing and we are about to cache miss on the segment headers
 				const uint8_t* constant_data_rotations = transform_header.get_constant_track_data();
-				ACL_IMPL_SEEK_PREFETCH(constant_data_rotations);
-				ACL_IMPL_SEEK_PREFETCH(constant_data_rotations + 64);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, constant_data_rotations);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, constant_data_rotations + 64);
 			}
 
 			const bool uses_single_segment = segment_header0 == segment_header1;
@@ -555,8 +579,14 @@ namespace acl
 					context.animated_track_data[1] = db_animated_track_data1;
 			}
 
-			context.key_frame_bit_offsets[0] = segment_key_frame0 * segment_header0->animated_pose_bit_size;
-			context.key_frame_bit_offsets[1] = segment_key_frame1 * segment_header1->animated_pose_bit_size;
+			// Our segment headers tell us where our data lives and how large our key frames are
+			const size_t segment_header_size = has_stripped_keyframes ? sizeof(stripped_segment_header_t) : sizeof(segment_header);
+			record_memory_touch<decompression_settings_type>(segment_header0, segment_header_size);
+			record_memory_touch<decompression_settings_type>(segment_header1, segment_header_size);
+
+			const compressed_tracks_version16 version = get_version<decompression_settings_type>(header.version);
+			context.key_frame_bit_offsets[0] = segment_key_frame0 * segment_header0->get_animated_pose_bit_size(version);
+			context.key_frame_bit_offsets[1] = segment_key_frame1 * segment_header1->get_animated_pose_bit_size(version);
 
 			context.segment_offsets[0] = ptr_offset32<segment_header>(tracks, segment_header0);
 			context.segment_offsets[1] = ptr_offset32<segment_header>(tracks, segment_header1);
@@ -571,11 +601,13 @@ namespace acl
 
 
 		// Force inline this function, we only use it to keep the code readable
-		template<class track_writer_type>
+		template<class decompression_settings_type, class track_writer_type>
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_default_rotation_sub_tracks(
 			const packed_sub_track_types* rotation_sub_track_types, uint32_t last_entry_index, uint32_t padding_mask,
 			track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::unpack_default_rotation_sub_tracks");
+
 			constexpr default_sub_track_mode default_mode = track_writer_type::get_default_rotation_mode();
 			static_assert(default_mode != default_sub_track_mode::legacy, "Not supported for rotations");
 			if (default_mode == default_sub_track_mode::skipped)
@@ -587,6 +619,7 @@ namespace acl
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
 			{
 				uint32_t packed_entry = rotation_sub_track_types[entry_index].types;
+				record_memory_touch<decompression_settings_type>(&rotation_sub_track_types[entry_index], sizeof(packed_sub_track_types));
 
 				// Mask out everything but default sub-tracks, this way we can early out when we iterate
 				// Each sub-track is either 0 (default), 1 (constant), or 2 (animated)
@@ -681,11 +714,14 @@ namespace acl
 			const persistent_transform_decompression_context_v0& context,
 			constant_track_cache_v0& constant_track_cache, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::unpack_constant_rotation_sub_tracks");
+
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
 			{
 				// Mask out everything but constant sub-tracks, this way we can early out when we iterate
 				// Use and_not(..) to load our sub-track types directly from memory on x64 with BMI
 				uint32_t packed_entry = and_not(~0x55555555U, rotation_sub_track_types[entry_index].types);
+				record_memory_touch<decompression_settings_type>(&rotation_sub_track_types[entry_index], sizeof(packed_sub_track_types));
 
 				uint32_t curr_entry_track_index = track_index;
 
@@ -754,6 +790,8 @@ namespace acl
 			const persistent_transform_decompression_context_v0& context,
 			animated_track_cache_v0& animated_track_cache, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::unpack_animated_rotation_sub_tracks");
+
 			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
 
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
@@ -761,6 +799,7 @@ namespace acl
 				// Mask out everything but animated sub-tracks, this way we can early out when we iterate
 				// Use and_not(..) to load our sub-track types directly from memory on x64 with BMI
 				uint32_t packed_entry = and_not(~0xAAAAAAAAU, rotation_sub_track_types[entry_index].types);
+				record_memory_touch<decompression_settings_type>(&rotation_sub_track_types[entry_index], sizeof(packed_sub_track_types));
 
 				uint32_t curr_entry_track_index = track_index;
 
@@ -879,11 +918,13 @@ namespace acl
 		}
 
 		// Force inline this function, we only use it to keep the code readable
-		template<class track_writer_type>
+		template<class decompression_settings_type, class track_writer_type>
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_default_translation_sub_tracks(
 			const packed_sub_track_types* translation_sub_track_types, uint32_t last_entry_index, uint32_t padding_mask,
 			track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::unpack_default_translation_sub_tracks");
+
 			constexpr default_sub_track_mode default_mode = track_writer_type::get_default_translation_mode();
 			static_assert(default_mode != default_sub_track_mode::legacy, "Not supported for translations");
 			if (default_mode == default_sub_track_mode::skipped)
@@ -895,6 +936,7 @@ namespace acl
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
 			{
 				uint32_t packed_entry = translation_sub_track_types[entry_index].types;
+				record_memory_touch<decompression_settings_type>(&translation_sub_track_types[entry_index], sizeof(packed_sub_track_types));
 
 				// Mask out everything but default sub-tracks, this way we can early out when we iterate
 				// Each sub-track is either 0 (default), 1 (constant), or 2 (animated)
@@ -983,16 +1025,19 @@ namespace acl
 		}
 
 		// Force inline this function, we only use it to keep the code readable
-		template<class track_writer_type>
+		template<class decompression_settings_type, class track_writer_type>
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_constant_translation_sub_tracks(
 			const packed_sub_track_types* translation_sub_track_types, uint32_t last_entry_index,
 			constant_track_cache_v0& constant_track_cache, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::unpack_constant_translation_sub_tracks");
+
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
 			{
 				// Mask out everything but constant sub-tracks, this way we can early out when we iterate
 				// Use and_not(..) to load our sub-track types directly from memory on x64 with BMI
 				uint32_t packed_entry = and_not(~0x55555555U, translation_sub_track_types[entry_index].types);
+				record_memory_touch<decompression_settings_type>(&translation_sub_track_types[entry_index], sizeof(packed_sub_track_types));
 
 				uint32_t curr_entry_track_index = track_index;
 
@@ -1019,6 +1064,7 @@ namespace acl
 
 						if (!track_writer_type::skip_all_translations() && !writer.skip_track_translation(track_index0))
 						{
+							record_memory_touch<decompression_settings_type>(translation_ptr, sizeof(rtm::vector4f));
 							const rtm::vector4f translation = rtm::vector_load(translation_ptr);
 							ACL_ASSERT(rtm::vector_is_finite3(translation), "Translation is not valid!");
 
@@ -1033,6 +1079,7 @@ namespace acl
 
 						if (!track_writer_type::skip_all_translations() && !writer.skip_track_translation(track_index1))
 						{
+							record_memory_touch<decompression_settings_type>(translation_ptr, sizeof(rtm::vector4f));
 							const rtm::vector4f translation = rtm::vector_load(translation_ptr);
 							ACL_ASSERT(rtm::vector_is_finite3(translation), "Translation is not valid!");
 
@@ -1047,6 +1094,7 @@ namespace acl
 
 						if (!track_writer_type::skip_all_translations() && !writer.skip_track_translation(track_index2))
 						{
+							record_memory_touch<decompression_settings_type>(translation_ptr, sizeof(rtm::vector4f));
 							const rtm::vector4f translation = rtm::vector_load(translation_ptr);
 							ACL_ASSERT(rtm::vector_is_finite3(translation), "Translation is not valid!");
 
@@ -1061,6 +1109,7 @@ namespace acl
 
 						if (!track_writer_type::skip_all_translations() && !writer.skip_track_translation(track_index3))
 						{
+							record_memory_touch<decompression_settings_type>(translation_ptr, sizeof(rtm::vector4f));
 							const rtm::vector4f translation = rtm::vector_load(translation_ptr);
 							ACL_ASSERT(rtm::vector_is_finite3(translation), "Translation is not valid!");
 
@@ -1078,6 +1127,8 @@ namespace acl
 			const persistent_transform_decompression_context_v0& context,
 			animated_track_cache_v0& animated_track_cache, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::unpack_animated_translation_sub_tracks");
+
 			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
 
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
@@ -1085,6 +1136,7 @@ namespace acl
 				// Mask out everything but animated sub-tracks, this way we can early out when we iterate
 				// Use and_not(..) to load our sub-track types directly from memory on x64 with BMI
 				uint32_t packed_entry = and_not(~0xAAAAAAAAU, translation_sub_track_types[entry_index].types);
+				record_memory_touch<decompression_settings_adapter_type>(&translation_sub_track_types[entry_index], sizeof(packed_sub_track_types));
 
 				uint32_t curr_entry_track_index = track_index;
 
@@ -1199,11 +1251,13 @@ namespace acl
 		}
 
 		// Force inline this function, we only use it to keep the code readable
-		template<class track_writer_type>
+		template<class decompression_settings_type, class track_writer_type>
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_default_scale_sub_tracks(
 			const packed_sub_track_types* scale_sub_track_types, uint32_t last_entry_index, uint32_t padding_mask,
 			rtm::vector4f_arg0 default_scale_, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::unpack_default_scale_sub_tracks");
+
 			constexpr default_sub_track_mode default_mode = track_writer_type::get_default_scale_mode();
 			if (default_mode == default_sub_track_mode::skipped)
 				return;	// Nothing to write
@@ -1220,6 +1274,7 @@ namespace acl
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
 			{
 				uint32_t packed_entry = scale_sub_track_types[entry_index].types;
+				record_memory_touch<decompression_settings_type>(&scale_sub_track_types[entry_index], sizeof(packed_sub_track_types));
 
 				// Mask out everything but default sub-tracks, this way we can early out when we iterate
 				// Each sub-track is either 0 (default), 1 (constant), or 2 (animated)
@@ -1308,16 +1363,19 @@ namespace acl
 		}
 
 		// Force inline this function, we only use it to keep the code readable
-		template<class track_writer_type>
+		template<class decompression_settings_type, class track_writer_type>
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_constant_scale_sub_tracks(
 			const packed_sub_track_types* scale_sub_track_types, uint32_t last_entry_index,
 			constant_track_cache_v0& constant_track_cache, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::unpack_constant_scale_sub_tracks");
+
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
 			{
 				// Mask out everything but constant sub-tracks, this way we can early out when we iterate
 				// Use and_not(..) to load our sub-track types directly from memory on x64 with BMI
 				uint32_t packed_entry = and_not(~0x55555555U, scale_sub_track_types[entry_index].types);
+				record_memory_touch<decompression_settings_type>(&scale_sub_track_types[entry_index], sizeof(packed_sub_track_types));
 
 				uint32_t curr_entry_track_index = track_index;
 
@@ -1344,6 +1402,7 @@ namespace acl
 
 						if (!track_writer_type::skip_all_scales() && !writer.skip_track_scale(track_index0))
 						{
+							record_memory_touch<decompression_settings_type>(scale_ptr, sizeof(rtm::vector4f));
 							const rtm::vector4f scale = rtm::vector_load(scale_ptr);
 							ACL_ASSERT(rtm::vector_is_finite3(scale), "Scale is not valid!");
 
@@ -1358,6 +1417,7 @@ namespace acl
 
 						if (!track_writer_type::skip_all_scales() && !writer.skip_track_scale(track_index1))
 						{
+							record_memory_touch<decompression_settings_type>(scale_ptr, sizeof(rtm::vector4f));
 							const rtm::vector4f scale = rtm::vector_load(scale_ptr);
 							ACL_ASSERT(rtm::vector_is_finite3(scale), "Scale is not valid!");
 
@@ -1372,6 +1432,7 @@ namespace acl
 
 						if (!track_writer_type::skip_all_scales() && !writer.skip_track_scale(track_index2))
 						{
+							record_memory_touch<decompression_settings_type>(scale_ptr, sizeof(rtm::vector4f));
 							const rtm::vector4f scale = rtm::vector_load(scale_ptr);
 							ACL_ASSERT(rtm::vector_is_finite3(scale), "Scale is not valid!");
 
@@ -1386,6 +1447,7 @@ namespace acl
 
 						if (!track_writer_type::skip_all_scales() && !writer.skip_track_scale(track_index3))
 						{
+							record_memory_touch<decompression_settings_type>(scale_ptr, sizeof(rtm::vector4f));
 							const rtm::vector4f scale = rtm::vector_load(scale_ptr);
 							ACL_ASSERT(rtm::vector_is_finite3(scale), "Scale is not valid!");
 
@@ -1403,6 +1465,8 @@ namespace acl
 			const persistent_transform_decompression_context_v0& context,
 			animated_track_cache_v0& animated_track_cache, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::unpack_animated_scale_sub_tracks");
+
 			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
 
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
@@ -1410,6 +1474,7 @@ namespace acl
 				// Mask out everything but animated sub-tracks, this way we can early out when we iterate
 				// Use and_not(..) to load our sub-track types directly from memory on x64 with BMI
 				uint32_t packed_entry = and_not(~0xAAAAAAAAU, scale_sub_track_types[entry_index].types);
+				record_memory_touch<decompression_settings_adapter_type>(&scale_sub_track_types[entry_index], sizeof(packed_sub_track_types));
 
 				uint32_t curr_entry_track_index = track_index;
 
@@ -1526,8 +1591,12 @@ namespace acl
 		template<class decompression_settings_type, class track_writer_type>
 		inline void decompress_tracks_v0(const persistent_transform_decompression_context_v0& context, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::decompress_tracks");
+
 			const compressed_tracks* tracks = context.tracks;
 			const tracks_header& header = get_tracks_header(*tracks);
+			record_memory_touch<decompression_settings_type>(&header, sizeof(tracks_header));
+
 			const uint32_t num_tracks = header.num_tracks;
 			if (num_tracks == 0)
 				return;	// Empty track list
@@ -1548,8 +1617,12 @@ namespace acl
 			const rtm::vector4f default_scale = rtm::vector_set(float(header.get_default_scale()));
 			const uint32_t has_scale = context.has_scale;
 
-			const packed_sub_track_types* sub_track_types = get_transform_tracks_header(*tracks).get_sub_track_types();
+			const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+			record_memory_touch<decompression_settings_type>(&transform_header, sizeof(transform_tracks_header));
+
+			const packed_sub_track_types* sub_track_types = transform_header.get_sub_track_types();
 			const uint32_t num_sub_track_entries = (num_tracks + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry;
+
 			const uint32_t num_padded_sub_tracks = (num_sub_track_entries * k_num_sub_tracks_per_packed_entry) - num_tracks;
 			const uint32_t last_entry_index = num_sub_track_entries - 1;
 
@@ -1572,10 +1645,10 @@ namespace acl
 				// their latency should be fully hidden.
 				// Prefetch our 3rd constant rotation cache line to prime the hardware prefetcher and do the same for constant translations
 
-				ACL_IMPL_SEEK_PREFETCH(constant_track_cache.constant_data_rotations + 128);
-				ACL_IMPL_SEEK_PREFETCH(constant_track_cache.constant_data_translations);
-				ACL_IMPL_SEEK_PREFETCH(constant_track_cache.constant_data_translations + 64);
-				ACL_IMPL_SEEK_PREFETCH(constant_track_cache.constant_data_translations + 128);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, constant_track_cache.constant_data_rotations + 128);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, constant_track_cache.constant_data_translations);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, constant_track_cache.constant_data_translations + 64);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, constant_track_cache.constant_data_translations + 128);
 			}
 
 			animated_track_cache_v0 animated_track_cache;
@@ -1586,8 +1659,8 @@ namespace acl
 				// They might live in a different memory page than the clip's header and constant data
 				// and we need to prime VMEM translation and the TLB
 
-				ACL_IMPL_SEEK_PREFETCH(context.format_per_track_data[0]);
-				ACL_IMPL_SEEK_PREFETCH(context.format_per_track_data[1]);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, context.format_per_track_data[0]);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, context.format_per_track_data[1]);
 			}
 
 			// TODO: The first time we iterate over the sub-track types, unpack it into our output pose as a temporary buffer
@@ -1604,7 +1677,7 @@ namespace acl
 
 			// Unpack our default rotation sub-tracks
 			// Default rotation sub-tracks are uncommon, this shouldn't take much more than 50 cycles
-			unpack_default_rotation_sub_tracks(rotation_sub_track_types, last_entry_index, padding_mask, writer);
+			unpack_default_rotation_sub_tracks<decompression_settings_type>(rotation_sub_track_types, last_entry_index, padding_mask, writer);
 
 			// Unpack our constant rotation sub-tracks
 			// Constant rotation sub-tracks are very common, this should take at least 200 cycles
@@ -1624,31 +1697,31 @@ namespace acl
 				const uint8_t* frame_animated_data0 = animated_data0 + (animated_track_cache.segment_sampling_context_rotations[0].animated_track_data_bit_offset / 8);
 				const uint8_t* frame_animated_data1 = animated_data1 + (animated_track_cache.segment_sampling_context_rotations[1].animated_track_data_bit_offset / 8);
 
-				ACL_IMPL_SEEK_PREFETCH(segment_range_data0);
-				ACL_IMPL_SEEK_PREFETCH(segment_range_data0 + 64);
-				ACL_IMPL_SEEK_PREFETCH(segment_range_data1);
-				ACL_IMPL_SEEK_PREFETCH(segment_range_data1 + 64);
-				ACL_IMPL_SEEK_PREFETCH(frame_animated_data0);
-				ACL_IMPL_SEEK_PREFETCH(frame_animated_data1);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, segment_range_data0);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, segment_range_data0 + 64);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, segment_range_data1);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, segment_range_data1 + 64);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, frame_animated_data0);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, frame_animated_data1);
 			}
 
 			// Unpack our default translation sub-tracks
 			// Default translation sub-tracks are rare, this shouldn't take much more than 50 cycles
-			unpack_default_translation_sub_tracks(translation_sub_track_types, last_entry_index, padding_mask, writer);
+			unpack_default_translation_sub_tracks<decompression_settings_type>(translation_sub_track_types, last_entry_index, padding_mask, writer);
 
 			// Unpack our constant translation sub-tracks
 			// Constant translation sub-tracks are very common, this should take at least 200 cycles
-			unpack_constant_translation_sub_tracks(translation_sub_track_types, last_entry_index, constant_track_cache, writer);
+			unpack_constant_translation_sub_tracks<decompression_settings_type>(translation_sub_track_types, last_entry_index, constant_track_cache, writer);
 
 			if (has_scale)
 			{
 				// Unpack our default scale sub-tracks
 				// Scale sub-tracks are almost always default, this should take at least 200 cycles
-				unpack_default_scale_sub_tracks(scale_sub_track_types, last_entry_index, padding_mask, default_scale, writer);
+				unpack_default_scale_sub_tracks<decompression_settings_type>(scale_sub_track_types, last_entry_index, padding_mask, default_scale, writer);
 
 				// Unpack our constant scale sub-tracks
 				// Constant scale sub-tracks are very rare, this shouldn't take much more than 50 cycles
-				unpack_constant_scale_sub_tracks(scale_sub_track_types, last_entry_index, constant_track_cache, writer);
+				unpack_constant_scale_sub_tracks<decompression_settings_type>(scale_sub_track_types, last_entry_index, constant_track_cache, writer);
 			}
 			else
 			{
@@ -1692,12 +1765,12 @@ namespace acl
 				const uint8_t* frame_animated_data0 = animated_data0 + (animated_track_cache.segment_sampling_context_rotations[0].animated_track_data_bit_offset / 8);
 				const uint8_t* frame_animated_data1 = animated_data1 + (animated_track_cache.segment_sampling_context_rotations[1].animated_track_data_bit_offset / 8);
 
-				ACL_IMPL_SEEK_PREFETCH(per_track_metadata0 + 64);
-				ACL_IMPL_SEEK_PREFETCH(per_track_metadata1 + 64);
-				ACL_IMPL_SEEK_PREFETCH(frame_animated_data0 + 64);
-				ACL_IMPL_SEEK_PREFETCH(frame_animated_data1 + 64);
-				ACL_IMPL_SEEK_PREFETCH(animated_track_cache.clip_sampling_context_rotations.clip_range_data);
-				ACL_IMPL_SEEK_PREFETCH(animated_track_cache.clip_sampling_context_rotations.clip_range_data + 64);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, per_track_metadata0 + 64);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, per_track_metadata1 + 64);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, frame_animated_data0 + 64);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, frame_animated_data1 + 64);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, animated_track_cache.clip_sampling_context_rotations.clip_range_data);
+				ACL_IMPL_SEEK_PREFETCH(decompression_settings_type, animated_track_cache.clip_sampling_context_rotations.clip_range_data + 64);
 
 				// TODO: Can we prefetch the translation data ahead instead to prime the TLB?
 			}
@@ -1732,6 +1805,7 @@ namespace acl
 			if (has_scale)
 				unpack_animated_scale_sub_tracks<scale_adapter>(scale_sub_track_types, last_entry_index, context, animated_track_cache, writer);
 
+
 			if (decompression_settings_type::disable_fp_exeptions())
 				restore_fp_exceptions(fp_env);
 		}
@@ -1753,8 +1827,11 @@ namespace acl
 		template<class decompression_settings_type, class track_writer_type>
 		inline void decompress_track_v0(const persistent_transform_decompression_context_v0& context, uint32_t track_index, track_writer_type& writer)
 		{
+			ACL_PROFILE_SCOPE("acl::decompress_track");
+
 			const compressed_tracks* tracks = context.tracks;
 			const tracks_header& tracks_header_ = get_tracks_header(*tracks);
+			record_memory_touch<decompression_settings_type>(&tracks_header_, sizeof(tracks_header));
 			const uint32_t num_tracks = tracks_header_.num_tracks;
 			if (num_tracks == 0)
 				return;	// Empty track list
@@ -1797,7 +1874,10 @@ namespace acl
 
 			const uint32_t has_scale = context.has_scale;
 
-			const packed_sub_track_types* sub_track_types = get_transform_tracks_header(*tracks).get_sub_track_types();
+			const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+			record_memory_touch<decompression_settings_type>(&transform_header, sizeof(transform_tracks_header));
+
+			const packed_sub_track_types* sub_track_types = transform_header.get_sub_track_types();
 			const uint32_t num_sub_track_entries = (num_tracks + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry;
 
 			const packed_sub_track_types* rotation_sub_track_types = sub_track_types;
@@ -1820,6 +1900,9 @@ namespace acl
 			const uint32_t rotation_sub_track_type = (rotation_sub_track_types[sub_track_entry_index].types >> packed_shift) & 0x3;
 			const uint32_t translation_sub_track_type = (translation_sub_track_types[sub_track_entry_index].types >> packed_shift) & 0x3;
 			const uint32_t scale_sub_track_type = scale_sub_track_mask & (scale_sub_track_types[sub_track_entry_index].types >> packed_shift) & 0x3;
+			record_memory_touch<decompression_settings_type>(&rotation_sub_track_types[sub_track_entry_index], sizeof(packed_sub_track_types));
+			record_memory_touch<decompression_settings_type>(&translation_sub_track_types[sub_track_entry_index], sizeof(packed_sub_track_types));
+			record_memory_touch<decompression_settings_type>(&scale_sub_track_types[sub_track_entry_index], sizeof(packed_sub_track_types));
 
 			// Combine all three so we can quickly test if all are default and if any are constant/animated
 			const uint32_t combined_sub_track_type = rotation_sub_track_type | translation_sub_track_type | scale_sub_track_type;
@@ -1870,6 +1953,12 @@ namespace acl
 			// Sub-tracks that are kept have their bits set to 0 to mask them with logical ANDNOT later
 			const uint32_t padding_mask = num_padded_sub_tracks != 0 ? (0xFFFFFFFF >> ((k_num_sub_tracks_per_packed_entry - num_padded_sub_tracks) * 2)) : 0x00000000;
 
+			// We read every entry before ours for each sub-track type, ours was recorded above
+			record_memory_touch<decompression_settings_type>(rotation_sub_track_types, sizeof(packed_sub_track_types) * last_entry_index);
+			record_memory_touch<decompression_settings_type>(translation_sub_track_types, sizeof(packed_sub_track_types) * last_entry_index);
+			if (has_scale)
+				record_memory_touch<decompression_settings_type>(scale_sub_track_types, sizeof(packed_sub_track_types) * last_entry_index);
+
 			for (uint32_t sub_track_entry_index_ = 0; sub_track_entry_index_ <= last_entry_index; ++sub_track_entry_index_)
 			{
 				// Our last entry might contain more information than we need so we strip the padding we don't need
@@ -1921,7 +2010,7 @@ namespace acl
 
 					const uint32_t num_translation_constant_groups_to_skip = num_constant_translations / 4;
 					if (num_translation_constant_groups_to_skip != 0)
-						constant_track_cache.skip_translation_groups(num_translation_constant_groups_to_skip);
+						constant_track_cache.skip_translation_groups<decompression_settings_type>(num_translation_constant_groups_to_skip);
 				}
 
 				if (scale_sub_track_type & 1)
@@ -1930,7 +2019,7 @@ namespace acl
 
 					const uint32_t num_scale_constant_groups_to_skip = num_constant_scales / 4;
 					if (num_scale_constant_groups_to_skip != 0)
-						constant_track_cache.skip_scale_groups(num_scale_constant_groups_to_skip);
+						constant_track_cache.skip_scale_groups<decompression_settings_type>(num_scale_constant_groups_to_skip);
 				}
 			}
 
@@ -2017,7 +2106,7 @@ namespace acl
 			{
 				rtm::vector4f translation;
 				if (translation_sub_track_type & 1)
-					translation = constant_track_cache.unpack_translation_within_group(translation_group_sample_index);
+					translation = constant_track_cache.unpack_translation_within_group<decompression_settings_type>(translation_group_sample_index);
 				else
 					translation = animated_track_cache.unpack_translation_within_group<translation_adapter>(context, translation_group_sample_index, interpolation_alpha);
 
@@ -2038,7 +2127,7 @@ namespace acl
 			{
 				rtm::vector4f scale;
 				if (scale_sub_track_type & 1)
-					scale = constant_track_cache.unpack_scale_within_group(scale_group_sample_index);
+					scale = constant_track_cache.unpack_scale_within_group<decompression_settings_type>(scale_group_sample_index);
 				else
 					scale = animated_track_cache.unpack_scale_within_group<scale_adapter>(context, scale_group_sample_index, interpolation_alpha);
 
@@ -74,6 +74,12 @@ namespace acl
 				case track_type8::float3f:
 				case track_type8::float4f:
 				case track_type8::vector4f:
+				case track_type8::quatf:
+				case track_type8::float1d:
+				case track_type8::float2d:
+				case track_type8::float3d:
+				case track_type8::float4d:
+				case track_type8::vector4d:
 					return static_cast<sample_looping_policy>(scalar.looping_policy);
 				case track_type8::qvvf:
 					return static_cast<sample_looping_policy>(transform.looping_policy);
@@ -101,6 +107,12 @@ namespace acl
 			case track_type8::float3f:
 			case track_type8::float4f:
 			case track_type8::vector4f:
+			case track_type8::quatf:
+			case track_type8::float1d:
+			case track_type8::float2d:
+			case track_type8::float3d:
+			case track_type8::float4d:
+			case track_type8::vector4d:
 				return initialize_v0<decompression_settings_type>(context.scalar, tracks, database);
 			case track_type8::qvvf:
 				return initialize_v0<decompression_settings_type>(context.transform, tracks, database);
@@ -121,6 +133,12 @@ namespace acl
 			case track_type8::float3f:
 			case track_type8::float4f:
 			case track_type8::vector4f:
+			case track_type8::quatf:
+			case track_type8::float1d:
+			case track_type8::float2d:
+			case track_type8::float3d:
+			case track_type8::float4d:
+			case track_type8::vector4d:
 				return relocated_v0<decompression_settings_type>(context.scalar, tracks, database);
 			case track_type8::qvvf:
 				return relocated_v0<decompression_settings_type>(context.transform, tracks, database);
@@ -143,6 +161,12 @@ namespace acl
 			case track_type8::float3f:
 			case track_type8::float4f:
 			case track_type8::vector4f:
+			case track_type8::quatf:
+			case track_type8::float1d:
+			case track_type8::float2d:
+			case track_type8::float3d:
+			case track_type8::float4d:
+			case track_type8::vector4d:
 				return is_bound_to_v0(context.scalar, tracks);
 			case track_type8::qvvf:
 				return is_bound_to_v0(context.transform, tracks);
@@ -162,6 +186,12 @@ namespace acl
 			case track_type8::float3f:
 			case track_type8::float4f:
 			case track_type8::vector4f:
+			case track_type8::quatf:
+			case track_type8::float1d:
+			case track_type8::float2d:
+			case track_type8::float3d:
+			case track_type8::float4d:
+			case track_type8::vector4d:
 				return is_bound_to_v0(context.scalar, database);
 			case track_type8::qvvf:
 				return is_bound_to_v0(context.transform, database);
@@ -182,6 +212,12 @@ namespace acl
 			case track_type8::float3f:
 			case track_type8::float4f:
 			case track_type8::vector4f:
+			case track_type8::quatf:
+			case track_type8::float1d:
+			case track_type8::float2d:
+			case track_type8::float3d:
+			case track_type8::float4d:
+			case track_type8::vector4d:
 				set_looping_policy_v0<decompression_settings_type>(context.scalar, policy);
 				break;
 			case track_type8::qvvf:
@@ -206,6 +242,12 @@ namespace acl
 			case track_type8::float3f:
 			case track_type8::float4f:
 			case track_type8::vector4f:
+			case track_type8::quatf:
+			case track_type8::float1d:
+			case track_type8::float2d:
+			case track_type8::float3d:
+			case track_type8::float4d:
+			case track_type8::vector4d:
 				seek_v0<decompression_settings_type>(context.scalar, sample_time, rounding_policy);
 				break;
 			case track_type8::qvvf:
@@ -230,6 +272,12 @@ namespace acl
 			case track_type8::float3f:
 			case track_type8::float4f:
 			case track_type8::vector4f:
+			case track_type8::quatf:
+			case track_type8::float1d:
+			case track_type8::float2d:
+			case track_type8::float3d:
+			case track_type8::float4d:
+			case track_type8::vector4d:
 				decompress_tracks_v0<decompression_settings_type>(context.scalar, writer);
 				break;
 			case track_type8::qvvf:
@@ -254,6 +302,12 @@ namespace acl
 			case track_type8::float3f:
 			case track_type8::float4f:
 			case track_type8::vector4f:
+			case track_type8::quatf:
+			case track_type8::float1d:
+			case track_type8::float2d:
+			case track_type8::float3d:
+			case track_type8::float4d:
+			case track_type8::vector4d:
 				decompress_track_v0<decompression_settings_type>(context.scalar, track_index, writer);
 				break;
 			case track_type8::qvvf:
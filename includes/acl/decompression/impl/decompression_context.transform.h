@@ -128,6 +128,7 @@ namespace acl
 			static constexpr bool is_vector_format_supported(vector_format8 format) { return decompression_settings_type::is_translation_format_supported(format); }
 			static constexpr bool is_per_track_rounding_supported() { return decompression_settings_type::is_per_track_rounding_supported(); }
 			static constexpr compressed_tracks_version16 version_supported() { return decompression_settings_type::version_supported(); }
+			static constexpr bool is_memory_touch_tracking_enabled() { return decompression_settings_type::is_memory_touch_tracking_enabled(); }
 		};
 
 		template<class decompression_settings_type>
@@ -139,6 +140,7 @@ namespace acl
 			static constexpr bool is_vector_format_supported(vector_format8 format) { return decompression_settings_type::is_scale_format_supported(format); }
 			static constexpr bool is_per_track_rounding_supported() { return decompression_settings_type::is_per_track_rounding_supported(); }
 			static constexpr compressed_tracks_version16 version_supported() { return decompression_settings_type::version_supported(); }
+			static constexpr bool is_memory_touch_tracking_enabled() { return decompression_settings_type::is_memory_touch_tracking_enabled(); }
 		};
 
 		// Returns the statically known number of rotation formats supported by the decompression settings
@@ -108,6 +108,14 @@ namespace acl
 			: decompression_version_selector_v0<compressed_tracks_version16::v02_01_00>
 		{};
 
+		//////////////////////////////////////////////////////////////////////////
+		// Optimized for ACL 2.2.0
+		//////////////////////////////////////////////////////////////////////////
+		template<>
+		struct decompression_version_selector<compressed_tracks_version16::v02_02_99>
+			: decompression_version_selector_v0<compressed_tracks_version16::v02_02_99>
+		{};
+
 		//////////////////////////////////////////////////////////////////////////
 		// Not optimized for any particular version.
 		//////////////////////////////////////////////////////////////////////////
@@ -130,6 +138,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_00:
+				case compressed_tracks_version16::v02_02_99:
 					return acl_impl::initialize_v0<decompression_settings_type>(context, tracks, database);
 				case compressed_tracks_version16::none:
 				case compressed_tracks_version16::any:
@@ -149,6 +158,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_00:
+				case compressed_tracks_version16::v02_02_99:
 					return acl_impl::relocated_v0<decompression_settings_type>(context, tracks, database);
 				case compressed_tracks_version16::none:
 				case compressed_tracks_version16::any:
@@ -168,6 +178,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_00:
+				case compressed_tracks_version16::v02_02_99:
 					return acl_impl::is_bound_to_v0(context, tracks);
 				case compressed_tracks_version16::none:
 				case compressed_tracks_version16::any:
@@ -187,6 +198,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_00:
+				case compressed_tracks_version16::v02_02_99:
 					return acl_impl::is_bound_to_v0(context, database);
 				case compressed_tracks_version16::none:
 				case compressed_tracks_version16::any:
@@ -206,6 +218,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_00:
+				case compressed_tracks_version16::v02_02_99:
 					acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy);
 					break;
 				case compressed_tracks_version16::none:
@@ -226,6 +239,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_00:
+				case compressed_tracks_version16::v02_02_99:
 					acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy);
 					break;
 				case compressed_tracks_version16::none:
@@ -246,6 +260,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_00:
+				case compressed_tracks_version16::v02_02_99:
 					acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer);
 					break;
 				case compressed_tracks_version16::none:
@@ -266,6 +281,7 @@ namespace acl
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
 				case compressed_tracks_version16::v02_01_00:
+				case compressed_tracks_version16::v02_02_99:
 					acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer);
 					break;
 				case compressed_tracks_version16::none:
@@ -0,0 +1,84 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#if defined(ACL_USE_MEMORY_TOUCH_RECORDER)
+	#include "acl/decompression/memory_touch_recorder.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// Reports a load to the active recorder, stripped at compile time unless our settings enable it
+		// and ACL_USE_MEMORY_TOUCH_RECORDER is defined
+		template<class decompression_settings_type>
+		inline void record_memory_touch(const void* ptr, size_t size)
+		{
+#if defined(ACL_USE_MEMORY_TOUCH_RECORDER)
+			if (decompression_settings_type::is_memory_touch_tracking_enabled())
+			{
+				memory_touch_recorder* recorder = memory_touch_recorder::get_active();
+				if (recorder != nullptr)
+					recorder->record(ptr, size);
+			}
+#else
+			(void)ptr;
+			(void)size;
+#endif
+		}
+
+		// Reports a prefetch to the active recorder, stripped at compile time unless our settings enable it
+		// and ACL_USE_MEMORY_TOUCH_RECORDER is defined
+		template<class decompression_settings_type>
+		inline void record_memory_prefetch(const void* ptr)
+		{
+#if defined(ACL_USE_MEMORY_TOUCH_RECORDER)
+			if (decompression_settings_type::is_memory_touch_tracking_enabled())
+			{
+				memory_touch_recorder* recorder = memory_touch_recorder::get_active();
+				if (recorder != nullptr)
+					recorder->record_prefetch(ptr);
+			}
+#else
+			(void)ptr;
+#endif
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,288 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/bit_cast.impl.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Memory touched by the loads recorded by a 'memory_touch_recorder'.
+	//////////////////////////////////////////////////////////////////////////
+	struct memory_touch_stats
+	{
+		// The number of loads recorded
+		uint32_t num_loads = 0;
+
+		// The number of bytes loaded, a byte loaded more than once is counted every time
+		uint32_t num_loaded_bytes = 0;
+
+		// The number of prefetches recorded
+		uint32_t num_prefetches = 0;
+
+		// The number of unique cache lines touched, including the ones prefetched
+		uint32_t num_touched_cache_lines = 0;
+
+		// The number of unique memory pages touched
+		uint32_t num_touched_pages = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Records the memory loaded from the compressed tracks (and their database) when
+	// we seek and decompress. Unlike the estimates reported in the compression stats,
+	// these are the actual loads made for a specific sample time.
+	//
+	// Only decompression contexts that use settings where 'is_memory_touch_tracking_enabled()'
+	// is true report their loads (e.g. 'instrumented_transform_decompression_settings').
+	// Reporting is compiled out unless ACL_USE_MEMORY_TOUCH_RECORDER is defined, it must be
+	// defined consistently in every translation unit that includes the decompression headers.
+	// Loads are reported to the recorder made active on the calling thread with
+	// 'scope_memory_touch_recorder':
+	//
+	//    memory_touch_recorder recorder(allocator);
+	//    {
+	//        scope_memory_touch_recorder recording(recorder);
+	//        context.seek(sample_time, sample_rounding_policy::none);
+	//        context.decompress_tracks(writer);
+	//    }
+	//    const memory_touch_stats stats = recorder.get_stats();
+	//
+	// Each load records the bytes actually read by the unpacking functions for the current
+	// platform, including wide SIMD loads that read past the data they consume. Prefetches
+	// record the cache line they fetch. Both 'decompress_tracks' and 'decompress_track' are
+	// covered.
+	//
+	// Unique cache lines and pages are tracked with hash sets that grow as needed with
+	// the provided allocator. This is slow and only meant for debugging and to validate
+	// changes to the memory layout. Only transform tracks are supported, scalar tracks
+	// do not report their loads.
+	//////////////////////////////////////////////////////////////////////////
+	class memory_touch_recorder
+	{
+	public:
+		static constexpr size_t k_cache_line_size = 64;
+		static constexpr size_t k_page_size = 4096;
+
+		explicit memory_touch_recorder(iallocator& allocator)
+			: m_allocator(allocator)
+			, m_stats()
+			, m_cache_lines()
+			, m_pages()
+		{}
+
+		~memory_touch_recorder()
+		{
+			deallocate_type_array(m_allocator, m_cache_lines.entries, m_cache_lines.capacity);
+			deallocate_type_array(m_allocator, m_pages.entries, m_pages.capacity);
+		}
+
+		memory_touch_recorder(const memory_touch_recorder&) = delete;
+		memory_touch_recorder& operator=(const memory_touch_recorder&) = delete;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Forgets every load recorded so far, typically before we seek again.
+		void reset()
+		{
+			m_stats = memory_touch_stats();
+			m_cache_lines.clear();
+			m_pages.clear();
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Records a load of 'size' bytes starting at 'ptr'.
+		void record(const void* ptr, size_t size)
+		{
+			if (size == 0)
+				return;
+
+			m_stats.num_loads++;
+			m_stats.num_loaded_bytes += uint32_t(size);
+
+			const uintptr_t first_address = acl_impl::bit_cast<uintptr_t>(ptr);
+			const uintptr_t last_address = first_address + size - 1;
+
+			for (uintptr_t cache_line = first_address / k_cache_line_size; cache_line <= last_address / k_cache_line_size; ++cache_line)
+				insert(m_cache_lines, cache_line);
+
+			for (uintptr_t page = first_address / k_page_size; page <= last_address / k_page_size; ++page)
+				insert(m_pages, page);
+
+			m_stats.num_touched_cache_lines = m_cache_lines.size;
+			m_stats.num_touched_pages = m_pages.size;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Records a load of 'num_bits' bits starting at 'bit_offset' from 'ptr'.
+		void record_bits(const uint8_t* ptr, uint32_t bit_offset, uint32_t num_bits)
+		{
+			if (num_bits == 0)
+				return;
+
+			const uint32_t first_byte = bit_offset / 8;
+			const uint32_t last_byte = (bit_offset + num_bits - 1) / 8;
+			record(ptr + first_byte, size_t(last_byte - first_byte) + 1);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Records a prefetch of the cache line that contains 'ptr'.
+		void record_prefetch(const void* ptr)
+		{
+			m_stats.num_prefetches++;
+
+			const uintptr_t address = acl_impl::bit_cast<uintptr_t>(ptr);
+			insert(m_cache_lines, address / k_cache_line_size);
+			insert(m_pages, address / k_page_size);
+
+			m_stats.num_touched_cache_lines = m_cache_lines.size;
+			m_stats.num_touched_pages = m_pages.size;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the memory touched by every load recorded since we were created or reset.
+		const memory_touch_stats& get_stats() const { return m_stats; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the recorder active on the calling thread or nullptr if there is none.
+		static memory_touch_recorder* get_active() { return get_active_recorder(); }
+
+	private:
+		struct unique_set
+		{
+			uintptr_t*	entries = nullptr;
+			uint32_t	capacity = 0;
+			uint32_t	size = 0;
+
+			void clear()
+			{
+				for (uint32_t entry_index = 0; entry_index < capacity; ++entry_index)
+					entries[entry_index] = k_empty_entry;
+
+				size = 0;
+			}
+		};
+
+		// Addresses are divided by the cache line or page size, this value can never be used
+		static constexpr uintptr_t k_empty_entry = ~uintptr_t(0);
+
+		static memory_touch_recorder*& get_active_recorder()
+		{
+			static thread_local memory_touch_recorder* active_recorder = nullptr;
+			return active_recorder;
+		}
+
+		static uint32_t find_slot(const unique_set& set, uintptr_t value)
+		{
+			// Fibonacci hashing to spread consecutive addresses, the capacity is a power of two
+			const uint64_t hash = uint64_t(value) * 0x9E3779B97F4A7C15ULL;
+			uint32_t slot_index = uint32_t(hash >> 32) & (set.capacity - 1);
+
+			while (set.entries[slot_index] != k_empty_entry && set.entries[slot_index] != value)
+				slot_index = (slot_index + 1) & (set.capacity - 1);
+
+			return slot_index;
+		}
+
+		void insert(unique_set& set, uintptr_t value)
+		{
+			// Keep the load factor at or below 50%
+			if ((set.size + 1) * 2 > set.capacity)
+				grow(set);
+
+			const uint32_t slot_index = find_slot(set, value);
+			if (set.entries[slot_index] == k_empty_entry)
+			{
+				set.entries[slot_index] = value;
+				set.size++;
+			}
+		}
+
+		void grow(unique_set& set)
+		{
+			unique_set new_set;
+			new_set.capacity = set.capacity != 0 ? (set.capacity * 2) : 256;
+			new_set.entries = allocate_type_array<uintptr_t>(m_allocator, new_set.capacity);
+			new_set.clear();
+
+			for (uint32_t entry_index = 0; entry_index < set.capacity; ++entry_index)
+			{
+				const uintptr_t value = set.entries[entry_index];
+				if (value != k_empty_entry)
+				{
+					new_set.entries[find_slot(new_set, value)] = value;
+					new_set.size++;
+				}
+			}
+
+			deallocate_type_array(m_allocator, set.entries, set.capacity);
+			set = new_set;
+		}
+
+		iallocator&				m_allocator;
+		memory_touch_stats		m_stats;
+		unique_set				m_cache_lines;
+		unique_set				m_pages;
+
+		friend class scope_memory_touch_recorder;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Makes a recorder active on the calling thread for the lifetime of this instance.
+	// The previously active recorder is restored when we go out of scope.
+	//////////////////////////////////////////////////////////////////////////
+	class scope_memory_touch_recorder
+	{
+	public:
+		explicit scope_memory_touch_recorder(memory_touch_recorder& recorder)
+			: m_previous_recorder(memory_touch_recorder::get_active_recorder())
+		{
+			memory_touch_recorder::get_active_recorder() = &recorder;
+		}
+
+		~scope_memory_touch_recorder()
+		{
+			memory_touch_recorder::get_active_recorder() = m_previous_recorder;
+		}
+
+		scope_memory_touch_recorder(const scope_memory_touch_recorder&) = delete;
+		scope_memory_touch_recorder& operator=(const scope_memory_touch_recorder&) = delete;
+
+	private:
+		memory_touch_recorder*	m_previous_recorder;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
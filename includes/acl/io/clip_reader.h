@@ -905,6 +905,12 @@ namespace acl
 					rtm::float3f*	float3f;
 					rtm::float4f*	float4f;
 					rtm::vector4f*	vector4f;
+					rtm::quatf*		quatf;
+					double*			float1d;
+					rtm::float2d*	float2d;
+					rtm::float3d*	float3d;
+					rtm::float4d*	float4d;
+					rtm::vector4d*	vector4d;
 					rtm::qvvf*		qvvf;
 				};
 				track_samples_ptr_union track_samples_typed = { nullptr };
@@ -926,6 +932,24 @@ namespace acl
 				case track_type8::vector4f:
 					track_samples_typed.vector4f = allocate_type_array<rtm::vector4f>(m_allocator, m_num_samples);
 					break;
+				case track_type8::quatf:
+					track_samples_typed.quatf = allocate_type_array<rtm::quatf>(m_allocator, m_num_samples);
+					break;
+				case track_type8::float1d:
+					track_samples_typed.float1d = allocate_type_array<double>(m_allocator, m_num_samples);
+					break;
+				case track_type8::float2d:
+					track_samples_typed.float2d = allocate_type_array<rtm::float2d>(m_allocator, m_num_samples);
+					break;
+				case track_type8::float3d:
+					track_samples_typed.float3d = allocate_type_array<rtm::float3d>(m_allocator, m_num_samples);
+					break;
+				case track_type8::float4d:
+					track_samples_typed.float4d = allocate_type_array<rtm::float4d>(m_allocator, m_num_samples);
+					break;
+				case track_type8::vector4d:
+					track_samples_typed.vector4d = allocate_type_array<rtm::vector4d>(m_allocator, m_num_samples);
+					break;
 				case track_type8::qvvf:
 					track_samples_typed.qvvf = allocate_type_array<rtm::qvvf>(m_allocator, m_num_samples);
 					break;
@@ -955,6 +979,7 @@ namespace acl
 						case track_type8::float3f:
 						case track_type8::float4f:
 						case track_type8::vector4f:
+						case track_type8::quatf:
 						{
 							sjson::StringView values[4];
 							if (m_parser.read(values, num_components))
@@ -966,6 +991,23 @@ namespace acl
 								has_error = true;
 							break;
 						}
+						case track_type8::float1d:
+						case track_type8::float2d:
+						case track_type8::float3d:
+						case track_type8::float4d:
+						case track_type8::vector4d:
+						{
+							sjson::StringView values[4];
+							if (m_parser.read(values, num_components))
+							{
+								double* sample_values = track_samples_typed.float1d + (size_t(sample_index) * num_components);
+								for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+									sample_values[component_index] = hex_to_double(values[component_index]);
+							}
+							else
+								has_error = true;
+							break;
+						}
 						case track_type8::qvvf:
 						{
 							rtm::qvvf sample;
@@ -992,6 +1034,7 @@ namespace acl
 						case track_type8::float3f:
 						case track_type8::float4f:
 						case track_type8::vector4f:
+						case track_type8::quatf:
 						{
 							double values[4] = { 0.0, 0.0, 0.0, 0.0 };
 							if (m_parser.read(values, num_components))
@@ -1003,6 +1046,19 @@ namespace acl
 								has_error = true;
 							break;
 						}
+						case track_type8::float1d:
+						case track_type8::float2d:
+						case track_type8::float3d:
+						case track_type8::float4d:
+						case track_type8::vector4d:
+						{
+							double values[4] = { 0.0, 0.0, 0.0, 0.0 };
+							if (m_parser.read(values, num_components))
+								std::memcpy(track_samples_typed.float1d + (size_t(sample_index) * num_components), &values[0], sizeof(double) * num_components);
+							else
+								has_error = true;
+							break;
+						}
 						case track_type8::qvvf:
 						{
 							rtm::qvvf sample;
@@ -1053,6 +1109,24 @@ namespace acl
 					case track_type8::vector4f:
 						deallocate_type_array<rtm::vector4f>(m_allocator, track_samples_typed.vector4f, m_num_samples);
 						break;
+					case track_type8::quatf:
+						deallocate_type_array<rtm::quatf>(m_allocator, track_samples_typed.quatf, m_num_samples);
+						break;
+					case track_type8::float1d:
+						deallocate_type_array<double>(m_allocator, track_samples_typed.float1d, m_num_samples);
+						break;
+					case track_type8::float2d:
+						deallocate_type_array<rtm::float2d>(m_allocator, track_samples_typed.float2d, m_num_samples);
+						break;
+					case track_type8::float3d:
+						deallocate_type_array<rtm::float3d>(m_allocator, track_samples_typed.float3d, m_num_samples);
+						break;
+					case track_type8::float4d:
+						deallocate_type_array<rtm::float4d>(m_allocator, track_samples_typed.float4d, m_num_samples);
+						break;
+					case track_type8::vector4d:
+						deallocate_type_array<rtm::vector4d>(m_allocator, track_samples_typed.vector4d, m_num_samples);
+						break;
 					case track_type8::qvvf:
 						deallocate_type_array<rtm::qvvf>(m_allocator, track_samples_typed.qvvf, m_num_samples);
 						break;
@@ -1082,6 +1156,24 @@ namespace acl
 					case track_type8::vector4f:
 						track_ = track_vector4f::make_owner(scalar_desc, m_allocator, track_samples_typed.vector4f, m_num_samples, m_sample_rate);
 						break;
+					case track_type8::quatf:
+						track_ = track_quatf::make_owner(scalar_desc, m_allocator, track_samples_typed.quatf, m_num_samples, m_sample_rate);
+						break;
+					case track_type8::float1d:
+						track_ = track_float1d::make_owner(scalar_desc, m_allocator, track_samples_typed.float1d, m_num_samples, m_sample_rate);
+						break;
+					case track_type8::float2d:
+						track_ = track_float2d::make_owner(scalar_desc, m_allocator, track_samples_typed.float2d, m_num_samples, m_sample_rate);
+						break;
+					case track_type8::float3d:
+						track_ = track_float3d::make_owner(scalar_desc, m_allocator, track_samples_typed.float3d, m_num_samples, m_sample_rate);
+						break;
+					case track_type8::float4d:
+						track_ = track_float4d::make_owner(scalar_desc, m_allocator, track_samples_typed.float4d, m_num_samples, m_sample_rate);
+						break;
+					case track_type8::vector4d:
+						track_ = track_vector4d::make_owner(scalar_desc, m_allocator, track_samples_typed.vector4d, m_num_samples, m_sample_rate);
+						break;
 					case track_type8::qvvf:
 						track_ = track_qvvf::make_owner(transform_desc, m_allocator, track_samples_typed.qvvf, m_num_samples, m_sample_rate);
 						break;
@@ -35,6 +35,7 @@
 #include "acl/core/track_desc.h"
 
 #include <rtm/quatd.h>
+#include <rtm/quatf.h>
 #include <rtm/vector4d.h>
 
 #include <sjson/writer.h>
@@ -66,6 +67,21 @@ namespace acl
 			return buffer;
 		};
 
+		inline const char* format_hex_double(double value, char* buffer, size_t buffer_size)
+		{
+			union DoubleToUInt64
+			{
+				uint64_t u64;
+				double dbl;
+
+				constexpr explicit DoubleToUInt64(double dbl_value) : dbl(dbl_value) {}
+			};
+
+			snprintf(buffer, buffer_size, "%" PRIX64, DoubleToUInt64(value).u64);
+
+			return buffer;
+		};
+
 		inline void write_sjson_settings(const compression_settings& settings, sjson::Writer& writer)
 		{
 			writer["settings"] = [&](sjson::ObjectWriter& settings_writer)
@@ -285,6 +301,156 @@ namespace acl
 								};
 								break;
 							}
+							case track_type8::quatf:
+							{
+								const track_quatf& track__ = track_cast<track_quatf>(track_);
+								write_sjson_scalar_desc(track__.get_description(), track_writer);
+
+								track_writer["data"] = [&](sjson::ArrayWriter& data_writer)
+								{
+									const uint32_t num_samples = track__.get_num_samples();
+									if (num_samples > 0)
+										data_writer.push_newline();
+
+									for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+									{
+										data_writer.push([&](sjson::ArrayWriter& sample_writer)
+											{
+												const rtm::quatf& sample = track__[sample_index];
+												sample_writer.push(acl_impl::format_hex_float(rtm::quat_get_x(sample), buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_float(rtm::quat_get_y(sample), buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_float(rtm::quat_get_z(sample), buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_float(rtm::quat_get_w(sample), buffer, sizeof(buffer)));
+											});
+										data_writer.push_newline();
+									}
+								};
+								break;
+							}
+							case track_type8::float1d:
+							{
+								const track_float1d& track__ = track_cast<track_float1d>(track_);
+								write_sjson_scalar_desc(track__.get_description(), track_writer);
+
+								track_writer["data"] = [&](sjson::ArrayWriter& data_writer)
+								{
+									const uint32_t num_samples = track__.get_num_samples();
+									if (num_samples > 0)
+										data_writer.push_newline();
+
+									for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+									{
+										data_writer.push([&](sjson::ArrayWriter& sample_writer)
+											{
+												const double sample = track__[sample_index];
+												sample_writer.push(acl_impl::format_hex_double(sample, buffer, sizeof(buffer)));
+											});
+										data_writer.push_newline();
+									}
+								};
+								break;
+							}
+							case track_type8::float2d:
+							{
+								const track_float2d& track__ = track_cast<track_float2d>(track_);
+								write_sjson_scalar_desc(track__.get_description(), track_writer);
+
+								track_writer["data"] = [&](sjson::ArrayWriter& data_writer)
+								{
+									const uint32_t num_samples = track__.get_num_samples();
+									if (num_samples > 0)
+										data_writer.push_newline();
+
+									for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+									{
+										data_writer.push([&](sjson::ArrayWriter& sample_writer)
+											{
+												const rtm::float2d& sample = track__[sample_index];
+												sample_writer.push(acl_impl::format_hex_double(sample.x, buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_double(sample.y, buffer, sizeof(buffer)));
+											});
+										data_writer.push_newline();
+									}
+								};
+								break;
+							}
+							case track_type8::float3d:
+							{
+								const track_float3d& track__ = track_cast<track_float3d>(track_);
+								write_sjson_scalar_desc(track__.get_description(), track_writer);
+
+								track_writer["data"] = [&](sjson::ArrayWriter& data_writer)
+								{
+									const uint32_t num_samples = track__.get_num_samples();
+									if (num_samples > 0)
+										data_writer.push_newline();
+
+									for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+									{
+										data_writer.push([&](sjson::ArrayWriter& sample_writer)
+											{
+												const rtm::float3d& sample = track__[sample_index];
+												sample_writer.push(acl_impl::format_hex_double(sample.x, buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_double(sample.y, buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_double(sample.z, buffer, sizeof(buffer)));
+											});
+										data_writer.push_newline();
+									}
+								};
+								break;
+							}
+							case track_type8::float4d:
+							{
+								const track_float4d& track__ = track_cast<track_float4d>(track_);
+								write_sjson_scalar_desc(track__.get_description(), track_writer);
+
+								track_writer["data"] = [&](sjson::ArrayWriter& data_writer)
+								{
+									const uint32_t num_samples = track__.get_num_samples();
+									if (num_samples > 0)
+										data_writer.push_newline();
+
+									for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+									{
+										data_writer.push([&](sjson::ArrayWriter& sample_writer)
+											{
+												const rtm::float4d& sample = track__[sample_index];
+												sample_writer.push(acl_impl::format_hex_double(sample.x, buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_double(sample.y, buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_double(sample.z, buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_double(sample.w, buffer, sizeof(buffer)));
+											});
+										data_writer.push_newline();
+									}
+								};
+								break;
+							}
+							case track_type8::vector4d:
+							{
+								const track_vector4d& track__ = track_cast<track_vector4d>(track_);
+								write_sjson_scalar_desc(track__.get_description(), track_writer);
+
+								track_writer["data"] = [&](sjson::ArrayWriter& data_writer)
+								{
+									const uint32_t num_samples = track__.get_num_samples();
+									if (num_samples > 0)
+										data_writer.push_newline();
+
+									for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+									{
+										data_writer.push([&](sjson::ArrayWriter& sample_writer)
+											{
+												const rtm::vector4d& sample = track__[sample_index];
+												sample_writer.push(acl_impl::format_hex_double(rtm::vector_get_x(sample), buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_double(rtm::vector_get_y(sample), buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_double(rtm::vector_get_z(sample), buffer, sizeof(buffer)));
+												sample_writer.push(acl_impl::format_hex_double(rtm::vector_get_w(sample), buffer, sizeof(buffer)));
+											});
+										data_writer.push_newline();
+									}
+								};
+								break;
+							}
 							case track_type8::qvvf:
 							{
 								const track_qvvf& track__ = track_cast<track_qvvf>(track_);
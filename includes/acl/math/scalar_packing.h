@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/bit_manip_utils.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/error.h"
 #include "acl/core/memory_utils.h"
@@ -137,7 +138,6 @@ namespace acl
 
 #if defined(RTM_SSE2_INTRINSICS)
 		const uint32_t bit_shift = 32 - num_bits;
-		const uint32_t mask = k_packed_constants[num_bits].mask;
 		const __m128 inv_max_value = _mm_load_ps1(&k_packed_constants[num_bits].max_value);
 
 		uint32_t byte_offset = bit_offset / 8;
@@ -145,7 +145,14 @@ namespace acl
 		vector_u32 = byte_swap(vector_u32);
 		const uint32_t x32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
 
-		const __m128 value = _mm_cvtsi32_ss(inv_max_value, static_cast<int32_t>(x32 & mask));
+#if defined(ACL_BMI2_INTRINSICS)
+		// BZHI masks our value without loading the mask from our table
+		const uint32_t value_u32 = zero_high_bits(x32, num_bits);
+#else
+		const uint32_t value_u32 = x32 & k_packed_constants[num_bits].mask;
+#endif
+
+		const __m128 value = _mm_cvtsi32_ss(inv_max_value, static_cast<int32_t>(value_u32));
 		return rtm::scalarf{ _mm_mul_ss(value, inv_max_value) };
 #elif defined(RTM_NEON_INTRINSICS)
 		const uint32_t bit_shift = 32 - num_bits;
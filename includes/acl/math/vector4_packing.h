@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/bit_manip_utils.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/error.h"
 #include "acl/core/memory_utils.h"
@@ -163,6 +164,9 @@ namespace acl
 #endif
 	}
 
+	// Returns the number of bytes read by 'unpack_vector4_128_unsafe' starting at 'vector_data + (bit_offset / 8)'
+	constexpr uint32_t get_unpack_vector4_128_load_size() { return 20; }
+
 	inline void RTM_SIMD_CALL pack_vector4_64(rtm::vector4f_arg0 vector, bool is_unsigned, uint8_t* out_vector_data)
 	{
 		uint32_t vector_x = is_unsigned ? pack_scalar_unsigned(rtm::vector_get_x(vector), 16) : pack_scalar_signed(rtm::vector_get_x(vector), 16);
@@ -598,6 +602,9 @@ namespace acl
 #endif
 	}
 
+	// Returns the number of bytes read by 'unpack_vector3_96_unsafe' starting at 'vector_data + (bit_offset / 8)'
+	constexpr uint32_t get_unpack_vector3_96_load_size() { return 16; }
+
 	// Assumes the 'out_vector_data' is padded in order to write up to 16 bytes to it
 	inline void RTM_SIMD_CALL pack_vector3_u48_unsafe(rtm::vector4f_arg0 vector, uint8_t* out_vector_data)
 	{
@@ -652,6 +659,18 @@ namespace acl
 #endif
 	}
 
+	// Returns the number of bytes read by 'unpack_vector3_u48_unsafe'
+	constexpr uint32_t get_unpack_vector3_u48_load_size()
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return 16;
+#elif defined(RTM_NEON_INTRINSICS)
+		return 8;
+#else
+		return 6;
+#endif
+	}
+
 	// Assumes the 'vector_data' is padded in order to load up to 16 bytes from it
 	inline rtm::vector4f RTM_SIMD_CALL unpack_vector3_s48_unsafe(const uint8_t* vector_data)
 	{
@@ -817,6 +836,18 @@ namespace acl
 #endif
 	}
 
+	// Returns the number of bytes read by 'unpack_vector3_u24_unsafe'
+	constexpr uint32_t get_unpack_vector3_u24_load_size()
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return 16;
+#elif defined(RTM_NEON_INTRINSICS)
+		return 8;
+#else
+		return 3;
+#endif
+	}
+
 	// Assumes the 'vector_data' is padded in order to load up to 16 bytes from it
 	inline rtm::vector4f RTM_SIMD_CALL unpack_vector3_s24_unsafe(const uint8_t* vector_data)
 	{
@@ -944,6 +975,29 @@ namespace acl
 		};
 
 #if defined(RTM_SSE2_INTRINSICS)
+#if defined(ACL_BMI2_INTRINSICS) && defined(RTM_ARCH_X64)
+		if (num_bits != 0 && num_bits <= 19)
+		{
+			// All three components fit in a single 64 bit load along with our leading bit offset
+			const __m128 inv_max_value = _mm_load_ps1(&k_packed_constants[num_bits].max_value);
+
+			uint64_t vector_u64 = unaligned_load<uint64_t>(vector_data + (bit_offset / 8));
+			vector_u64 = byte_swap(vector_u64);
+			vector_u64 <<= bit_offset % 8;
+			vector_u64 >>= 64 - (num_bits * 3);
+
+			// Z and Y are deposited in the low and high 32 bit halves, X remains on its own in the high bits
+			const uint64_t component_mask = k_packed_constants[num_bits].mask;
+			const uint64_t zy64 = deposit_bits(vector_u64, component_mask | (component_mask << 32));
+			const uint64_t x64 = vector_u64 >> (num_bits * 2);
+
+			__m128i int_value = _mm_set_epi64x(static_cast<int64_t>(x64), static_cast<int64_t>(zy64));
+			int_value = _mm_shuffle_epi32(int_value, _MM_SHUFFLE(2, 0, 1, 2));
+			const __m128 value = _mm_cvtepi32_ps(int_value);
+			return _mm_mul_ps(value, inv_max_value);
+		}
+#endif
+
 		const uint32_t bit_shift = 32 - num_bits;
 		const __m128i mask = _mm_castps_si128(_mm_load_ps1((const float*)&k_packed_constants[num_bits].mask));
 		const __m128 inv_max_value = _mm_load_ps1(&k_packed_constants[num_bits].max_value);
@@ -1034,6 +1088,18 @@ namespace acl
 #endif
 	}
 
+	// Returns the number of bytes read by 'unpack_vector3_uXX_unsafe' starting at 'vector_data + (bit_offset / 8)'
+	// Each component is read with a 32 bit load, these overlap and we return the span they cover
+	inline uint32_t get_unpack_vector3_uXX_load_size(uint32_t num_bits, uint32_t bit_offset)
+	{
+#if defined(RTM_SSE2_INTRINSICS) && defined(ACL_BMI2_INTRINSICS) && defined(RTM_ARCH_X64)
+		if (num_bits != 0 && num_bits <= 19)
+			return 8;	// All three components are read with a single 64 bit load
+#endif
+
+		return ((bit_offset + (num_bits * 2)) / 8) + 4 - (bit_offset / 8);
+	}
+
 	// Assumes the 'vector_data' is in big-endian order and padded in order to load up to 16 bytes from it
 	inline rtm::vector4f RTM_SIMD_CALL unpack_vector3_sXX_unsafe(uint32_t num_bits, const uint8_t* vector_data, uint32_t bit_offset)
 	{
@@ -1041,6 +1107,63 @@ namespace acl
 		return rtm::vector_neg_mul_sub(unsigned_value, -2.0F, rtm::vector_set(-1.0F));
 	}
 
+	// Same as unpack_vector3_uXX_unsafe but only supports 8 or 16 bits per component and requires the
+	// sample to start on a byte boundary. Components are loaded directly without any bit extraction.
+	// Assumes the 'vector_data' is in big-endian order and padded in order to load up to 8 bytes from it
+	inline rtm::vector4f RTM_SIMD_CALL unpack_vector3_uXX_byte_aligned_unsafe(uint32_t num_bits, const uint8_t* vector_data)
+	{
+		ACL_ASSERT(num_bits == 8 || num_bits == 16, "This function only supports 8 or 16 bits per component");
+
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i zero = _mm_setzero_si128();
+
+		if (num_bits == 8)
+		{
+			const __m128i bytes = _mm_cvtsi32_si128(static_cast<int32_t>(unaligned_load<uint32_t>(vector_data)));
+			const __m128i int_value = _mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero);
+			return _mm_mul_ps(_mm_cvtepi32_ps(int_value), _mm_set_ps1(1.0F / 255.0F));
+		}
+		else
+		{
+			__m128i shorts = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(vector_data));
+			shorts = _mm_or_si128(_mm_slli_epi16(shorts, 8), _mm_srli_epi16(shorts, 8));	// Swap from big-endian
+			const __m128i int_value = _mm_unpacklo_epi16(shorts, zero);
+			return _mm_mul_ps(_mm_cvtepi32_ps(int_value), _mm_set_ps1(1.0F / 65535.0F));
+		}
+#elif defined(RTM_NEON_INTRINSICS)
+		if (num_bits == 8)
+		{
+			const uint8x8_t bytes = vcreate_u8(uint64_t(unaligned_load<uint32_t>(vector_data)));
+			const uint32x4_t int_value = vmovl_u16(vget_low_u16(vmovl_u8(bytes)));
+			return vmulq_n_f32(vcvtq_f32_u32(int_value), 1.0F / 255.0F);
+		}
+		else
+		{
+			const uint8x8_t bytes = vrev16_u8(vcreate_u8(unaligned_load<uint64_t>(vector_data)));	// Swap from big-endian
+			const uint32x4_t int_value = vmovl_u16(vreinterpret_u16_u8(bytes));
+			return vmulq_n_f32(vcvtq_f32_u32(int_value), 1.0F / 65535.0F);
+		}
+#else
+		if (num_bits == 8)
+			return rtm::vector_mul(rtm::vector_set(float(vector_data[0]), float(vector_data[1]), float(vector_data[2])), 1.0F / 255.0F);
+
+		const uint32_t x16 = (uint32_t(vector_data[0]) << 8) | vector_data[1];
+		const uint32_t y16 = (uint32_t(vector_data[2]) << 8) | vector_data[3];
+		const uint32_t z16 = (uint32_t(vector_data[4]) << 8) | vector_data[5];
+		return rtm::vector_mul(rtm::vector_set(float(x16), float(y16), float(z16)), 1.0F / 65535.0F);
+#endif
+	}
+
+	// Returns the number of bytes read by 'unpack_vector3_uXX_byte_aligned_unsafe'
+	constexpr uint32_t get_unpack_vector3_uXX_byte_aligned_load_size(uint32_t num_bits)
+	{
+#if defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON_INTRINSICS)
+		return num_bits == 8 ? 4 : 8;
+#else
+		return num_bits == 8 ? 3 : 6;
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// vector2 packing and decay
 
@@ -51,6 +51,7 @@ def parse_argv():
 	misc = parser.add_argument_group(title='Miscellaneous')
 	misc.add_argument('-avx', dest='use_avx', action='store_true', help='Compile using AVX instructions on Windows, OS X, and Linux')
 	misc.add_argument('-pop', dest='use_popcnt', action='store_true', help='Compile using the POPCNT instruction')
+	misc.add_argument('-bmi2', dest='use_bmi2', action='store_true', help='Compile using the BMI2 instructions')
 	misc.add_argument('-nosimd', dest='use_simd', action='store_false', help='Compile without SIMD instructions')
 	misc.add_argument('-simd', dest='use_simd', action='store_true', help='Compile with default SIMD instructions')
 	misc.add_argument('-nosjson', dest='use_sjson', action='store_false', help='Compile without SJSON support')
@@ -67,7 +68,7 @@ def parse_argv():
 		num_threads = 4
 
 	parser.set_defaults(build=False, clean=False, clean_only=False, unit_test=False, regression_test=False, bench=False, run_bench=False, pull_bench=False,
-		compiler=None, config='Release', cpu=None, cpp_version='11', use_avx=False, use_popcnt=False, use_simd=True, use_sjson=True, allwarnings=False,
+		compiler=None, config='Release', cpu=None, cpp_version='11', use_avx=False, use_popcnt=False, use_bmi2=False, use_simd=True, use_sjson=True, allwarnings=False,
 		num_threads=num_threads, tests_matching='')
 
 	args = parser.parse_args()
@@ -341,6 +342,10 @@ def do_generate_solution(build_dir, cmake_script_dir, regression_test_data_dir,
 		print('Enabling POPCOUNT usage')
 		extra_switches.append('-DUSE_POPCNT_INSTRUCTIONS:BOOL=true')
 
+	if args.use_bmi2:
+		print('Enabling BMI2 usage')
+		extra_switches.append('-DUSE_BMI2_INSTRUCTIONS:BOOL=true')
+
 	if not args.use_simd:
 		print('Disabling SIMD instruction usage')
 		extra_switches.append('-DUSE_SIMD_INSTRUCTIONS:BOOL=false')
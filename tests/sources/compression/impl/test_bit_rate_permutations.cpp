@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "catch2.impl.h"
+
+#include <acl/compression/impl/transform_bit_rate_permutations.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace acl;
+using namespace acl::acl_impl;
+
+TEST_CASE("Local bit rate permutations", "[compression][impl]")
+{
+	for (uint32_t num_dof = 1; num_dof <= 3; ++num_dof)
+	{
+		const uint32_t num_permutations = get_num_local_bit_rate_permutations(num_dof);
+
+		std::vector<uint8_t> permutations(num_permutations * num_dof);
+		CHECK(generate_local_bit_rate_permutations(num_dof, permutations.data()) == num_permutations);
+
+		std::vector<bool> is_permutation_found(num_permutations, false);
+		uint32_t num_errors = 0;
+
+		for (uint32_t permutation_index = 0; permutation_index < num_permutations; ++permutation_index)
+		{
+			const uint8_t* permutation = permutations.data() + (permutation_index * num_dof);
+
+			// Every permutation is present exactly once
+			uint32_t permutation_id = 0;
+			uint32_t num_bits = 0;
+			for (uint32_t dof_index = 0; dof_index < num_dof; ++dof_index)
+			{
+				if (permutation[dof_index] >= k_num_bit_rates)
+				{
+					num_errors++;
+					continue;
+				}
+
+				permutation_id = (permutation_id * k_num_bit_rates) + permutation[dof_index];
+				num_bits += get_num_bits_at_bit_rate(permutation[dof_index]);
+			}
+
+			if (permutation_id >= num_permutations || is_permutation_found[permutation_id])
+				num_errors++;
+			else
+				is_permutation_found[permutation_id] = true;
+
+			if (permutation_index == 0)
+				continue;
+
+			// Sorted by transform size and then by each bit rate
+			const uint8_t* prev_permutation = permutation - num_dof;
+
+			uint32_t prev_num_bits = 0;
+			for (uint32_t dof_index = 0; dof_index < num_dof; ++dof_index)
+				prev_num_bits += get_num_bits_at_bit_rate(prev_permutation[dof_index]);
+
+			if (prev_num_bits > num_bits)
+				num_errors++;
+			else if (prev_num_bits == num_bits)
+			{
+				for (uint32_t dof_index = 0; dof_index < num_dof; ++dof_index)
+				{
+					if (prev_permutation[dof_index] == permutation[dof_index])
+						continue;
+
+					if (prev_permutation[dof_index] > permutation[dof_index])
+						num_errors++;
+					break;
+				}
+			}
+		}
+
+		CHECK(num_errors == 0);
+	}
+}
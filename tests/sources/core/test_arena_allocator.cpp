@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "catch2.impl.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/arena_allocator.h>
+#include <acl/core/memory_utils.h>
+
+using namespace acl;
+
+TEST_CASE("arena allocator", "[core][memory]")
+{
+	ansi_allocator backing_allocator;
+
+	{
+		arena_allocator allocator(backing_allocator, 1024);
+		CHECK(allocator.get_used_size() == 0);
+		CHECK(allocator.get_reserved_size() == 0);
+		CHECK(allocator.get_high_water_mark() == 0);
+
+		void* ptr0 = allocator.allocate(32);
+		CHECK(ptr0 != nullptr);
+		CHECK(is_aligned_to(ptr0, iallocator::k_default_alignment));
+		CHECK(allocator.get_reserved_size() == 1024);
+
+		void* ptr1 = allocator.allocate(48, 256);
+		CHECK(is_aligned_to(ptr1, 256));
+		CHECK(ptr1 > ptr0);
+
+		// Deallocating the most recent allocation reclaims its memory
+		const size_t used_size = allocator.get_used_size();
+		allocator.deallocate(ptr1, 48);
+		CHECK(allocator.get_used_size() < used_size);
+		CHECK(allocator.get_high_water_mark() == used_size);
+
+		void* ptr2 = allocator.allocate(48, 256);
+		CHECK(ptr2 == ptr1);
+
+		// Older allocations are only reclaimed when we reset
+		const size_t used_size2 = allocator.get_used_size();
+		allocator.deallocate(ptr0, 32);
+		CHECK(allocator.get_used_size() == used_size2);
+
+		// Large allocations get their own block
+		void* ptr3 = allocator.allocate(4096);
+		CHECK(ptr3 != nullptr);
+		CHECK(allocator.get_reserved_size() > 4096 + 1024);
+
+		const size_t reserved_size = allocator.get_reserved_size();
+		const size_t high_water_mark = allocator.get_high_water_mark();
+		CHECK(high_water_mark >= 4096 + 32 + 48);
+
+		// Blocks are retained and re-used when we reset
+		allocator.reset();
+		CHECK(allocator.get_used_size() == 0);
+		CHECK(allocator.get_high_water_mark() == high_water_mark);
+
+		void* ptr4 = allocator.allocate(32);
+		CHECK(ptr4 == ptr0);
+		void* ptr5 = allocator.allocate(2048);
+		CHECK(ptr5 != nullptr);
+		CHECK(allocator.get_reserved_size() == reserved_size);
+
+		allocator.reset_high_water_mark();
+		CHECK(allocator.get_high_water_mark() == allocator.get_used_size());
+
+		allocator.release();
+		CHECK(allocator.get_used_size() == 0);
+		CHECK(allocator.get_reserved_size() == 0);
+	}
+
+	{
+		arena_allocator allocator(backing_allocator, 1024);
+
+		uint32_t* values = allocate_type_array<uint32_t>(allocator, 16);
+		for (uint32_t index = 0; index < 16; ++index)
+			values[index] = index;
+
+		uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, 4000, 64);
+		CHECK(is_aligned_to(buffer, 64));
+
+		bool are_values_intact = true;
+		for (uint32_t index = 0; index < 16; ++index)
+			are_values_intact &= values[index] == index;
+		CHECK(are_values_intact);
+
+		deallocate_type_array(allocator, buffer, 4000);
+		deallocate_type_array(allocator, values, 16);
+	}
+
+#if defined(ACL_ALLOCATOR_TRACK_NUM_ALLOCATIONS)
+	CHECK(backing_allocator.get_allocation_count() == 0);
+#endif
+}
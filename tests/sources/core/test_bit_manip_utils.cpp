@@ -72,4 +72,17 @@ TEST_CASE("bit_manip_utils", "[core][utils]")
 	CHECK(rotate_bits_left(0x10000010, 4) == 0x00000101);
 
 	CHECK(and_not(0x00000010, 0x10101011) == 0x10101001);
+
+	CHECK(zero_high_bits(0xFFFFFFFF, 0) == 0x00000000);
+	CHECK(zero_high_bits(0xFFFFFFFF, 1) == 0x00000001);
+	CHECK(zero_high_bits(0xFFFFFFFF, 19) == 0x0007FFFF);
+	CHECK(zero_high_bits(0x12345678, 16) == 0x00005678);
+	CHECK(zero_high_bits(0x12345678, 31) == 0x12345678);
+
+	CHECK(deposit_bits(0x0000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL) == 0x0000000000000000ULL);
+	CHECK(deposit_bits(0xFFFFFFFFFFFFFFFFULL, 0x0000000000000000ULL) == 0x0000000000000000ULL);
+	CHECK(deposit_bits(0x0000000000000003ULL, 0x0000000000000A0AULL) == 0x000000000000000AULL);
+	CHECK(deposit_bits(0x0000000000000005ULL, 0x0000000100000003ULL) == 0x0000000100000001ULL);
+	CHECK(deposit_bits(0x0000000000ABCDEFULL, 0x00000FFF00000FFFULL) == 0x00000ABC00000DEFULL);
+	CHECK(deposit_bits(0x8000000000000001ULL, 0xFFFFFFFFFFFFFFFFULL) == 0x8000000000000001ULL);
 }
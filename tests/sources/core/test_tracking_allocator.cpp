@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "catch2.impl.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/tracking_allocator.h>
+
+using namespace acl;
+
+TEST_CASE("tracking allocator", "[core][memory]")
+{
+	ansi_allocator backing_allocator;
+
+	{
+		tracking_allocator allocator(backing_allocator);
+		CHECK(allocator.get_live_size() == 0);
+		CHECK(allocator.get_peak_size() == 0);
+		CHECK(allocator.get_num_allocations() == 0);
+		CHECK(allocator.get_num_deallocations() == 0);
+
+		void* ptr0 = allocator.allocate(32);
+		void* ptr1 = allocator.allocate(48, 64);
+		CHECK(allocator.get_live_size() == 80);
+		CHECK(allocator.get_peak_size() == 80);
+		CHECK(allocator.get_num_allocations() == 2);
+
+		allocator.deallocate(ptr1, 48);
+		CHECK(allocator.get_live_size() == 32);
+		CHECK(allocator.get_peak_size() == 80);
+		CHECK(allocator.get_num_deallocations() == 1);
+
+		// Scopes start with the live size and do not impact the overall stats
+		allocator.begin_scope();
+		CHECK(allocator.get_scope_peak_size() == 32);
+		CHECK(allocator.get_scope_num_allocations() == 0);
+
+		void* ptr2 = allocator.allocate(16);
+		CHECK(allocator.get_scope_peak_size() == 48);
+		CHECK(allocator.get_scope_num_allocations() == 1);
+		CHECK(allocator.get_peak_size() == 80);
+		CHECK(allocator.get_num_allocations() == 3);
+
+		allocator.deallocate(ptr2, 16);
+		allocator.deallocate(ptr0, 32);
+		CHECK(allocator.get_scope_num_deallocations() == 2);
+		CHECK(allocator.get_live_size() == 0);
+		CHECK(allocator.get_num_deallocations() == 3);
+
+		// Null pointers are ignored
+		allocator.deallocate(nullptr, 16);
+		CHECK(allocator.get_num_deallocations() == 3);
+	}
+
+#if defined(ACL_ALLOCATOR_TRACK_NUM_ALLOCATIONS)
+	CHECK(backing_allocator.get_allocation_count() == 0);
+#endif
+}
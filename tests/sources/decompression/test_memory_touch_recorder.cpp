@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "catch2.impl.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/decompression/memory_touch_recorder.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("memory touch recorder", "[decompression][memory]")
+{
+	ansi_allocator allocator;
+
+	alignas(4096) static uint8_t buffer[4096 * 4];
+
+	{
+		memory_touch_recorder recorder(allocator);
+		CHECK(recorder.get_stats().num_loads == 0);
+		CHECK(recorder.get_stats().num_touched_cache_lines == 0);
+
+		// Nothing is recorded without an active recorder
+		CHECK(memory_touch_recorder::get_active() == nullptr);
+
+		{
+			scope_memory_touch_recorder recording(recorder);
+			CHECK(memory_touch_recorder::get_active() == &recorder);
+
+			memory_touch_recorder::get_active()->record(buffer + 0, 8);
+			memory_touch_recorder::get_active()->record(buffer + 60, 8);		// Straddles two cache lines
+			memory_touch_recorder::get_active()->record(buffer + 4090, 58);	// Straddles two pages
+		}
+
+		CHECK(memory_touch_recorder::get_active() == nullptr);
+
+		const memory_touch_stats& stats = recorder.get_stats();
+		CHECK(stats.num_loads == 3);
+		CHECK(stats.num_loaded_bytes == 74);
+		CHECK(stats.num_touched_cache_lines == 4);
+		CHECK(stats.num_touched_pages == 2);
+
+		// Bits [12, 20) live in bytes 1 and 2
+		recorder.reset();
+		recorder.record_bits(buffer, 12, 8);
+		CHECK(recorder.get_stats().num_loads == 1);
+		CHECK(recorder.get_stats().num_loaded_bytes == 2);
+		CHECK(recorder.get_stats().num_touched_cache_lines == 1);
+
+		// Prefetches touch the cache line that contains them without loading anything
+		recorder.record_prefetch(buffer + 4096 + 70);
+		CHECK(recorder.get_stats().num_loads == 1);
+		CHECK(recorder.get_stats().num_prefetches == 1);
+		CHECK(recorder.get_stats().num_touched_cache_lines == 2);
+		CHECK(recorder.get_stats().num_touched_pages == 2);
+
+		// Touching every byte grows our sets well past their initial capacity
+		recorder.reset();
+		for (uint32_t offset = 0; offset < sizeof(buffer); ++offset)
+			recorder.record(buffer + offset, 1);
+
+		CHECK(recorder.get_stats().num_loads == sizeof(buffer));
+		CHECK(recorder.get_stats().num_touched_cache_lines == sizeof(buffer) / memory_touch_recorder::k_cache_line_size);
+		CHECK(recorder.get_stats().num_touched_pages == sizeof(buffer) / memory_touch_recorder::k_page_size);
+	}
+}
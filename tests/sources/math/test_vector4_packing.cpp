@@ -464,6 +464,51 @@ TEST_CASE("pack_vector3_XX part1", "[math][vector4][packing]")
 	CHECK(num_errors == 0);
 }
 
+TEST_CASE("pack_vector3_XX byte aligned", "[math][vector4][packing]")
+{
+	const uint32_t offsets[] = { 0, 8, 16, 24, 32, 64, 96 };
+
+	const vector4f vzero = vector_set(0.0F);
+	const vector4f vone = vector_set(1.0F);
+
+	UnalignedBuffer tmp0;
+	alignas(16) uint8_t buffer[64];
+
+	uint32_t num_errors = 0;
+
+	const uint32_t num_bits_values[] = { 8, 16 };
+	for (const uint32_t num_bits : num_bits_values)
+	{
+		uint32_t max_value = (1U << num_bits) - 1;
+
+		// 3 values at a time to speed things up
+		for (uint32_t value = 0; value <= max_value; value += 3)
+		{
+			vector4f vec0 = vector_clamp(vector_set(
+				unpack_scalar_unsigned(value, num_bits),
+				unpack_scalar_unsigned(std::min(value + 1, max_value), num_bits),
+				unpack_scalar_unsigned(std::min(value + 2, max_value), num_bits)), vzero, vone);
+
+			pack_vector3_uXX_unsafe(vec0, num_bits, &buffer[0]);
+
+			for (size_t offset_idx = 0; offset_idx < get_array_size(offsets); ++offset_idx)
+			{
+				const uint32_t offset = offsets[offset_idx];
+
+				memcpy_bits(&tmp0.buffer[0], offset, &buffer[0], 0, size_t(num_bits) * 3);
+				const vector4f vec1 = unpack_vector3_uXX_unsafe(num_bits, &tmp0.buffer[0], offset);
+				const vector4f vec2 = unpack_vector3_uXX_byte_aligned_unsafe(num_bits, &tmp0.buffer[0] + (offset / 8));
+				if (!vector_all_near_equal3(vec0, vec2, 1.0E-6F))
+					num_errors++;
+				if (!vector_all_near_equal3(vec1, vec2, 0.0F))
+					num_errors++;
+			}
+		}
+	}
+
+	CHECK(num_errors == 0);
+}
+
 TEST_CASE("decay_vector3_XX", "[math][vector4][decay]")
 {
 	const vector4f vzero = vector_set(0.0F);
@@ -34,6 +34,7 @@ def parse_argv():
 	options['level'] = 'Medium'
 	options['strip_keyframe_proportion'] = None
 	options['strip_keyframe_threshold'] = None
+	options['bit_rate_threads'] = None
 	options['print_help'] = False
 
 	for i in range(1, len(sys.argv)):
@@ -88,6 +89,9 @@ def parse_argv():
 		if value.startswith('-strip_keyframe_threshold='):
 			options['strip_keyframe_threshold'] = float(value[len('-strip_keyframe_threshold='):].replace('"', ''))
 
+		if value.startswith('-bit_rate_threads='):
+			options['bit_rate_threads'] = int(value[len('-bit_rate_threads='):].replace('"', ''))
+
 		if value == '-help':
 			options['print_help'] = True
 
@@ -147,6 +151,7 @@ def print_help():
 	print('  -stat_exhaustive: Enables exhaustive stat logging')
 	print('  -strip_keyframe_proportion: Enables keyframe stripping and sets the desired strip proportion')
 	print('  -strip_keyframe_threshold: Enables keyframe stripping and sets the desired strip threshold')
+	print('  -bit_rate_threads=<Num Threads>: Number of threads used to optimize the bit rates of each clip, 0 for one per hardware thread.')
 	print('  -help: Prints this help message.')
 
 def print_stat(stat):
@@ -374,6 +379,9 @@ def compress_clips(options):
 			if options['strip_keyframe_threshold']:
 				cmd = '{} -strip_keyframe_threshold={}'.format(cmd, options['strip_keyframe_threshold'])
 
+			if options['bit_rate_threads'] is not None:
+				cmd = '{} -bit_rate_threads={}'.format(cmd, options['bit_rate_threads'])
+
 			if platform.system() == 'Windows':
 				cmd = cmd.replace('/', '\\')
 
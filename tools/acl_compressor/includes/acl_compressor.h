@@ -48,6 +48,7 @@ void validate_accuracy(acl::iallocator& allocator, const acl::track_array& raw_t
 
 void validate_metadata(const acl::track_array& raw_tracks, const acl::compressed_tracks& tracks);
 void validate_convert(acl::iallocator& allocator, const acl::track_array& raw_tracks);
+void validate_packed_tracks(acl::iallocator& allocator, const acl::compressed_tracks& tracks);
 
 void validate_db(acl::iallocator& allocator, const acl::track_array_qvvf& raw_tracks, const acl::track_array_qvvf& additive_base_tracks,
 	const acl::compression_database_settings& settings, const acl::itransform_error_metric& error_metric,
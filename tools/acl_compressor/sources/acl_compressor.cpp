@@ -110,16 +110,22 @@
 #endif
 
 #include "acl/core/ansi_allocator.h"
+#include "acl/core/arena_allocator.h"
 #include "acl/core/floating_point_exceptions.h"
+#include "acl/core/packed_tracks.h"
+#include "acl/core/scope_profiler.h"
 #include "acl/core/string.h"
+#include "acl/core/tracking_allocator.h"
 #include "acl/core/impl/debug_track_writer.h"
 #include "acl/compression/compress.h"
 #include "acl/compression/convert.h"
 #include "acl/compression/pre_process.h"
 #include "acl/compression/transform_pose_utils.h"	// Just to test compilation
 #include "acl/decompression/decompress.h"
+#include "acl/decompression/memory_touch_recorder.h"
 #include "acl/io/clip_reader.h"
 
+#include <algorithm>
 #include <cstring>
 #include <cstdio>
 #include <fstream>
@@ -170,6 +176,9 @@ struct Options
 	bool			stat_detailed_output			= false;
 	bool			stat_exhaustive_output			= false;
 
+	uint32_t		num_bit_rate_threads			= 1;
+	bool			num_bit_rate_threads_specified	= false;
+
 	//////////////////////////////////////////////////////////////////////////
 
 	Options() noexcept = default;
@@ -218,6 +227,7 @@ static constexpr const char* k_strip_keyframe_proportion_option = "-strip_keyfra
 static constexpr const char* k_strip_keyframe_threshold_option = "-strip_keyframe_threshold=";
 static constexpr const char* k_stat_detailed_output_option = "-stat_detailed";
 static constexpr const char* k_stat_exhaustive_output_option = "-stat_exhaustive";
+static constexpr const char* k_bit_rate_threads_option = "-bit_rate_threads=";
 
 bool is_acl_sjson_file(const char* filename)
 {
@@ -411,6 +421,21 @@ static bool parse_options(int argc, char** argv, Options& options)
 			continue;
 		}
 
+		option_length = std::strlen(k_bit_rate_threads_option);
+		if (std::strncmp(argument, k_bit_rate_threads_option, option_length) == 0)
+		{
+			const int num_threads = std::atoi(argument + option_length);
+			if (num_threads < 0 || num_threads > 256)
+			{
+				printf("Number of bit rate threads must be in the range [0, 256]\n");
+				return false;
+			}
+
+			options.num_bit_rate_threads = static_cast<uint32_t>(num_threads);
+			options.num_bit_rate_threads_specified = true;
+			continue;
+		}
+
 		printf("Unrecognized option %s\n", argument);
 		return false;
 	}
@@ -430,6 +455,37 @@ static bool parse_options(int argc, char** argv, Options& options)
 
 #if defined(ACL_USE_SJSON)
 
+static void write_packed_tracks_stats(iallocator& allocator, const compressed_tracks& tracks, sjson::ObjectWriter& stats_writer)
+{
+	uint8_t* packed_buffer = nullptr;
+	uint32_t packed_size = 0;
+	const error_result pack_result = pack_compressed_tracks(allocator, tracks, packed_buffer, packed_size);
+	ACL_ASSERT(pack_result.empty(), pack_result.c_str()); (void)pack_result;
+
+	const uint32_t unpacked_size = tracks.get_size();
+	uint8_t* unpacked_buffer = allocate_type_array_aligned<uint8_t>(allocator, unpacked_size, alignof(compressed_tracks));
+
+	// Unpack a few times and keep the fastest run
+	constexpr uint32_t k_num_unpack_iterations = 5;
+	double best_unpack_time_s = 1.0E10;
+	for (uint32_t iteration = 0; iteration < k_num_unpack_iterations; ++iteration)
+	{
+		scope_profiler unpack_time;
+		const error_result unpack_result = unpack_compressed_tracks(packed_buffer, packed_size, unpacked_buffer, unpacked_size);
+		unpack_time.stop();
+
+		ACL_ASSERT(unpack_result.empty(), unpack_result.c_str()); (void)unpack_result;
+		best_unpack_time_s = std::min(best_unpack_time_s, unpack_time.get_elapsed_seconds());
+	}
+
+	stats_writer.insert("packed_size", packed_size);
+	stats_writer.insert("packed_compression_ratio", double(unpacked_size) / double(packed_size));
+	stats_writer.insert("unpack_throughput_mbs", best_unpack_time_s > 0.0 ? (double(unpacked_size) / (1024.0 * 1024.0)) / best_unpack_time_s : 0.0);
+
+	deallocate_type_array(allocator, unpacked_buffer, unpacked_size);
+	deallocate_type_array(allocator, packed_buffer, packed_size);
+}
+
 static void try_algorithm(const Options& options, iallocator& allocator, const track_array_qvvf& transform_tracks,
 	const track_array_qvvf& additive_base, additive_clip_format8 additive_format,
 	compression_settings settings, const compression_database_settings& database_settings,
@@ -449,6 +505,9 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 			settings.metadata.include_track_descriptions = true;
 		}
 
+		if (options.num_bit_rate_threads_specified)
+			settings.num_bit_rate_optimization_threads = options.num_bit_rate_threads;
+
 		output_stats stats;
 		stats.logging = logging;
 		stats.writer = stats_writer;
@@ -476,6 +535,59 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 			stats_writer->insert("max_error", error.error);
 			stats_writer->insert("worst_track", error.index);
 			stats_writer->insert("worst_time", error.sample_time);
+			stats_writer->insert("num_bit_rate_optimization_threads", settings.num_bit_rate_optimization_threads);
+
+			write_packed_tracks_stats(allocator, *compressed_tracks_, *stats_writer);
+
+#if defined(ACL_USE_MEMORY_TOUCH_RECORDER)
+			if (are_all_enum_flags_set(logging, stat_logging::detailed))
+			{
+				// Measure the memory actually touched when we seek and decompress every sample
+				decompression_context<instrumented_transform_decompression_settings> instrumented_context;
+				instrumented_context.initialize(*compressed_tracks_);
+
+				memory_touch_recorder recorder(allocator);
+				track_writer writer;
+
+				uint32_t max_touched_cache_lines = 0;
+				uint32_t max_touched_pages = 0;
+				uint32_t max_single_track_touched_cache_lines = 0;
+
+				const uint32_t num_tracks = transform_tracks.get_num_tracks();
+				const uint32_t num_samples = transform_tracks.get_num_samples_per_track();
+				const float sample_rate = transform_tracks.get_sample_rate();
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				{
+					const float sample_time = float(sample_index) / sample_rate;
+
+					recorder.reset();
+					{
+						scope_memory_touch_recorder recording(recorder);
+						instrumented_context.seek(sample_time, sample_rounding_policy::none);
+						instrumented_context.decompress_tracks(writer);
+					}
+
+					max_touched_cache_lines = std::max<uint32_t>(max_touched_cache_lines, recorder.get_stats().num_touched_cache_lines);
+					max_touched_pages = std::max<uint32_t>(max_touched_pages, recorder.get_stats().num_touched_pages);
+
+					// We already seeked, only measure what decompressing a single track touches
+					for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+					{
+						recorder.reset();
+						{
+							scope_memory_touch_recorder recording(recorder);
+							instrumented_context.decompress_track(track_index, writer);
+						}
+
+						max_single_track_touched_cache_lines = std::max<uint32_t>(max_single_track_touched_cache_lines, recorder.get_stats().num_touched_cache_lines);
+					}
+				}
+
+				stats_writer->insert("decomp_measured_max_touched_cache_lines", max_touched_cache_lines);
+				stats_writer->insert("decomp_measured_max_touched_pages", max_touched_pages);
+				stats_writer->insert("decomp_measured_max_single_track_touched_cache_lines", max_single_track_touched_cache_lines);
+			}
+#endif
 		}
 #endif
 
@@ -485,6 +597,71 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 			validate_accuracy(allocator, transform_tracks, additive_base, *settings.error_metric, *compressed_tracks_, regression_error_threshold);
 			validate_metadata(transform_tracks, *compressed_tracks_);
 			validate_convert(allocator, transform_tracks);
+			validate_packed_tracks(allocator, *compressed_tracks_);
+
+			if (settings.level >= compression_level8::high)
+			{
+				// The multithreaded bit rate search must find the same bit rates as the serial search
+				// Lower compression levels rarely search long enough for the threads to matter, skip them to save time
+				compression_settings threaded_settings = settings;
+				threaded_settings.num_bit_rate_optimization_threads = settings.num_bit_rate_optimization_threads == 1 ? 4 : 1;
+
+				output_stats threaded_stats;
+				compressed_tracks* compressed_tracks_threaded = nullptr;
+				const error_result threaded_result = compress_track_list(allocator, transform_tracks, threaded_settings, additive_base, additive_format, compressed_tracks_threaded, threaded_stats);
+
+				ACL_ASSERT(threaded_result.empty(), threaded_result.c_str());
+				ACL_ASSERT(compressed_tracks_threaded->is_valid(true).empty(), "Compressed tracks are invalid");
+				ACL_ASSERT(compressed_tracks_threaded->get_size() == compressed_tracks_->get_size(), "Multithreaded compression should match serial compression");
+				ACL_ASSERT(std::memcmp(compressed_tracks_threaded, compressed_tracks_, compressed_tracks_->get_size()) == 0, "Multithreaded compression should match serial compression");
+
+				allocator.deallocate(compressed_tracks_threaded, compressed_tracks_threaded->get_size());
+			}
+
+			// Deallocations are only reclaimed in LIFO order, we compare how much an arena needs against our tracked peak
+			size_t arena_high_water_mark = 0;
+
+			{
+				// Compressing with an arena for all our scratch memory must yield the same result
+				arena_allocator arena(allocator);
+
+				output_stats arena_stats;
+				compressed_tracks* compressed_tracks_arena = nullptr;
+				const error_result arena_result = compress_track_list(arena, transform_tracks, settings, additive_base, additive_format, compressed_tracks_arena, arena_stats);
+
+				ACL_ASSERT(arena_result.empty(), arena_result.c_str());
+				ACL_ASSERT(compressed_tracks_arena->is_valid(true).empty(), "Compressed tracks are invalid");
+				ACL_ASSERT(compressed_tracks_arena->get_size() == compressed_tracks_->get_size(), "Arena compression should match regular compression");
+				ACL_ASSERT(std::memcmp(compressed_tracks_arena, compressed_tracks_, compressed_tracks_->get_size()) == 0, "Arena compression should match regular compression");
+				ACL_ASSERT(arena.get_high_water_mark() >= compressed_tracks_arena->get_size(), "Arena high water mark is too small");
+
+				arena_high_water_mark = arena.get_high_water_mark();
+
+				// The compressed tracks live in the arena, they are released along with it
+			}
+
+			{
+				// Report how the peak memory estimate compares with the memory we actually use
+				// The estimate isn't a strict upper bound, a ratio below 1.0 means it fell short
+				tracking_allocator peak_tracker(allocator);
+
+				output_stats peak_stats;
+				compressed_tracks* compressed_tracks_peak = nullptr;
+				const error_result peak_result = compress_track_list(peak_tracker, transform_tracks, settings, additive_base, additive_format, compressed_tracks_peak, peak_stats);
+				ACL_ASSERT(peak_result.empty(), peak_result.c_str());
+
+				const bool has_scale = acl_impl::get_tracks_header(*compressed_tracks_).get_has_scale();
+				const size_t estimated_peak_size = estimate_compression_peak_memory(settings, transform_tracks.get_num_tracks(), transform_tracks.get_num_samples_per_track(), has_scale, additive_base.get_num_samples_per_track());
+				const size_t tracked_peak_size = peak_tracker.get_peak_size();
+
+				stats_writer->insert("estimated_peak_memory_size", static_cast<uint64_t>(estimated_peak_size));
+				stats_writer->insert("tracked_peak_memory_size", static_cast<uint64_t>(tracked_peak_size));
+				stats_writer->insert("estimated_peak_memory_ratio", tracked_peak_size != 0 ? (double(estimated_peak_size) / double(tracked_peak_size)) : 0.0);
+				stats_writer->insert("arena_high_water_mark", static_cast<uint64_t>(arena_high_water_mark));
+				stats_writer->insert("arena_overhead_ratio", tracked_peak_size != 0 ? (double(arena_high_water_mark) / double(tracked_peak_size)) : 0.0);
+
+				peak_tracker.deallocate(compressed_tracks_peak, compressed_tracks_peak->get_size());
+			}
 
 			if (settings.enable_database_support)
 			{
@@ -592,6 +769,57 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 			stats_writer->insert("max_error", error.error);
 			stats_writer->insert("worst_track", error.index);
 			stats_writer->insert("worst_time", error.sample_time);
+
+			write_packed_tracks_stats(allocator, *compressed_tracks_, *stats_writer);
+
+#if defined(ACL_USE_MEMORY_TOUCH_RECORDER)
+			// Scalar tracks do not report their loads to the memory touch recorder, make it explicit
+			// that the measured stats are missing rather than silently omitting them
+			if (are_all_enum_flags_set(logging, stat_logging::detailed))
+				stats_writer->insert("decomp_measured_touched_memory", "unsupported for scalar tracks");
+#endif
+
+			// Report how spline key reduction compares with uniform sampling on this clip, rotations do not support it
+			if (are_all_enum_flags_set(logging, stat_logging::detailed) && track_list.get_track_type() != track_type8::quatf)
+			{
+				compression_settings spline_settings = settings;
+				spline_settings.scalar_algorithm = algorithm_type8::spline_key_reduction;
+
+				output_stats spline_stats;
+				compressed_tracks* compressed_tracks_spline = nullptr;
+				const error_result spline_result = compress_track_list(allocator, track_list, spline_settings, compressed_tracks_spline, spline_stats);
+
+				ACL_ASSERT(spline_result.empty(), spline_result.c_str()); (void)spline_result;
+
+				acl::decompression_context<acl::debug_scalar_decompression_settings> spline_context;
+				spline_context.initialize(*compressed_tracks_spline);
+
+				const track_error spline_error = calculate_compression_error(allocator, track_list, spline_context);
+
+				stats_writer->insert("spline_compressed_size", compressed_tracks_spline->get_size());
+				stats_writer->insert("spline_size_ratio", double(compressed_tracks_spline->get_size()) / double(compressed_tracks_->get_size()));
+				stats_writer->insert("spline_max_error", spline_error.error);
+
+				allocator.deallocate(compressed_tracks_spline, compressed_tracks_spline->get_size());
+			}
+
+			// Report how much storing slow moving tracks at a reduced sample rate saves on this clip, rotations do not support it
+			if (are_all_enum_flags_set(logging, stat_logging::detailed) && track_list.get_track_type() != track_type8::quatf)
+			{
+				compression_settings decimation_settings = settings;
+				decimation_settings.enable_scalar_decimation = true;
+
+				output_stats decimation_stats;
+				compressed_tracks* compressed_tracks_decimated = nullptr;
+				const error_result decimation_result = compress_track_list(allocator, track_list, decimation_settings, compressed_tracks_decimated, decimation_stats);
+
+				ACL_ASSERT(decimation_result.empty(), decimation_result.c_str()); (void)decimation_result;
+
+				stats_writer->insert("decimation_compressed_size", compressed_tracks_decimated->get_size());
+				stats_writer->insert("decimation_size_ratio", double(compressed_tracks_decimated->get_size()) / double(compressed_tracks_->get_size()));
+
+				allocator.deallocate(compressed_tracks_decimated, compressed_tracks_decimated->get_size());
+			}
 		}
 #endif
 
@@ -600,6 +828,116 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 		{
 			validate_accuracy(allocator, track_list, *compressed_tracks_, regression_error_threshold);
 			validate_metadata(track_list, *compressed_tracks_);
+			validate_packed_tracks(allocator, *compressed_tracks_);
+
+			// Make sure the optional track offsets yield the same results
+			compression_settings track_offsets_settings = settings;
+			track_offsets_settings.enable_scalar_track_offsets = true;
+
+			output_stats track_offsets_stats;
+			compressed_tracks* compressed_tracks_with_offsets = nullptr;
+			const error_result track_offsets_result = compress_track_list(allocator, track_list, track_offsets_settings, compressed_tracks_with_offsets, track_offsets_stats);
+
+			ACL_ASSERT(track_offsets_result.empty(), track_offsets_result.c_str()); (void)track_offsets_result;
+			ACL_ASSERT(compressed_tracks_with_offsets->is_valid(true).empty(), "Compressed tracks are invalid");
+
+			validate_accuracy(allocator, track_list, *compressed_tracks_with_offsets, regression_error_threshold);
+
+			// The track offsets change the scalar layout, they must be rejected with an older version
+			acl_impl::tracks_header& offsets_header = const_cast<acl_impl::tracks_header&>(acl_impl::get_tracks_header(*compressed_tracks_with_offsets));
+			if (offsets_header.get_has_track_offsets())
+			{
+				offsets_header.version = compressed_tracks_version16::v02_01_00;
+
+				ACL_ASSERT(compressed_tracks_with_offsets->is_valid(false).any(), "Track offsets should require a newer version");
+			}
+
+			allocator.deallocate(compressed_tracks_with_offsets, compressed_tracks_with_offsets->get_size());
+
+			// Make sure segmenting remains within our error threshold, with and without the track offsets
+			for (const bool enable_track_offsets : { false, true })
+			{
+				compression_settings segmenting_settings = settings;
+				segmenting_settings.enable_scalar_segmenting = true;
+				segmenting_settings.enable_scalar_track_offsets = enable_track_offsets;
+
+				output_stats segmenting_stats;
+				compressed_tracks* compressed_tracks_with_segments = nullptr;
+				const error_result segmenting_result = compress_track_list(allocator, track_list, segmenting_settings, compressed_tracks_with_segments, segmenting_stats);
+
+				ACL_ASSERT(segmenting_result.empty(), segmenting_result.c_str()); (void)segmenting_result;
+				ACL_ASSERT(compressed_tracks_with_segments->is_valid(true).empty(), "Compressed tracks are invalid");
+
+				validate_accuracy(allocator, track_list, *compressed_tracks_with_segments, regression_error_threshold);
+
+				allocator.deallocate(compressed_tracks_with_segments, compressed_tracks_with_segments->get_size());
+			}
+
+			// Make sure grouping tracks by bit rate remains within our error threshold
+			compression_settings grouping_settings = settings;
+			grouping_settings.enable_scalar_track_grouping = true;
+
+			output_stats grouping_stats;
+			compressed_tracks* compressed_tracks_with_groups = nullptr;
+			const error_result grouping_result = compress_track_list(allocator, track_list, grouping_settings, compressed_tracks_with_groups, grouping_stats);
+
+			ACL_ASSERT(grouping_result.empty(), grouping_result.c_str()); (void)grouping_result;
+			ACL_ASSERT(compressed_tracks_with_groups->is_valid(true).empty(), "Compressed tracks are invalid");
+
+			validate_accuracy(allocator, track_list, *compressed_tracks_with_groups, regression_error_threshold);
+
+			allocator.deallocate(compressed_tracks_with_groups, compressed_tracks_with_groups->get_size());
+
+			// Make sure sparse tracks remain within our error threshold, with the track offsets to cover single track decompression
+			compression_settings sparse_settings = settings;
+			sparse_settings.enable_scalar_sparse_tracks = true;
+			sparse_settings.enable_scalar_track_offsets = true;
+
+			output_stats sparse_stats;
+			compressed_tracks* compressed_tracks_with_sparse_tracks = nullptr;
+			const error_result sparse_result = compress_track_list(allocator, track_list, sparse_settings, compressed_tracks_with_sparse_tracks, sparse_stats);
+
+			ACL_ASSERT(sparse_result.empty(), sparse_result.c_str()); (void)sparse_result;
+			ACL_ASSERT(compressed_tracks_with_sparse_tracks->is_valid(true).empty(), "Compressed tracks are invalid");
+
+			validate_accuracy(allocator, track_list, *compressed_tracks_with_sparse_tracks, regression_error_threshold);
+
+			allocator.deallocate(compressed_tracks_with_sparse_tracks, compressed_tracks_with_sparse_tracks->get_size());
+
+			// Make sure decimated tracks remain within our error threshold, alongside sparse tracks and the track offsets to cover every layout
+			compression_settings decimation_settings = settings;
+			decimation_settings.enable_scalar_decimation = true;
+			decimation_settings.enable_scalar_sparse_tracks = true;
+			decimation_settings.enable_scalar_track_offsets = true;
+
+			output_stats decimation_stats;
+			compressed_tracks* compressed_tracks_with_decimation = nullptr;
+			const error_result decimation_result = compress_track_list(allocator, track_list, decimation_settings, compressed_tracks_with_decimation, decimation_stats);
+
+			ACL_ASSERT(decimation_result.empty(), decimation_result.c_str()); (void)decimation_result;
+			ACL_ASSERT(compressed_tracks_with_decimation->is_valid(true).empty(), "Compressed tracks are invalid");
+
+			validate_accuracy(allocator, track_list, *compressed_tracks_with_decimation, regression_error_threshold);
+
+			allocator.deallocate(compressed_tracks_with_decimation, compressed_tracks_with_decimation->get_size());
+
+			// Make sure our spline keys remain within our error threshold, rotations do not support them
+			if (track_list.get_track_type() != track_type8::quatf)
+			{
+				compression_settings spline_settings = settings;
+				spline_settings.scalar_algorithm = algorithm_type8::spline_key_reduction;
+
+				output_stats spline_stats;
+				compressed_tracks* compressed_tracks_with_splines = nullptr;
+				const error_result spline_result = compress_track_list(allocator, track_list, spline_settings, compressed_tracks_with_splines, spline_stats);
+
+				ACL_ASSERT(spline_result.empty(), spline_result.c_str()); (void)spline_result;
+				ACL_ASSERT(compressed_tracks_with_splines->is_valid(true).empty(), "Compressed tracks are invalid");
+
+				validate_accuracy(allocator, track_list, *compressed_tracks_with_splines, regression_error_threshold);
+
+				allocator.deallocate(compressed_tracks_with_splines, compressed_tracks_with_splines->get_size());
+			}
 		}
 #endif
 
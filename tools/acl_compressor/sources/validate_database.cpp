@@ -195,6 +195,40 @@ static void validate_db_streaming(iallocator& allocator, const track_array_qvvf&
 		ACL_ASSERT(rtm::scalar_near_equal(high_quality_tier_error1.error, high_quality_tier_error_ref.error, threshold), "High quality tier split error should be equal to high quality tier inline");
 	}
 
+	// Evict a single medium importance chunk and stream it back in, the other chunks must remain resident
+	const uint32_t num_medium_chunks = db.get_num_chunks(quality_tier::medium_importance);
+	if (num_medium_chunks != 0)
+	{
+		const uint32_t evicted_chunk_index = num_medium_chunks / 2;
+
+		database_stream_request_result stream_result = db_context.stream_out_chunks(quality_tier::medium_importance, evicted_chunk_index);
+		ACL_ASSERT(stream_result == database_stream_request_result::dispatched, "Failed to stream out chunk");
+		ACL_ASSERT(!db_context.is_chunk_streamed_in(quality_tier::medium_importance, evicted_chunk_index), "Chunk should be streamed out");
+		ACL_ASSERT(!db_context.is_streamed_in(quality_tier::medium_importance), "Tier should not be fully streamed in");
+
+		for (uint32_t chunk_index = 0; chunk_index < num_medium_chunks; ++chunk_index)
+			ACL_ASSERT(chunk_index == evicted_chunk_index || db_context.is_chunk_streamed_in(quality_tier::medium_importance, chunk_index), "Chunk should still be streamed in");
+
+		ACL_ASSERT(num_medium_chunks == 1 || db_medium_streamer.get_bulk_data(quality_tier::medium_importance) != nullptr, "Bulk data should be allocated");
+
+		// Streaming out again is a no-op
+		stream_result = db_context.stream_out_chunks(quality_tier::medium_importance, evicted_chunk_index);
+		ACL_ASSERT(stream_result == database_stream_request_result::done, "Chunk should already be streamed out");
+
+		// Streaming in the whole range only streams what is missing
+		stream_result = db_context.stream_in_chunks(quality_tier::medium_importance, 0, num_medium_chunks);
+		ACL_ASSERT(stream_result == database_stream_request_result::dispatched, "Failed to stream in chunk");
+		ACL_ASSERT(db_context.is_streamed_in(quality_tier::medium_importance), "Tier should be streamed in");
+
+		stream_result = db_context.stream_in_chunks(quality_tier::medium_importance, 0, num_medium_chunks);
+		ACL_ASSERT(stream_result == database_stream_request_result::done, "Tier should already be streamed in");
+
+		const track_error high_quality_tier_error0 = calculate_compression_error(allocator, raw_tracks, context0, error_metric, additive_base_tracks);
+		ACL_ASSERT(rtm::scalar_near_equal(high_quality_tier_error0.error, high_quality_tier_error_ref.error, threshold), "High quality tier split error should be equal to high quality tier inline");
+		const track_error high_quality_tier_error1 = calculate_compression_error(allocator, raw_tracks, context1, error_metric, additive_base_tracks);
+		ACL_ASSERT(rtm::scalar_near_equal(high_quality_tier_error1.error, high_quality_tier_error_ref.error, threshold), "High quality tier split error should be equal to high quality tier inline");
+	}
+
 	// Stream out our low importance tier, restoring medium quality
 	stream_out_database_tier(db_context, db_low_streamer, db, quality_tier::lowest_importance);
 
@@ -477,6 +511,138 @@ static void validate_db_stripping(iallocator& allocator, const track_array_qvvf&
 		allocator.deallocate(db_neither1, db_neither1->get_size());
 }
 
+static void validate_db_merging(iallocator& allocator, const track_array_qvvf& raw_tracks, const track_array_qvvf& additive_base_tracks,
+	const compression_database_settings& settings, const itransform_error_metric& error_metric,
+	const track_error& high_quality_tier_error_ref,
+	const compressed_tracks& input_tracks1, const compressed_tracks& db_tracks0, const compressed_tracks& db_tracks1,
+	const compressed_database& db0, const compressed_database& db1)
+{
+	// Our desired error threshold
+	// See validate_db(..) for details
+#if !defined(RTM_SSE2_INTRINSICS) && defined(RTM_ARCH_X86)
+	const float threshold = 1.0E-3F;
+#else
+	const float threshold = 1.0E-4F;
+#endif
+
+	const compressed_tracks* db1_tracks[1] = { &db_tracks1 };
+	const compressed_tracks* appended_input_tracks[1] = { &input_tracks1 };
+
+	compressed_tracks* merged_tracks1[1] = { nullptr };
+	compressed_tracks* appended_tracks1[1] = { nullptr };
+	compressed_database* merged_db = nullptr;
+	compressed_database* appended_db = nullptr;
+
+	error_result result = merge_databases(allocator, db0, db1, &db1_tracks[0], 1, merged_tracks1, merged_db);
+	ACL_ASSERT(result.empty(), result.c_str());
+
+	result = append_to_database(allocator, settings, db0, &appended_input_tracks[0], 1, appended_tracks1, appended_db);
+	ACL_ASSERT(result.empty(), result.c_str());
+
+#if defined(RTM_COMPILER_MSVC)
+	#pragma warning(push)
+	// warning C6011: Dereferencing NULL pointer '...'.
+	// Crashing is fine since this is used for regression testing
+	#pragma warning(disable : 6011)
+#endif
+
+	const compressed_database* new_dbs[2] = { merged_db, appended_db };
+	const compressed_tracks* new_tracks1[2] = { merged_tracks1[0], appended_tracks1[0] };
+
+	for (uint32_t db_index = 0; db_index < 2; ++db_index)
+	{
+		const compressed_database& new_db = *new_dbs[db_index];
+		const compressed_tracks& new_tracks = *new_tracks1[db_index];
+
+		ACL_ASSERT(new_db.get_num_clips() == db0.get_num_clips() + 1, "Unexpected number of clips");
+		ACL_ASSERT(new_db.contains(db_tracks0), "Existing clips should remain bound to the new database");
+		ACL_ASSERT(new_db.contains(new_tracks), "Database should contain our new clip");
+
+		// Existing chunks and their bulk data must not change
+		for (quality_tier tier : { quality_tier::medium_importance, quality_tier::lowest_importance })
+		{
+			const uint32_t bulk_data_size = db0.get_bulk_data_size(tier);
+			ACL_ASSERT(new_db.get_num_chunks(tier) >= db0.get_num_chunks(tier), "Existing chunks should be retained");
+			ACL_ASSERT(new_db.get_bulk_data_size(tier) >= bulk_data_size, "Existing bulk data should be retained");
+			ACL_ASSERT(bulk_data_size == 0 || std::memcmp(new_db.get_bulk_data(tier), db0.get_bulk_data(tier), bulk_data_size) == 0, "Existing bulk data should not change");
+		}
+
+		acl::decompression_context<debug_transform_decompression_settings_with_db> context0;
+		acl::decompression_context<debug_transform_decompression_settings_with_db> context1;
+		acl::database_context<acl::debug_database_settings> db_context;
+
+		bool initialized = db_context.initialize(allocator, new_db);
+		initialized = initialized && context0.initialize(db_tracks0, db_context);
+		initialized = initialized && context1.initialize(new_tracks, db_context);
+		ACL_ASSERT(initialized, "Failed to initialize decompression context");
+
+		const track_error error_tier0 = calculate_compression_error(allocator, raw_tracks, context0, error_metric, additive_base_tracks);
+		ACL_ASSERT(rtm::scalar_near_equal(error_tier0.error, high_quality_tier_error_ref.error, threshold), "Merged database should have the same error");
+
+		const track_error error_tier1 = calculate_compression_error(allocator, raw_tracks, context1, error_metric, additive_base_tracks);
+		ACL_ASSERT(rtm::scalar_near_equal(error_tier1.error, high_quality_tier_error_ref.error, threshold), "Merged database should have the same error");
+	}
+
+	// Validate that streaming works with chunks of non-uniform sizes
+	{
+		compressed_database* split_db = nullptr;
+		uint8_t* split_db_bulk_data_medium = nullptr;
+		uint8_t* split_db_bulk_data_low = nullptr;
+		result = split_database_bulk_data(allocator, *merged_db, split_db, split_db_bulk_data_medium, split_db_bulk_data_low);
+		ACL_ASSERT(result.empty(), "Failed to split database");
+
+		validate_db_streaming(allocator, raw_tracks, additive_base_tracks, error_metric, high_quality_tier_error_ref, db_tracks0, *merged_tracks1[0], *split_db, split_db_bulk_data_medium, split_db_bulk_data_low);
+
+		allocator.deallocate(split_db_bulk_data_medium, split_db->get_bulk_data_size(quality_tier::medium_importance));
+		allocator.deallocate(split_db_bulk_data_low, split_db->get_bulk_data_size(quality_tier::lowest_importance));
+		allocator.deallocate(split_db, split_db->get_size());
+	}
+
+#if defined(RTM_COMPILER_MSVC)
+	#pragma warning(pop)
+#endif
+
+	allocator.deallocate(merged_tracks1[0], merged_tracks1[0]->get_size());
+	allocator.deallocate(appended_tracks1[0], appended_tracks1[0]->get_size());
+	allocator.deallocate(merged_db, merged_db->get_size());
+	allocator.deallocate(appended_db, appended_db->get_size());
+}
+
+// Writes the hash of the clip owning each run of consecutive chunk segments of a tier, in bulk data order
+// Returns the number of runs, a clip whose segments are contiguous within the tier only has a single run
+static uint32_t get_chunk_clip_runs(const compressed_database& db, quality_tier tier, uint32_t* out_clip_hashes, uint32_t max_num_runs)
+{
+	using namespace acl_impl;
+
+	const database_header& header = get_database_header(db);
+	const bool is_medium_tier = tier == quality_tier::medium_importance;
+	const database_chunk_description* chunk_descriptions = is_medium_tier ? header.get_chunk_descriptions_medium() : header.get_chunk_descriptions_low();
+	const uint8_t* bulk_data = is_medium_tier ? header.get_bulk_data_medium() : header.get_bulk_data_low();
+	const uint32_t num_chunks = db.get_num_chunks(tier);
+
+	uint32_t num_runs = 0;
+	for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+	{
+		const database_chunk_header* chunk_header = chunk_descriptions[chunk_index].get_chunk_header(bulk_data);
+		const database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
+
+		for (uint32_t segment_index = 0; segment_index < chunk_header->num_segments; ++segment_index)
+		{
+			const uint32_t clip_hash = chunk_segment_headers[segment_index].clip_hash;
+			if (num_runs != 0 && out_clip_hashes[num_runs - 1] == clip_hash)
+				continue;	// Same clip as the previous segment
+
+			ACL_ASSERT(num_runs < max_num_runs, "Too many chunk segment runs");
+			if (num_runs < max_num_runs)
+				out_clip_hashes[num_runs] = clip_hash;
+
+			num_runs++;
+		}
+	}
+
+	return num_runs;
+}
+
 static bool has_zero_scale(const track_array_qvvf& raw_tracks)
 {
 	const float threshold = 1.0E-6F;
@@ -639,6 +805,70 @@ void validate_db(iallocator& allocator, const track_array_qvvf& raw_tracks, cons
 		ACL_ASSERT(rtm::scalar_near_equal(error_tier1.error, high_quality_tier_error_ref.error, threshold), "Database 01 should have the same error");
 	}
 
+	{
+		// Validate that clip grouping only changes the chunk layout, not the decompressed result
+		const uint32_t clip_group_ids[2] = { 1, 0 };
+		compressed_tracks* grouped_db_tracks[2] = { nullptr, nullptr };
+		compressed_database* grouped_db = nullptr;
+
+		const error_result db_result = build_database(allocator, settings, &input_tracks[0], &clip_group_ids[0], 2, grouped_db_tracks, grouped_db);
+		ACL_ASSERT(db_result.empty(), db_result.c_str());
+
+#if defined(RTM_COMPILER_MSVC)
+	#pragma warning(push)
+	// warning C6011: Dereferencing NULL pointer '...'.
+	// Crashing is fine since this is used for regression testing
+	#pragma warning(disable : 6011)
+#endif
+
+		ACL_ASSERT(grouped_db->get_num_chunks(quality_tier::lowest_importance) == db01->get_num_chunks(quality_tier::lowest_importance), "Grouping should not change the number of chunks");
+
+		// Our second clip has the lowest group ID, its segments must be written first and each clip must
+		// remain contiguous while the ungrouped database retains the input order
+		for (quality_tier tier : { quality_tier::medium_importance, quality_tier::lowest_importance })
+		{
+			uint32_t grouped_clip_hashes[4];
+			const uint32_t num_grouped_runs = get_chunk_clip_runs(*grouped_db, tier, &grouped_clip_hashes[0], 4);
+
+			uint32_t ungrouped_clip_hashes[4];
+			const uint32_t num_ungrouped_runs = get_chunk_clip_runs(*db01, tier, &ungrouped_clip_hashes[0], 4);
+
+			ACL_ASSERT(num_grouped_runs == num_ungrouped_runs, "Grouping should not change which clips have data in a tier");
+			ACL_ASSERT(num_grouped_runs <= 2, "Clip segments should be contiguous");
+
+			if (num_grouped_runs == 2)
+			{
+				ACL_ASSERT(grouped_clip_hashes[0] == grouped_db_tracks[1]->get_hash() && grouped_clip_hashes[1] == grouped_db_tracks[0]->get_hash(), "Grouped clips should be written in group order");
+				ACL_ASSERT(ungrouped_clip_hashes[0] == db_tracks01[0]->get_hash() && ungrouped_clip_hashes[1] == db_tracks01[1]->get_hash(), "Ungrouped clips should be written in input order");
+			}
+		}
+
+		acl::decompression_context<debug_transform_decompression_settings_with_db> context0;
+		acl::decompression_context<debug_transform_decompression_settings_with_db> context1;
+		acl::database_context<acl::debug_database_settings> db_context;
+
+		bool initialized = db_context.initialize(allocator, *grouped_db);
+		initialized = initialized && context0.initialize(*grouped_db_tracks[0], db_context);
+		initialized = initialized && context1.initialize(*grouped_db_tracks[1], db_context);
+		ACL_ASSERT(initialized, "Failed to initialize decompression context");
+
+		const track_error error_tier0 = calculate_compression_error(allocator, raw_tracks, context0, error_metric, additive_base_tracks);
+		ACL_ASSERT(rtm::scalar_near_equal(error_tier0.error, high_quality_tier_error_ref.error, threshold), "Grouped database should have the same error");
+
+		const track_error error_tier1 = calculate_compression_error(allocator, raw_tracks, context1, error_metric, additive_base_tracks);
+		ACL_ASSERT(rtm::scalar_near_equal(error_tier1.error, high_quality_tier_error_ref.error, threshold), "Grouped database should have the same error");
+
+		db_context.reset();
+
+		allocator.deallocate(grouped_db_tracks[0], grouped_db_tracks[0]->get_size());
+		allocator.deallocate(grouped_db_tracks[1], grouped_db_tracks[1]->get_size());
+		allocator.deallocate(grouped_db, grouped_db->get_size());
+
+#if defined(RTM_COMPILER_MSVC)
+	#pragma warning(pop)
+#endif
+	}
+
 	{
 		// Validate relocation
 		acl::decompression_context<debug_transform_decompression_settings_with_db> context0;
@@ -661,6 +891,9 @@ void validate_db(iallocator& allocator, const track_array_qvvf& raw_tracks, cons
 		ACL_ASSERT(db_context0.relocated(*db0), "Relocation should succeed");
 	}
 
+	// Validate merging and appending to an existing database
+	validate_db_merging(allocator, raw_tracks, additive_base_tracks, settings, error_metric, high_quality_tier_error_ref, compressed_tracks1, *db_tracks0[0], *db_tracks1[0], *db0, *db1);
+
 	// Measure the tier error when stripping
 	validate_db_stripping(allocator, raw_tracks, additive_base_tracks, error_metric, *db_tracks01[0], *db_tracks01[1], *db01, db01->get_bulk_data(quality_tier::medium_importance), db01->get_bulk_data(quality_tier::lowest_importance));
 
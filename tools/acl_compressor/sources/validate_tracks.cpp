@@ -27,14 +27,18 @@
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/floating_point_exceptions.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/packed_tracks.h"
 #include "acl/core/impl/bit_cast.impl.h"
 #include "acl/compression/compress.h"
 #include "acl/compression/convert.h"
+#include "acl/compression/impl/rotation.scalar.h"
 #include "acl/compression/track_array.h"
 #include "acl/compression/track_error.h"
 #include "acl/compression/transform_error_metrics.h"
 #include "acl/decompression/decompress.h"
 
+#include <cstring>
+
 using namespace acl;
 
 #if defined(ACL_USE_SJSON) && defined(ACL_HAS_ASSERT_CHECKS)
@@ -312,6 +316,50 @@ void RTM_SIMD_CALL validate_scalar_tracks(const track_array& raw_tracks, const a
 			error = rtm::vector_abs(rtm::vector_sub(raw_value, lossy_value));
 			break;
 		}
+		case track_type8::quatf:
+		{
+			const rtm::quatf raw_value = reference.read_quat(track_index);
+			const rtm::quatf lossy_value = tracks.read_quat(output_index);
+			error = rtm::vector_set(acl_impl::calculate_quatf_error(raw_value, lossy_value));
+			break;
+		}
+		case track_type8::float1d:
+		{
+			const double raw_value = reference.read_float1d(track_index);
+			const double lossy_value = tracks.read_float1d(output_index);
+			error = rtm::vector_set(float(rtm::scalar_abs(raw_value - lossy_value)));
+			break;
+		}
+		case track_type8::float2d:
+		{
+			const rtm::vector4d raw_value = reference.read_float2d(track_index);
+			const rtm::vector4d lossy_value = tracks.read_float2d(output_index);
+			error = rtm::vector_cast(rtm::vector_abs(rtm::vector_sub(raw_value, lossy_value)));
+			error = rtm::vector_mix<rtm::mix4::x, rtm::mix4::y, rtm::mix4::c, rtm::mix4::d>(error, zero);
+			break;
+		}
+		case track_type8::float3d:
+		{
+			const rtm::vector4d raw_value = reference.read_float3d(track_index);
+			const rtm::vector4d lossy_value = tracks.read_float3d(output_index);
+			error = rtm::vector_cast(rtm::vector_abs(rtm::vector_sub(raw_value, lossy_value)));
+			error = rtm::vector_mix<rtm::mix4::x, rtm::mix4::y, rtm::mix4::z, rtm::mix4::d>(error, zero);
+			break;
+		}
+		case track_type8::float4d:
+		{
+			const rtm::vector4d raw_value = reference.read_float4d(track_index);
+			const rtm::vector4d lossy_value = tracks.read_float4d(output_index);
+			error = rtm::vector_cast(rtm::vector_abs(rtm::vector_sub(raw_value, lossy_value)));
+			break;
+		}
+		case track_type8::vector4d:
+		{
+			const rtm::vector4d raw_value = reference.read_vector4d(track_index);
+			const rtm::vector4d lossy_value = tracks.read_vector4d(output_index);
+			error = rtm::vector_cast(rtm::vector_abs(rtm::vector_sub(raw_value, lossy_value)));
+			break;
+		}
 		case track_type8::qvvf:
 		default:
 			ACL_ASSERT(false, "Unsupported track type");
@@ -501,6 +549,72 @@ void validate_accuracy(
 				ACL_ASSERT(rtm::vector_all_near_equal(lossy_value_, lossy_value, 0.00001F), "Failed to sample track %u at time %f", track_index, sample_time);
 				break;
 			}
+			case track_type8::quatf:
+			{
+				const rtm::quatf raw_value_ = raw_tracks_writer.read_quat(track_index);
+				const rtm::quatf lossy_value_ = lossy_tracks_writer.read_quat(output_index);
+				const rtm::quatf raw_value = raw_track_writer.read_quat(track_index);
+				const rtm::quatf lossy_value = lossy_track_writer.read_quat(output_index);
+				ACL_ASSERT(acl_impl::calculate_quatf_error(raw_value, lossy_value) < regression_error_thresholdf, "Error too high for track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(acl_impl::calculate_quatf_error(raw_value_, raw_value) < 0.0001F, "Failed to sample track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(acl_impl::calculate_quatf_error(lossy_value_, lossy_value) < 0.0001F, "Failed to sample track %u at time %f", track_index, sample_time);
+				break;
+			}
+			case track_type8::float1d:
+			{
+				const double raw_value_ = raw_tracks_writer.read_float1d(track_index);
+				const double lossy_value_ = lossy_tracks_writer.read_float1d(output_index);
+				const double raw_value = raw_track_writer.read_float1d(track_index);
+				const double lossy_value = lossy_track_writer.read_float1d(output_index);
+				ACL_ASSERT(rtm::scalar_near_equal(raw_value, lossy_value, double(regression_error_thresholdf)), "Error too high for track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(rtm::scalar_near_equal(raw_value_, raw_value, 0.00001), "Failed to sample track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(rtm::scalar_near_equal(lossy_value_, lossy_value, 0.00001), "Failed to sample track %u at time %f", track_index, sample_time);
+				break;
+			}
+			case track_type8::float2d:
+			{
+				const rtm::vector4d raw_value_ = raw_tracks_writer.read_float2d(track_index);
+				const rtm::vector4d lossy_value_ = lossy_tracks_writer.read_float2d(output_index);
+				const rtm::vector4d raw_value = raw_track_writer.read_float2d(track_index);
+				const rtm::vector4d lossy_value = lossy_track_writer.read_float2d(output_index);
+				ACL_ASSERT(rtm::vector_all_near_equal2(raw_value, lossy_value, double(regression_error_thresholdf)), "Error too high for track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(rtm::vector_all_near_equal2(raw_value_, raw_value, 0.00001), "Failed to sample track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(rtm::vector_all_near_equal2(lossy_value_, lossy_value, 0.00001), "Failed to sample track %u at time %f", track_index, sample_time);
+				break;
+			}
+			case track_type8::float3d:
+			{
+				const rtm::vector4d raw_value_ = raw_tracks_writer.read_float3d(track_index);
+				const rtm::vector4d lossy_value_ = lossy_tracks_writer.read_float3d(output_index);
+				const rtm::vector4d raw_value = raw_track_writer.read_float3d(track_index);
+				const rtm::vector4d lossy_value = lossy_track_writer.read_float3d(output_index);
+				ACL_ASSERT(rtm::vector_all_near_equal3(raw_value, lossy_value, double(regression_error_thresholdf)), "Error too high for track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(rtm::vector_all_near_equal3(raw_value_, raw_value, 0.00001), "Failed to sample track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(rtm::vector_all_near_equal3(lossy_value_, lossy_value, 0.00001), "Failed to sample track %u at time %f", track_index, sample_time);
+				break;
+			}
+			case track_type8::float4d:
+			{
+				const rtm::vector4d raw_value_ = raw_tracks_writer.read_float4d(track_index);
+				const rtm::vector4d lossy_value_ = lossy_tracks_writer.read_float4d(output_index);
+				const rtm::vector4d raw_value = raw_track_writer.read_float4d(track_index);
+				const rtm::vector4d lossy_value = lossy_track_writer.read_float4d(output_index);
+				ACL_ASSERT(rtm::vector_all_near_equal(raw_value, lossy_value, double(regression_error_thresholdf)), "Error too high for track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(rtm::vector_all_near_equal(raw_value_, raw_value, 0.00001), "Failed to sample track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(rtm::vector_all_near_equal(lossy_value_, lossy_value, 0.00001), "Failed to sample track %u at time %f", track_index, sample_time);
+				break;
+			}
+			case track_type8::vector4d:
+			{
+				const rtm::vector4d raw_value_ = raw_tracks_writer.read_vector4d(track_index);
+				const rtm::vector4d lossy_value_ = lossy_tracks_writer.read_vector4d(output_index);
+				const rtm::vector4d raw_value = raw_track_writer.read_vector4d(track_index);
+				const rtm::vector4d lossy_value = lossy_track_writer.read_vector4d(output_index);
+				ACL_ASSERT(rtm::vector_all_near_equal(raw_value, lossy_value, double(regression_error_thresholdf)), "Error too high for track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(rtm::vector_all_near_equal(raw_value_, raw_value, 0.00001), "Failed to sample track %u at time %f", track_index, sample_time);
+				ACL_ASSERT(rtm::vector_all_near_equal(lossy_value_, lossy_value, 0.00001), "Failed to sample track %u at time %f", track_index, sample_time);
+				break;
+			}
 			case track_type8::qvvf:
 			default:
 				ACL_ASSERT(false, "Unsupported track type");
@@ -712,6 +826,54 @@ static void compare_raw_with_compressed(iallocator& allocator, const track_array
 				ACL_ASSERT(rtm::vector_all_near_equal(raw_sample, compressed_sample, 0.0F), "Unexpected sample");
 				break;
 			}
+			case track_type8::quatf:
+			{
+				const rtm::quatf raw_sample = *acl_impl::bit_cast<const rtm::quatf*>(raw_track[sample_index]);
+				const rtm::quatf compressed_sample = writer.read_quat(track_index);
+
+				// The W component is reconstructed and the sign of the quaternion may differ
+				ACL_ASSERT(acl_impl::calculate_quatf_error(raw_sample, compressed_sample) < 0.0001F, "Unexpected sample");
+				break;
+			}
+			case track_type8::float1d:
+			case track_type8::float2d:
+			case track_type8::float3d:
+			case track_type8::float4d:
+			case track_type8::vector4d:
+			{
+				// Double precision samples are stored as float deltas from their base value, they are not bit exact
+				const uint32_t num_components = get_track_num_sample_elements(track_type);
+				const double* raw_sample = acl_impl::bit_cast<const double*>(raw_track[sample_index]);
+
+				double compressed_sample[4];
+				switch (track_type)
+				{
+				case track_type8::float1d:
+					compressed_sample[0] = writer.read_float1d(track_index);
+					break;
+				case track_type8::float2d:
+					rtm::vector_store2(writer.read_float2d(track_index), acl_impl::bit_cast<rtm::float2d*>(&compressed_sample[0]));
+					break;
+				case track_type8::float3d:
+					rtm::vector_store3(writer.read_float3d(track_index), acl_impl::bit_cast<rtm::float3d*>(&compressed_sample[0]));
+					break;
+				case track_type8::float4d:
+					rtm::vector_store(writer.read_float4d(track_index), &compressed_sample[0]);
+					break;
+				default:
+					rtm::vector_store(writer.read_vector4d(track_index), &compressed_sample[0]);
+					break;
+				}
+
+				// The delta quantization error remains well within the track precision
+				const double precision = double(raw_track.get_description<track_desc_scalarf>().precision);
+				for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+					ACL_ASSERT(rtm::scalar_near_equal(raw_sample[component_index], compressed_sample[component_index], precision), "Unexpected sample");
+				(void)raw_sample;
+				(void)compressed_sample;
+				(void)precision;
+				break;
+			}
 			case track_type8::qvvf:
 			{
 				const rtm::qvvf raw_sample = *acl_impl::bit_cast<const rtm::qvvf*>(raw_track[sample_index]);
@@ -749,4 +911,65 @@ void validate_convert(iallocator& allocator, const track_array& raw_tracks)
 
 	allocator.deallocate(compressed_tracks_, compressed_tracks_->get_size());
 }
+
+void validate_packed_tracks(iallocator& allocator, const compressed_tracks& tracks)
+{
+	uint8_t* packed_buffer = nullptr;
+	uint32_t packed_size = 0;
+	error_result result = pack_compressed_tracks(allocator, tracks, packed_buffer, packed_size);
+	ACL_ASSERT(result.empty() && packed_buffer != nullptr, "Pack failed");
+	ACL_ASSERT(get_unpacked_compressed_tracks_size(packed_buffer, packed_size) == tracks.get_size(), "Unexpected unpacked size");
+
+	compressed_tracks* unpacked_tracks = nullptr;
+	result = unpack_compressed_tracks(allocator, packed_buffer, packed_size, unpacked_tracks);
+	ACL_ASSERT(result.empty() && unpacked_tracks != nullptr, "Unpack failed");
+	ACL_ASSERT(unpacked_tracks->get_size() == tracks.get_size(), "Unpacked size mismatch");
+	ACL_ASSERT(std::memcmp(unpacked_tracks, &tracks, tracks.get_size()) == 0, "Unpacked tracks differ");
+
+	{
+		// Region sizes that wrap around when summed must be rejected
+		uint8_t* corrupted_buffer = allocate_type_array<uint8_t>(allocator, packed_size);
+		std::memcpy(corrupted_buffer, packed_buffer, packed_size);
+
+		const acl_impl::packed_tracks_header* packed_header = acl_impl::bit_cast<const acl_impl::packed_tracks_header*>(packed_buffer);
+		acl_impl::packed_region* corrupted_regions = acl_impl::bit_cast<acl_impl::packed_region*>(corrupted_buffer + sizeof(acl_impl::packed_tracks_header));
+
+		if (packed_header->num_regions >= 3)
+		{
+			corrupted_regions[0].size = 0xFFFFFFF0U;
+			corrupted_regions[1].size = 0x20;
+			corrupted_regions[2].size = packed_header->unpacked_size - 0x10;
+			for (uint32_t region_index = 3; region_index < packed_header->num_regions; ++region_index)
+				corrupted_regions[region_index].size = 0;
+
+			compressed_tracks* corrupted_tracks = nullptr;
+			result = unpack_compressed_tracks(allocator, corrupted_buffer, packed_size, corrupted_tracks);
+			ACL_ASSERT(result.any() && corrupted_tracks == nullptr, "Corrupted region sizes should fail to unpack");
+
+			std::memcpy(corrupted_buffer, packed_buffer, packed_size);
+		}
+
+		// Unknown region types must be rejected
+		corrupted_regions[0].type = static_cast<acl_impl::packed_region_type8>(0xFF);
+
+		compressed_tracks* corrupted_tracks = nullptr;
+		result = unpack_compressed_tracks(allocator, corrupted_buffer, packed_size, corrupted_tracks);
+		ACL_ASSERT(result.any() && corrupted_tracks == nullptr, "Unknown region types should fail to unpack");
+
+		deallocate_type_array(allocator, corrupted_buffer, packed_size);
+	}
+
+	// A corrupted buffer must be rejected, we flip a byte past the packed header
+	if (packed_size > 128)
+	{
+		packed_buffer[64 + (packed_size - 64) / 2] ^= 0xA5;
+
+		compressed_tracks* corrupted_tracks = nullptr;
+		result = unpack_compressed_tracks(allocator, packed_buffer, packed_size, corrupted_tracks);
+		ACL_ASSERT(result.any() && corrupted_tracks == nullptr, "Corrupted buffer should fail to unpack");
+	}
+
+	allocator.deallocate(unpacked_tracks, unpacked_tracks->get_size());
+	allocator.deallocate(packed_buffer, packed_size);
+}
 #endif
@@ -151,7 +151,7 @@ extern "C" jint Java_com_acl_decompressor_MainActivity_nativeMain(JNIEnv* env, j
 
 		acl::compressed_tracks* raw_tracks = acl::acl_impl::bit_cast<acl::compressed_tracks*>(clip_buffer);
 
-		prepare_clip(clip, *raw_tracks, compressed_clips);
+		prepare_clip(clip, *raw_tracks, false, false, compressed_clips);
 
 		// We are done with this now
 		free(raw_tracks);
@@ -159,6 +159,14 @@ extern "C" jint Java_com_acl_decompressor_MainActivity_nativeMain(JNIEnv* env, j
 
 	const int num_failed_decompression = clips.size() - compressed_clips.size();
 
+	// Scalar track benchmarks use synthetic clips that do not require any external data
+	if (!prepare_synthetic_scalar_clips(compressed_clips))
+	{
+		__android_log_print(ANDROID_LOG_ERROR, "acl", "Failed to prepare the synthetic scalar clips");
+		env->ReleaseStringUTFChars(java_output_directory, output_directory);
+		return -4;
+	}
+
 	char argv_0_executable_name[64];
 	snprintf(argv_0_executable_name, sizeof(argv_0_executable_name), "Android APK");
 
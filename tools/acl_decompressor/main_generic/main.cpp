@@ -88,9 +88,11 @@ static bool is_sjson_file(const char* filename)
 	return filename_len >= 6 && strncmp(filename + filename_len - 6, ".sjson", 6) == 0;
 }
 
-static bool parse_options(int argc, char* argv[], const char*& out_metadata_filename)
+static bool parse_options(int argc, char* argv[], const char*& out_metadata_filename, bool& out_enable_multithreading, bool& out_enable_byte_aligned)
 {
 	out_metadata_filename = nullptr;
+	out_enable_multithreading = false;
+	out_enable_byte_aligned = false;
 
 	for (int arg_index = 1; arg_index < argc; ++arg_index)
 	{
@@ -109,9 +111,23 @@ static bool parse_options(int argc, char* argv[], const char*& out_metadata_file
 
 			continue;
 		}
+
+		static constexpr const char* k_multithreading_option = "-mt";
+		if (std::strcmp(argument, k_multithreading_option) == 0)
+		{
+			out_enable_multithreading = true;
+			continue;
+		}
+
+		static constexpr const char* k_byte_aligned_option = "-byte_aligned";
+		if (std::strcmp(argument, k_byte_aligned_option) == 0)
+		{
+			out_enable_byte_aligned = true;
+			continue;
+		}
 	}
 
-	return out_metadata_filename != nullptr;
+	return true;
 }
 
 static bool read_metadata_file(const char* metadata_filename, const char*& out_metadata_buffer, size_t& out_metadata_buffer_size)
@@ -171,30 +187,41 @@ static bool read_metadata_file(const char* metadata_filename, const char*& out_m
 
 int main(int argc, char* argv[])
 {
+	const char* metadata_filename = nullptr;
+	bool enable_multithreading = false;
+	bool enable_byte_aligned = false;
+	if (!parse_options(argc, argv, metadata_filename, enable_multithreading, enable_byte_aligned))
+		return -1;
+
 #if defined(_WIN32)
 	// To improve the consistency of the performance results, pin our process to a specific processor core
 	// Set the process affinity to physical core 6, on Ryzen 2950X it is the fastest core of the Die 1
-	const DWORD_PTR physical_core_index = 5;
-	const DWORD_PTR logical_core_index = physical_core_index * 2;
-	SetProcessAffinityMask(GetCurrentProcess(), 1 << logical_core_index);
+	// When measuring multithreaded throughput, we need every core
+	if (!enable_multithreading)
+	{
+		const DWORD_PTR physical_core_index = 5;
+		const DWORD_PTR logical_core_index = physical_core_index * 2;
+		SetProcessAffinityMask(GetCurrentProcess(), 1 << logical_core_index);
+	}
 #endif
 
-	const char* metadata_filename = nullptr;
-	if (!parse_options(argc, argv, metadata_filename))
-		return -1;
-
-	const char* metadata_buffer = nullptr;
-	size_t metadata_buffer_size = 0;
-	if (!read_metadata_file(metadata_filename, metadata_buffer, metadata_buffer_size))
-		return -2;
-
 	std::string clip_dir;
 	std::vector<std::string> clips;
-	if (!parse_metadata(metadata_buffer, metadata_buffer_size, clip_dir, clips))
-		return -3;
 
-	delete[] metadata_buffer;
-	metadata_buffer = nullptr;
+	// The metadata file is optional, without it only the synthetic clips are benchmarked
+	if (metadata_filename != nullptr)
+	{
+		const char* metadata_buffer = nullptr;
+		size_t metadata_buffer_size = 0;
+		if (!read_metadata_file(metadata_filename, metadata_buffer, metadata_buffer_size))
+			return -2;
+
+		if (!parse_metadata(metadata_buffer, metadata_buffer_size, clip_dir, clips))
+			return -3;
+
+		delete[] metadata_buffer;
+		metadata_buffer = nullptr;
+	}
 
 	std::vector<acl::compressed_tracks*> compressed_clips;
 	for (const std::string& clip : clips)
@@ -206,11 +233,14 @@ int main(int argc, char* argv[])
 			continue;
 		}
 
-		prepare_clip(clip, *raw_tracks, compressed_clips);
+		prepare_clip(clip, *raw_tracks, enable_multithreading, enable_byte_aligned, compressed_clips);
 
 		s_allocator.deallocate(raw_tracks, raw_tracks->get_size());
 	}
 
+	if (!prepare_synthetic_scalar_clips(compressed_clips))
+		return -4;
+
 	benchmark::Initialize(&argc, argv);
 
 	// Run benchmarks
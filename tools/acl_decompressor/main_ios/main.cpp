@@ -114,11 +114,18 @@ int main(int argc, char* argv[])
 
 		const acl::compressed_tracks* raw_tracks = acl::acl_impl::bit_cast<const acl::compressed_tracks*>(buffer.data());
 
-		prepare_clip(clip, *raw_tracks, compressed_clips);
+		prepare_clip(clip, *raw_tracks, false, false, compressed_clips);
 	}
 
 	const int num_failed_decompression = int(clips.size() - compressed_clips.size());
 
+	// Scalar track benchmarks use synthetic clips that do not require any external data
+	if (!prepare_synthetic_scalar_clips(compressed_clips))
+	{
+		printf("Failed to prepare the synthetic scalar clips\n");
+		return -4;
+	}
+
 	char argv_0_executable_name[64];
 	snprintf(argv_0_executable_name, sizeof(argv_0_executable_name), "iOS Bundle");
 
@@ -30,16 +30,23 @@
 #include <acl/core/impl/bit_cast.impl.h>
 #include <acl/compression/compress.h>
 #include <acl/compression/convert.h>
+#include <acl/compression/track_array.h>
 #include "acl/compression/pre_process.h"
 
+#if defined(ACL_USE_MEMORY_TOUCH_RECORDER)
+	#include <acl/decompression/memory_touch_recorder.h>
+#endif
+
 #include <benchmark/benchmark.h>
 
 #include <sjson/parser.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 //////////////////////////////////////////////////////////////////////////
@@ -89,6 +96,13 @@ enum class DecompressionFunction
 	DecompressPose,
 	DecompressBone,
 	Memcpy,
+	DecompressSingleTrack,
+};
+
+enum class CacheState
+{
+	Cold,
+	Warm,
 };
 
 struct benchmark_transform_decompression_settings final : public acl::default_transform_decompression_settings
@@ -100,17 +114,30 @@ struct benchmark_transform_decompression_settings final : public acl::default_tr
 	static constexpr bool skip_initialize_safety_checks() { return true; }
 };
 
+struct benchmark_scalar_decompression_settings final : public acl::default_scalar_decompression_settings
+{
+	// Only support our latest version
+	static constexpr acl::compressed_tracks_version16 version_supported() { return acl::compressed_tracks_version16::latest; }
+
+	// No need for safety checks
+	static constexpr bool skip_initialize_safety_checks() { return true; }
+};
+
 struct benchmark_state
 {
 	acl::compressed_tracks* compressed_tracks = nullptr;	// Original clip
 
 	acl::compressed_tracks** decompression_instances = nullptr;
 	acl::decompression_context<benchmark_transform_decompression_settings>* decompression_contexts = nullptr;
+	acl::decompression_context<benchmark_scalar_decompression_settings>* scalar_decompression_contexts = nullptr;
 	uint8_t* clip_copy_buffer = nullptr;
 	uint8_t* flush_buffer = nullptr;
 
 	uint32_t pose_size = 0;
 	uint32_t clip_copy_buffer_size = 0;
+
+	// Average number of bytes in the cache lines a pose decompression touches, 0 if it wasn't measured
+	uint32_t touched_bytes_per_decompression = 0;
 };
 
 acl::ansi_allocator s_allocator;
@@ -119,6 +146,7 @@ static benchmark_state s_benchmark_state;
 void clear_benchmark_state()
 {
 	acl::deallocate_type_array(s_allocator, s_benchmark_state.decompression_contexts, k_num_copies);
+	acl::deallocate_type_array(s_allocator, s_benchmark_state.scalar_decompression_contexts, k_num_copies);
 	acl::deallocate_type_array(s_allocator, s_benchmark_state.decompression_instances, k_num_copies);
 	acl::deallocate_type_array(s_allocator, s_benchmark_state.clip_copy_buffer, s_benchmark_state.clip_copy_buffer_size);
 	acl::deallocate_type_array(s_allocator, s_benchmark_state.flush_buffer, k_padded_flush_buffer_size);
@@ -133,6 +161,7 @@ static void allocate_static_buffers()
 
 	s_benchmark_state.decompression_instances = acl::allocate_type_array<acl::compressed_tracks*>(s_allocator, k_num_copies);
 	s_benchmark_state.decompression_contexts = acl::allocate_type_array<acl::decompression_context<benchmark_transform_decompression_settings>>(s_allocator, k_num_copies);
+	s_benchmark_state.scalar_decompression_contexts = acl::allocate_type_array<acl::decompression_context<benchmark_scalar_decompression_settings>>(s_allocator, k_num_copies);
 	s_benchmark_state.flush_buffer = acl::allocate_type_array<uint8_t>(s_allocator, k_padded_flush_buffer_size);
 }
 
@@ -142,8 +171,12 @@ static void setup_benchmark_state(acl::compressed_tracks& compressed_tracks)
 
 	const uint32_t num_tracks = compressed_tracks.get_num_tracks();
 	const uint32_t compressed_size = compressed_tracks.get_size();
+	const acl::track_type8 track_type = compressed_tracks.get_track_type();
+	const bool is_transform = acl::get_track_category(track_type) == acl::track_category8::transformf;
 
-	const uint32_t num_bytes_per_track = (4 + 3 + 3) * sizeof(float);	// Rotation, Translation, Scale
+	const uint32_t num_bytes_per_track = is_transform ?
+		((4 + 3 + 3) * sizeof(float)) :	// Rotation, Translation, Scale
+		(acl::get_track_num_sample_elements(track_type) * sizeof(float));
 	const uint32_t pose_size = num_tracks * num_bytes_per_track;
 
 	// Each clip is rounded up to a multiple of our VMEM padding
@@ -151,7 +184,6 @@ static void setup_benchmark_state(acl::compressed_tracks& compressed_tracks)
 	const uint32_t clip_buffer_size = padded_clip_size * k_num_copies;
 
 	acl::compressed_tracks** decompression_instances = s_benchmark_state.decompression_instances;
-	acl::decompression_context<benchmark_transform_decompression_settings>* decompression_contexts = s_benchmark_state.decompression_contexts;
 	uint8_t* clip_copy_buffer = s_benchmark_state.clip_copy_buffer;
 
 	if (clip_buffer_size > s_benchmark_state.clip_copy_buffer_size)
@@ -175,11 +207,22 @@ static void setup_benchmark_state(acl::compressed_tracks& compressed_tracks)
 	}
 
 	// Create our decompression contexts
-	for (uint32_t instance_index = 0; instance_index < k_num_copies; ++instance_index)
-		decompression_contexts[instance_index].initialize(*decompression_instances[instance_index]);
+	if (is_transform)
+	{
+		acl::decompression_context<benchmark_transform_decompression_settings>* decompression_contexts = s_benchmark_state.decompression_contexts;
+		for (uint32_t instance_index = 0; instance_index < k_num_copies; ++instance_index)
+			decompression_contexts[instance_index].initialize(*decompression_instances[instance_index]);
+	}
+	else
+	{
+		acl::decompression_context<benchmark_scalar_decompression_settings>* decompression_contexts = s_benchmark_state.scalar_decompression_contexts;
+		for (uint32_t instance_index = 0; instance_index < k_num_copies; ++instance_index)
+			decompression_contexts[instance_index].initialize(*decompression_instances[instance_index]);
+	}
 
 	s_benchmark_state.compressed_tracks = &compressed_tracks;
 	s_benchmark_state.pose_size = pose_size;
+	s_benchmark_state.touched_bytes_per_decompression = 0;
 }
 
 static void memset_impl(uint8_t* buffer, size_t buffer_size, uint8_t value)
@@ -188,24 +231,26 @@ static void memset_impl(uint8_t* buffer, size_t buffer_size, uint8_t value)
 		*ptr = value;
 }
 
-static void benchmark_decompression(benchmark::State& state)
-{
-	acl::compressed_tracks& compressed_tracks = *acl::acl_impl::bit_cast<acl::compressed_tracks*>(state.range(0));
-	const PlaybackDirection playback_direction = static_cast<PlaybackDirection>(state.range(1));
-	const DecompressionFunction decompression_function = static_cast<DecompressionFunction>(state.range(2));
+template<class decompression_settings_type>
+static acl::decompression_context<decompression_settings_type>* get_decompression_contexts();
 
-	if (s_benchmark_state.compressed_tracks != &compressed_tracks)
-		setup_benchmark_state(compressed_tracks);	// We have a new clip, setup everything
+template<>
+acl::decompression_context<benchmark_transform_decompression_settings>* get_decompression_contexts<benchmark_transform_decompression_settings>() { return s_benchmark_state.decompression_contexts; }
+
+template<>
+acl::decompression_context<benchmark_scalar_decompression_settings>* get_decompression_contexts<benchmark_scalar_decompression_settings>() { return s_benchmark_state.scalar_decompression_contexts; }
 
+static constexpr uint32_t k_num_decompression_samples = 100;
+
+static void setup_sample_times(const acl::compressed_tracks& compressed_tracks, PlaybackDirection playback_direction, float (&out_sample_times)[k_num_decompression_samples])
+{
 	// Use clamp policy as it is the most common
 	const float duration = compressed_tracks.get_finite_duration(acl::sample_looping_policy::non_looping);
 
-	constexpr uint32_t k_num_decompression_samples = 100;
-	float sample_times[k_num_decompression_samples];
 	for (uint32_t sample_index = 0; sample_index < k_num_decompression_samples; ++sample_index)
 	{
 		const float normalized_sample_time = float(sample_index) / float(k_num_decompression_samples - 1);
-		sample_times[sample_index] = rtm::scalar_clamp(normalized_sample_time, 0.0F, 1.0F) * duration;
+		out_sample_times[sample_index] = rtm::scalar_clamp(normalized_sample_time, 0.0F, 1.0F) * duration;
 	}
 
 	switch (playback_direction)
@@ -214,20 +259,41 @@ static void benchmark_decompression(benchmark::State& state)
 	default:
 		break;
 	case PlaybackDirection::Backward:
-		std::reverse(&sample_times[0], &sample_times[k_num_decompression_samples]);
+		std::reverse(&out_sample_times[0], &out_sample_times[k_num_decompression_samples]);
 		break;
 	case PlaybackDirection::Random:
-		std::shuffle(&sample_times[0], &sample_times[k_num_decompression_samples], std::default_random_engine(0));
+		std::shuffle(&out_sample_times[0], &out_sample_times[k_num_decompression_samples], std::default_random_engine(0));
 		break;
 	}
+}
+
+template<class decompression_settings_type>
+static void benchmark_decompression_impl(benchmark::State& state, CacheState cache_state)
+{
+	acl::compressed_tracks& compressed_tracks = *acl::acl_impl::bit_cast<acl::compressed_tracks*>(state.range(0));
+	const PlaybackDirection playback_direction = static_cast<PlaybackDirection>(state.range(1));
+	const DecompressionFunction decompression_function = static_cast<DecompressionFunction>(state.range(2));
+
+	if (s_benchmark_state.compressed_tracks != &compressed_tracks)
+		setup_benchmark_state(compressed_tracks);	// We have a new clip, setup everything
+
+	float sample_times[k_num_decompression_samples];
+	setup_sample_times(compressed_tracks, playback_direction, sample_times);
 
 	acl::compressed_tracks** decompression_instances = s_benchmark_state.decompression_instances;
-	acl::decompression_context<benchmark_transform_decompression_settings>* decompression_contexts = s_benchmark_state.decompression_contexts;
+	acl::decompression_context<decompression_settings_type>* decompression_contexts = get_decompression_contexts<decompression_settings_type>();
 	uint8_t* flush_buffer = s_benchmark_state.flush_buffer;
 	const uint32_t pose_size = s_benchmark_state.pose_size;
 
 	const uint32_t num_tracks = compressed_tracks.get_num_tracks();
-	acl::acl_impl::debug_track_writer pose_writer(s_allocator, acl::track_type8::qvvf, num_tracks);
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, compressed_tracks.get_track_type(), num_tracks);
+
+	// When we decompress a single track, we pick one in the middle
+	const uint32_t single_track_index = num_tracks / 2;
+
+	// With a warm CPU cache, we always decompress the same instance and never flush
+	const bool is_cold_cache = cache_state == CacheState::Cold;
+	const uint32_t num_contexts = is_cold_cache ? k_num_copies : 1;
 
 	// Flush the CPU cache
 	memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, 1);
@@ -243,7 +309,7 @@ static void benchmark_decompression(benchmark::State& state)
 
 		const float sample_time = sample_times[current_sample_index];
 
-		acl::decompression_context<benchmark_transform_decompression_settings>& context = decompression_contexts[current_context_index];
+		acl::decompression_context<decompression_settings_type>& context = decompression_contexts[current_context_index];
 
 		// Interpolate as this is the most common scenario
 		context.seek(sample_time, acl::sample_rounding_policy::none);
@@ -258,7 +324,10 @@ static void benchmark_decompression(benchmark::State& state)
 				context.decompress_track(bone_index, pose_writer);
 			break;
 		case DecompressionFunction::Memcpy:
-			std::memcpy(pose_writer.tracks_typed.qvvf, decompression_instances[current_context_index], pose_size);
+			std::memcpy(pose_writer.tracks_typed.any, decompression_instances[current_context_index], pose_size);
+			break;
+		case DecompressionFunction::DecompressSingleTrack:
+			context.decompress_track(single_track_index, pose_writer);
 			break;
 		}
 
@@ -269,7 +338,7 @@ static void benchmark_decompression(benchmark::State& state)
 		// Move on to the next context and sample
 		// We only move on to the next sample once every context has been touched
 		current_context_index++;
-		if (current_context_index >= k_num_copies)
+		if (current_context_index >= num_contexts)
 		{
 			current_context_index = 0;
 			current_sample_index++;
@@ -278,11 +347,122 @@ static void benchmark_decompression(benchmark::State& state)
 				current_sample_index = 0;
 
 			// Flush the CPU cache
-			memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, flush_value++);
+			if (is_cold_cache)
+				memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, flush_value++);
+		}
+	}
+
+	const uint32_t decompressed_size = decompression_function == DecompressionFunction::DecompressSingleTrack ? (pose_size / num_tracks) : pose_size;
+	state.counters["Speed"] = benchmark::Counter(decompressed_size, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+}
+
+static void benchmark_decompression(benchmark::State& state)
+{
+	benchmark_decompression_impl<benchmark_transform_decompression_settings>(state, CacheState::Cold);
+}
+
+static void benchmark_scalar_decompression(benchmark::State& state)
+{
+	benchmark_decompression_impl<benchmark_scalar_decompression_settings>(state, static_cast<CacheState>(state.range(3)));
+}
+
+// Measures the average number of bytes in the cache lines touched when we seek and decompress a full pose
+// at every sample time, this is what a decompression pulls from memory
+static uint32_t measure_touched_bytes_per_decompression(const acl::compressed_tracks& compressed_tracks, const float (&sample_times)[k_num_decompression_samples])
+{
+#if defined(ACL_USE_MEMORY_TOUCH_RECORDER)
+	acl::decompression_context<acl::instrumented_transform_decompression_settings> context;
+	if (!context.initialize(compressed_tracks))
+		return 0;
+
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, acl::track_type8::qvvf, compressed_tracks.get_num_tracks());
+	acl::memory_touch_recorder recorder(s_allocator);
+
+	uint64_t total_touched_bytes = 0;
+	for (const float sample_time : sample_times)
+	{
+		recorder.reset();
+
+		{
+			acl::scope_memory_touch_recorder recording(recorder);
+			context.seek(sample_time, acl::sample_rounding_policy::none);
+			context.decompress_tracks(pose_writer);
 		}
+
+		total_touched_bytes += uint64_t(recorder.get_stats().num_touched_cache_lines) * acl::memory_touch_recorder::k_cache_line_size;
 	}
 
-	state.counters["Speed"] = benchmark::Counter(s_benchmark_state.pose_size, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+	return uint32_t(total_touched_bytes / k_num_decompression_samples);
+#else
+	(void)compressed_tracks;
+	(void)sample_times;
+	return 0;
+#endif
+}
+
+static void benchmark_decompression_multithreaded(benchmark::State& state)
+{
+	acl::compressed_tracks& compressed_tracks = *acl::acl_impl::bit_cast<acl::compressed_tracks*>(state.range(0));
+
+	// Only the main thread sets up the shared state, the other threads wait for it when the benchmark loop begins
+	if (state.thread_index() == 0 && s_benchmark_state.compressed_tracks != &compressed_tracks)
+		setup_benchmark_state(compressed_tracks);	// We have a new clip, setup everything
+
+	float sample_times[k_num_decompression_samples];
+	setup_sample_times(compressed_tracks, PlaybackDirection::Forward, sample_times);
+
+	if (state.thread_index() == 0 && s_benchmark_state.touched_bytes_per_decompression == 0)
+		s_benchmark_state.touched_bytes_per_decompression = measure_touched_bytes_per_decompression(compressed_tracks, sample_times);
+
+	const uint32_t num_tracks = compressed_tracks.get_num_tracks();
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, acl::track_type8::qvvf, num_tracks);
+
+	// Every thread decompresses its own set of clip instances, we never share a context between threads
+	// The CPU cache isn't explicitly flushed, every thread competes for the shared cache and memory bandwidth
+	// which is what we aim to measure
+	const uint32_t thread_index = uint32_t(state.thread_index());
+	const uint32_t num_threads = uint32_t(state.threads());
+	const uint32_t first_context_index = (thread_index * k_num_copies) / num_threads;
+	const uint32_t end_context_index = ((thread_index + 1) * k_num_copies) / num_threads;
+	ACL_ASSERT(first_context_index < end_context_index, "Every thread needs at least one clip instance, too many threads");
+
+	uint32_t current_context_index = first_context_index;
+	uint32_t current_sample_index = 0;
+	for (auto _ : state)
+	{
+		(void)_;
+
+		const float sample_time = sample_times[current_sample_index];
+
+		acl::decompression_context<benchmark_transform_decompression_settings>& context = s_benchmark_state.decompression_contexts[current_context_index];
+
+		// Interpolate as this is the most common scenario
+		context.seek(sample_time, acl::sample_rounding_policy::none);
+		context.decompress_tracks(pose_writer);
+
+		// Move on to the next context and sample
+		// We only move on to the next sample once every context of this thread has been touched
+		current_context_index++;
+		if (current_context_index >= end_context_index)
+		{
+			current_context_index = first_context_index;
+			current_sample_index++;
+
+			if (current_sample_index >= k_num_decompression_samples)
+				current_sample_index = 0;
+		}
+	}
+
+	// Counters are summed across threads and divided by the wall clock time
+	// This gives us the aggregate throughput of every thread
+	state.counters["Poses"] = benchmark::Counter(1.0, benchmark::Counter::kIsIterationInvariantRate);
+
+	// Every decompression only touches a small portion of its compressed clip instance, we report the bytes
+	// in the cache lines it touches which is what competes for the memory bandwidth
+	// Without the memory touch recorder, we cannot measure it and we don't report it
+	const uint32_t touched_bytes_per_decompression = s_benchmark_state.touched_bytes_per_decompression;
+	if (touched_bytes_per_decompression != 0)
+		state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(touched_bytes_per_decompression));
 }
 
 bool parse_metadata(const char* buffer, size_t buffer_size, std::string& out_clip_dir, std::vector<std::string>& out_clips)
@@ -377,7 +557,39 @@ bool read_clip(const std::string& clip_dir, const std::string& clip, acl::ialloc
 	return true;
 }
 
-bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, std::vector<acl::compressed_tracks*>& out_compressed_clips)
+static void register_transform_benchmarks(const std::string& clip_name, acl::compressed_tracks* compressed_tracks)
+{
+	benchmark::internal::Benchmark* bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(clip_name.c_str(), benchmark_decompression));
+
+	bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose });
+	bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressBone });
+
+	// These are for debugging purposes and aren't measured as often
+	// By design, ACL's performance should be consistent regardless of the playback direction
+	//bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::Memcpy });
+	//bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressPose });
+	//bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressBone });
+	//bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressPose });
+	//bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressBone });
+
+	// Name our arguments
+	bench->ArgNames({ "", "Dir", "Func" });
+
+	// Sometimes the numbers are slightly different from run to run, we'll run a few times
+	bench->Repetitions(3);
+
+	// Our benchmark has a very low standard deviation, there is no need to run 100k+ times
+	bench->Iterations(10000);
+
+	// Use manual timing since we clear the CPU cache explicitly
+	bench->UseManualTime();
+
+	// Add min/max tracking
+	bench->ComputeStatistics("min", [](const std::vector<double>& v) { return *std::min_element(std::begin(v), std::end(v)); });
+	bench->ComputeStatistics("max", [](const std::vector<double>& v) { return *std::max_element(std::begin(v), std::end(v)); });
+}
+
+bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, bool enable_multithreading, bool enable_byte_aligned, std::vector<acl::compressed_tracks*>& out_compressed_clips)
 {
 	printf("Preparing clip %s ...\n", clip_name.c_str());
 
@@ -435,21 +647,72 @@ bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& ra
 	}
 
 	// Dynamically register our benchmark
-	benchmark::internal::Benchmark* bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(clip_name.c_str(), benchmark_decompression));
+	register_transform_benchmarks(clip_name, compressed_tracks);
 
-	bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose });
-	bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressBone });
+	if (enable_byte_aligned)
+	{
+		// Compress a second time with byte aligned bit rates to compare against the generic variable bit rate unpacking
+		acl::compression_settings byte_aligned_settings = settings;
+		byte_aligned_settings.enable_byte_aligned_bit_rates = true;
+
+		acl::compressed_tracks* byte_aligned_tracks = nullptr;
+		result = acl::compress_track_list(s_allocator, track_list, byte_aligned_settings, byte_aligned_tracks, stats);
+		if (result.any() || byte_aligned_tracks->is_valid(false).any())
+			printf("    Failed to compress byte aligned clip!\n");
+		else
+		{
+			printf("    Compressed size: %u bytes, byte aligned: %u bytes\n", compressed_tracks->get_size(), byte_aligned_tracks->get_size());
 
-	// These are for debugging purposes and aren't measured as often
-	// By design, ACL's performance should be consistent regardless of the playback direction
-	//bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::Memcpy });
-	//bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressPose });
-	//bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressBone });
-	//bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressPose });
-	//bench->Args({ acl::acl_impl::bit_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressBone });
+			register_transform_benchmarks(clip_name + "/ByteAligned", byte_aligned_tracks);
+			out_compressed_clips.push_back(byte_aligned_tracks);
+		}
+	}
+
+	if (enable_multithreading)
+	{
+		// Measure how the aggregate throughput scales as we add more threads
+		const std::string mt_clip_name = clip_name + "/MT";
+		benchmark::internal::Benchmark* mt_bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(mt_clip_name.c_str(), benchmark_decompression_multithreaded));
+
+		mt_bench->Arg(acl::acl_impl::bit_cast<int64_t>(compressed_tracks));
+		mt_bench->ArgNames({ "" });
+
+		// Powers of two up to the number of hardware threads available (the maximum is always included)
+		// Every thread needs its own clip instances, we never use more threads than we have instances
+		const int max_num_threads = std::min<int>(std::max<int>(int(std::thread::hardware_concurrency()), 1), int(k_num_copies));
+		mt_bench->ThreadRange(1, max_num_threads);
+
+		mt_bench->Repetitions(3);
+		mt_bench->Iterations(10000);
+
+		// Throughput is measured against the wall clock time
+		mt_bench->UseRealTime();
+
+		mt_bench->ComputeStatistics("min", [](const std::vector<double>& v) { return *std::min_element(std::begin(v), std::end(v)); });
+		mt_bench->ComputeStatistics("max", [](const std::vector<double>& v) { return *std::max_element(std::begin(v), std::end(v)); });
+	}
+
+	out_compressed_clips.push_back(compressed_tracks);
+	return true;
+}
+
+static void register_scalar_benchmarks(const std::string& clip_name, acl::compressed_tracks* compressed_tracks)
+{
+	benchmark::internal::Benchmark* bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(clip_name.c_str(), benchmark_scalar_decompression));
+
+	const int64_t clip = acl::acl_impl::bit_cast<int64_t>(compressed_tracks);
+
+	bench->Args({ clip, (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheState::Cold });
+	bench->Args({ clip, (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheState::Warm });
+	bench->Args({ clip, (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressSingleTrack, (int64_t)CacheState::Cold });
+	bench->Args({ clip, (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressSingleTrack, (int64_t)CacheState::Warm });
+	bench->Args({ clip, (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheState::Cold });
+	bench->Args({ clip, (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheState::Warm });
+	bench->Args({ clip, (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheState::Cold });
+	bench->Args({ clip, (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheState::Warm });
 
 	// Name our arguments
-	bench->ArgNames({ "", "Dir", "Func" });
+	bench->ArgNames({ "", "Dir", "Func", "Cache" });
 
 	// Sometimes the numbers are slightly different from run to run, we'll run a few times
 	bench->Repetitions(3);
@@ -463,7 +726,149 @@ bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& ra
 	// Add min/max tracking
 	bench->ComputeStatistics("min", [](const std::vector<double>& v) { return *std::min_element(std::begin(v), std::end(v)); });
 	bench->ComputeStatistics("max", [](const std::vector<double>& v) { return *std::max_element(std::begin(v), std::end(v)); });
+}
+
+// Generates a deterministic scalar track list that resembles facial rigs and material curves:
+// smooth curves of varying frequency and amplitude with a portion of constant tracks
+template<acl::track_type8 track_type>
+static acl::track_array_typed<track_type> make_synthetic_scalar_track_list(uint32_t num_tracks, uint32_t num_samples, float sample_rate)
+{
+	using track_type_ = acl::track_typed<track_type>;
+	using sample_type = typename track_type_::sample_type;
+
+	constexpr uint32_t k_num_components = sizeof(sample_type) / sizeof(float);
+	static_assert(k_num_components >= 1 && k_num_components <= 4, "Unexpected sample type");
+
+	std::default_random_engine rng(num_tracks * 31 + k_num_components);
+	std::uniform_real_distribution<float> frequency_dist(0.1F, 4.0F);
+	std::uniform_real_distribution<float> phase_dist(0.0F, 6.283185F);
+	std::uniform_real_distribution<float> amplitude_dist(0.01F, 10.0F);
+
+	acl::track_array_typed<track_type> track_list(s_allocator, num_tracks);
+
+	for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+	{
+		acl::track_desc_scalarf desc;
+		desc.output_index = track_index;
+		desc.precision = 0.001F;
+
+		track_type_ track = track_type_::make_reserve(desc, s_allocator, num_samples, sample_rate);
+
+		// One track out of 8 is constant
+		const bool is_constant = (track_index % 8) == 7;
+
+		float frequencies[k_num_components];
+		float phases[k_num_components];
+		float amplitudes[k_num_components];
+		for (uint32_t component_index = 0; component_index < k_num_components; ++component_index)
+		{
+			frequencies[component_index] = frequency_dist(rng);
+			phases[component_index] = phase_dist(rng);
+			amplitudes[component_index] = amplitude_dist(rng);
+		}
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float sample_time = is_constant ? 0.0F : (float(sample_index) / sample_rate);
+
+			float values[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+			for (uint32_t component_index = 0; component_index < k_num_components; ++component_index)
+				values[component_index] = std::sin(sample_time * frequencies[component_index] + phases[component_index]) * amplitudes[component_index];
+
+			std::memcpy(&track[sample_index], &values[0], sizeof(sample_type));
+		}
+
+		track_list[track_index] = std::move(track);
+	}
+
+	return track_list;
+}
+
+// Returns the average time in microseconds to decompress with a warm CPU cache, used for a quick comparison between algorithms
+static double measure_warm_scalar_decompression_time(const acl::compressed_tracks& compressed_tracks, DecompressionFunction decompression_function)
+{
+	const uint32_t num_tracks = compressed_tracks.get_num_tracks();
+	const uint32_t single_track_index = num_tracks / 2;
+	const float duration = compressed_tracks.get_finite_duration(acl::sample_looping_policy::non_looping);
+
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, compressed_tracks.get_track_type(), num_tracks);
+
+	acl::decompression_context<benchmark_scalar_decompression_settings> context;
+	context.initialize(compressed_tracks);
+
+	const auto start = std::chrono::high_resolution_clock::now();
+
+	for (uint32_t sample_index = 0; sample_index < k_num_decompression_samples; ++sample_index)
+	{
+		const float sample_time = (float(sample_index) / float(k_num_decompression_samples - 1)) * duration;
+		context.seek(sample_time, acl::sample_rounding_policy::none);
+
+		if (decompression_function == DecompressionFunction::DecompressSingleTrack)
+			context.decompress_track(single_track_index, pose_writer);
+		else
+			context.decompress_tracks(pose_writer);
+	}
+
+	const auto end = std::chrono::high_resolution_clock::now();
+	const auto elapsed_us = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(end - start);
+	return elapsed_us.count() / double(k_num_decompression_samples);
+}
+
+static bool compress_synthetic_scalar_track_list(const std::string& clip_name, const acl::track_array& track_list, acl::algorithm_type8 algorithm, bool enable_track_offsets, std::vector<acl::compressed_tracks*>& out_compressed_clips)
+{
+	printf("Preparing clip %s ...\n", clip_name.c_str());
+
+	acl::compression_settings settings;
+	settings.scalar_algorithm = algorithm;
+	settings.enable_scalar_track_offsets = enable_track_offsets;
+
+	acl::output_stats stats;
+
+	acl::compressed_tracks* compressed_tracks = nullptr;
+	const acl::error_result result = acl::compress_track_list(s_allocator, track_list, settings, compressed_tracks, stats);
+	if (result.any() || compressed_tracks->is_valid(false).any())
+	{
+		printf("    Failed to compress clip!\n");
+		return false;
+	}
+
+	// Report our size and a quick warm cache timing to compare the algorithms, the registered benchmarks measure it properly
+	printf("    Compressed size: %u bytes\n", compressed_tracks->get_size());
+	printf("    Warm decompression: %.3f us per pose, %.3f us per single track\n",
+		measure_warm_scalar_decompression_time(*compressed_tracks, DecompressionFunction::DecompressPose),
+		measure_warm_scalar_decompression_time(*compressed_tracks, DecompressionFunction::DecompressSingleTrack));
+
+	register_scalar_benchmarks(clip_name, compressed_tracks);
 
 	out_compressed_clips.push_back(compressed_tracks);
 	return true;
 }
+
+bool prepare_synthetic_scalar_clips(std::vector<acl::compressed_tracks*>& out_compressed_clips)
+{
+	// 10 seconds at 30 FPS
+	const uint32_t num_samples = 301;
+	const float sample_rate = 30.0F;
+
+	bool success = true;
+
+	{
+		// A large facial rig with many independent curves
+		const acl::track_array_float1f track_list = make_synthetic_scalar_track_list<acl::track_type8::float1f>(1000, num_samples, sample_rate);
+		success &= compress_synthetic_scalar_track_list("synthetic_float1f_1000", track_list, acl::algorithm_type8::uniformly_sampled, false, out_compressed_clips);
+		success &= compress_synthetic_scalar_track_list("synthetic_float1f_1000_spline", track_list, acl::algorithm_type8::spline_key_reduction, false, out_compressed_clips);
+
+		// With track offsets, a single track is decompressed in constant time
+		success &= compress_synthetic_scalar_track_list("synthetic_float1f_1000_offsets", track_list, acl::algorithm_type8::uniformly_sampled, true, out_compressed_clips);
+		success &= compress_synthetic_scalar_track_list("synthetic_float1f_1000_spline_offsets", track_list, acl::algorithm_type8::spline_key_reduction, true, out_compressed_clips);
+	}
+
+	{
+		// Material curves (e.g. colors)
+		const acl::track_array_float4f track_list = make_synthetic_scalar_track_list<acl::track_type8::float4f>(250, num_samples, sample_rate);
+		success &= compress_synthetic_scalar_track_list("synthetic_float4f_250", track_list, acl::algorithm_type8::uniformly_sampled, false, out_compressed_clips);
+		success &= compress_synthetic_scalar_track_list("synthetic_float4f_250_spline", track_list, acl::algorithm_type8::spline_key_reduction, false, out_compressed_clips);
+	}
+
+	return success;
+}
@@ -38,4 +38,10 @@ bool parse_metadata(const char* buffer, size_t buffer_size, std::string& out_cli
 
 bool read_clip(const std::string& clip_dir, const std::string& clip, acl::iallocator& allocator, acl::compressed_tracks*& out_compressed_tracks);
 
-bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, std::vector<acl::compressed_tracks*>& out_compressed_clips);
+// When multithreading is enabled, a benchmark that measures the aggregate throughput of 1..N threads is also registered
+// When byte alignment is enabled, the clip is also compressed with byte aligned bit rates and benchmarked as '<clip>/ByteAligned'
+bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, bool enable_multithreading, bool enable_byte_aligned, std::vector<acl::compressed_tracks*>& out_compressed_clips);
+
+// Generates synthetic scalar track lists, compresses them, and registers their benchmarks
+// These do not require any external data
+bool prepare_synthetic_scalar_clips(std::vector<acl::compressed_tracks*>& out_compressed_clips);